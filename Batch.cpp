@@ -0,0 +1,504 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Batch.hpp"
+#include "BinaryText.hpp"
+
+namespace Batch
+{
+    /// @brief Amount of entries that are read and processed together, so that a huge batch is never held in memory at once.
+    constexpr std::size_t roundSize = 1 << 14;
+
+    /// @brief Counters of a batch run.
+    struct Statistics
+    {
+        std::size_t entryCount = 0;   ///< Amount of processed entries.
+        std::size_t failureCount = 0; ///< Amount of entries that failed.
+        std::size_t inputSize = 0;    ///< Amount of bytes that were encoded or decoded.
+        std::size_t outputSize = 0;   ///< Amount of bytes that were produced.
+    };
+
+    /// @brief Buffers and counters of a worker thread. They are kept from one round to the next, so that their memory is reused.
+    struct Worker
+    {
+        std::string input;       ///< Content of the current input file.
+        std::string output;      ///< Result of the current entry.
+        std::string report;      ///< What is written to stdout for the part of the round the worker processed.
+        std::string errorReport; ///< What is written to stderr for the part of the round the worker processed.
+        Statistics statistics;   ///< Counters of everything the worker processed.
+    };
+
+    /**
+     * Threads of the workers, started once and handed one round after another, so that a batch of many rounds does not start and join threads for
+     * each of them. The calling thread does the part of the first worker, and of every worker whose thread could not be started, itself.
+    */
+    class Pool
+    {
+    public:
+        /**
+         * @brief Starts a thread for every worker but the first.
+         * @param[in] workerCount_ Amount of workers.
+         * @param[in] work_ Function that processes the part of a worker in the current round, called with the index of the worker.
+        */
+        Pool(const std::size_t workerCount_, std::function<void(std::size_t)> work_) :
+            _work(std::move(work_)),
+            _workerCount(workerCount_),
+            _round(0),
+            _busyCount(0),
+            _isStopped(false),
+            _threads()
+        {
+            for(std::size_t i(1); i < _workerCount; ++i) {
+                try {
+                    _threads.emplace_back([this, i]() { Work(i); });
+                } catch(const std::system_error&) {
+                    break;
+                }
+            }
+        }
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+        /// @brief Stops and joins the threads.
+        ~Pool()
+        {
+            {
+                std::lock_guard lock(_mutex);
+
+                _isStopped = true;
+            }
+
+            _condition.notify_all();
+
+            for(std::thread& thread : _threads) {
+                thread.join();
+            }
+        }
+
+        /// @brief Processes a round with every worker and returns once all of them are done.
+        void RunRound()
+        {
+            {
+                std::lock_guard lock(_mutex);
+
+                _round += 1;
+                _busyCount = _threads.size();
+            }
+
+            _condition.notify_all();
+
+            for(std::size_t i(_threads.size() + 1); i < _workerCount; ++i) {
+                _work(i);
+            }
+
+            _work(0);
+
+            std::unique_lock lock(_mutex);
+
+            _condition.wait(lock, [this]() { return _busyCount == 0; });
+        }
+
+    private:
+        /**
+         * @brief Loop of a thread, which processes the part of its worker in every round until the Pool is destroyed.
+         * @param[in] workerIndex_ Index of the worker of the thread.
+        */
+        void Work(const std::size_t workerIndex_)
+        {
+            std::size_t round(0);
+            std::unique_lock lock(_mutex);
+
+            while(true) {
+                _condition.wait(lock, [this, &round]() { return _round != round or _isStopped; });
+
+                if(_isStopped) {
+                    return;
+                }
+
+                round = _round;
+                lock.unlock();
+                _work(workerIndex_);
+                lock.lock();
+
+                if(--_busyCount == 0) {
+                    _condition.notify_all();
+                }
+            }
+        }
+
+        std::function<void(std::size_t)> _work;
+        std::size_t _workerCount;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::size_t _round;     ///< Number of the current round, a thread starts working when it changes.
+        std::size_t _busyCount; ///< Amount of threads that have not finished the current round.
+        bool _isStopped;
+        std::vector<std::thread> _threads;
+    };
+
+    /**
+     * @brief Encodes or decodes an input with the task, algorithm and options of the command-line arguments.
+     * @param[in] arguments_ Parsed command-line arguments.
+     * @param[in] input_ Input to be encoded or decoded.
+     * @param[out] output_ Where the result is written to, it is resized to fit the result.
+     * @param[out] errorCode_ Cleared on success, set to the error code of the codec otherwise.
+    */
+    void Convert(const Utility::Arguments& arguments_, const std::string_view input_, std::string& output_, std::error_code& errorCode_)
+    {
+        using Algorithm = Utility::Arguments::Algorithm;
+        using Task = Utility::Arguments::Task;
+
+        const bool isEncoding(arguments_.GetTask() == Task::ENCODE_TEXT or arguments_.GetTask() == Task::ENCODE_BINARY);
+        const std::span<const std::byte> bytes(std::as_bytes(std::span(input_)));
+
+        switch(arguments_.GetAlgorithm()) {
+            case Algorithm::BASE_16: {
+                BinaryText::Base16::Case characterCase(BinaryText::Base16::Case::MIXED);
+
+                switch(arguments_.GetCase()) {
+                    case Utility::Arguments::Case::LOWERCASE: characterCase = BinaryText::Base16::Case::LOWERCASE; break;
+                    case Utility::Arguments::Case::MIXED: characterCase = BinaryText::Base16::Case::MIXED; break;
+                    case Utility::Arguments::Case::UPPERCASE: characterCase = BinaryText::Base16::Case::UPPERCASE; break;
+                    default: Utility::UnreachableTerminate();
+                }
+
+                if(isEncoding) {
+                    output_.resize(BinaryText::Base16::EncodedSize(input_.size()));
+                    output_.resize(BinaryText::Base16::Encode(bytes, output_, errorCode_, characterCase));
+                } else {
+                    output_.resize(BinaryText::Base16::MaximumDecodedSize(input_.size()));
+                    output_.resize(BinaryText::Base16::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_, characterCase));
+                }
+
+                break;
+            }
+            case Algorithm::BASE_32: {
+                if(isEncoding) {
+                    const bool withPadding(arguments_.GetPadding() == Utility::Arguments::Padding::ENABLE_PADDING);
+
+                    output_.resize(BinaryText::Base32::EncodedSize(input_.size(), withPadding));
+                    output_.resize(BinaryText::Base32::Encode(bytes, output_, errorCode_, withPadding));
+                } else {
+                    output_.resize(BinaryText::Base32::MaximumDecodedSize(input_.size()));
+                    output_.resize(BinaryText::Base32::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_));
+                }
+
+                break;
+            }
+            case Algorithm::BASE_32_HEX: {
+                if(isEncoding) {
+                    const bool withPadding(arguments_.GetPadding() == Utility::Arguments::Padding::ENABLE_PADDING);
+
+                    output_.resize(BinaryText::Base32Hex::EncodedSize(input_.size(), withPadding));
+                    output_.resize(BinaryText::Base32Hex::Encode(bytes, output_, errorCode_, withPadding));
+                } else {
+                    output_.resize(BinaryText::Base32Hex::MaximumDecodedSize(input_.size()));
+                    output_.resize(BinaryText::Base32Hex::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_));
+                }
+
+                break;
+            }
+            case Algorithm::BASE_64: {
+                if(isEncoding) {
+                    const bool withPadding(arguments_.GetPadding() == Utility::Arguments::Padding::ENABLE_PADDING);
+
+                    output_.resize(BinaryText::Base64::EncodedSize(input_.size(), withPadding));
+                    output_.resize(BinaryText::Base64::Encode(bytes, output_, errorCode_, withPadding));
+                } else {
+                    output_.resize(BinaryText::Base64::MaximumDecodedSize(input_.size()));
+                    output_.resize(BinaryText::Base64::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_));
+                }
+
+                break;
+            }
+            case Algorithm::BASE_64_URL: {
+                if(isEncoding) {
+                    const bool withPadding(arguments_.GetPadding() == Utility::Arguments::Padding::ENABLE_PADDING);
+
+                    output_.resize(BinaryText::Base64Url::EncodedSize(input_.size(), withPadding));
+                    output_.resize(BinaryText::Base64Url::Encode(bytes, output_, errorCode_, withPadding));
+                } else {
+                    output_.resize(BinaryText::Base64Url::MaximumDecodedSize(input_.size()));
+                    output_.resize(BinaryText::Base64Url::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_));
+                }
+
+                break;
+            }
+            case Algorithm::ASCII_85: {
+                const bool foldSpaces(arguments_.GetSpaceFolding() == Utility::Arguments::SpaceFolding::ENABLE_SPACE_FOLDING);
+                const bool adobeMode(arguments_.GetAdobeMode() == Utility::Arguments::AdobeMode::ENABLE_ADOBE_MODE);
+
+                if(isEncoding) {
+                    output_.resize(BinaryText::Ascii85::MaximumEncodedSize(input_.size(), adobeMode));
+                    output_.resize(BinaryText::Ascii85::Encode(bytes, output_, errorCode_, foldSpaces, adobeMode));
+                } else {
+                    output_.resize(BinaryText::Ascii85::MaximumDecodedSize(input_));
+                    output_.resize(BinaryText::Ascii85::Decode(input_, std::as_writable_bytes(std::span(output_)), errorCode_, foldSpaces, adobeMode));
+                }
+
+                break;
+            }
+            default: Utility::UnreachableTerminate();
+        }
+    }
+
+    /**
+     * @brief Processes a line of a batch file. The input file is read into the buffer of the worker and the result is written into the output file.
+     * @param[in] arguments_ Parsed command-line arguments.
+     * @param[in] line_ Line with an input and an output file separated by a tab.
+     * @param[in,out] worker_ Worker that processes the line.
+    */
+    void ProcessFile(const Utility::Arguments& arguments_, const std::string_view line_, Worker& worker_)
+    {
+        const std::size_t separator(line_.find('\t'));
+        const std::string_view inputFile(line_.substr(0, separator));
+        const auto fail([&worker_, inputFile](const std::string_view reason_) {
+            worker_.report += std::format("FAILED \"{}\": {}\n", inputFile, reason_);
+            worker_.statistics.failureCount += 1;
+        });
+
+        worker_.statistics.entryCount += 1;
+
+        if(separator == std::string_view::npos) {
+            return fail("No tab between input and output file");
+        }
+
+        const std::string_view outputFile(line_.substr(separator + 1));
+        std::error_code errorCode;
+
+        {
+            std::ifstream fileStream(std::filesystem::path(inputFile), std::ifstream::in | std::ifstream::binary);
+            const std::uintmax_t fileSize(std::filesystem::file_size(std::filesystem::path(inputFile), errorCode));
+
+            if(not fileStream.is_open() or errorCode) {
+                return fail("Failed to open input file");
+            }
+
+            BinaryText::Statistics::StageTimer timer(BinaryText::Statistics::Stage::READ, static_cast<std::size_t>(fileSize));
+
+            worker_.input.resize(static_cast<std::size_t>(fileSize));
+            fileStream.read(worker_.input.data(), static_cast<std::streamsize>(worker_.input.size()));
+
+            if(fileStream.fail()) {
+                return fail("Failed to read from input file");
+            }
+        }
+
+        Convert(arguments_, worker_.input, worker_.output, errorCode);
+
+        if(errorCode) {
+            return fail(errorCode.message());
+        }
+
+        std::ofstream fileStream(std::filesystem::path(outputFile), std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+        if(not fileStream.is_open()) {
+            return fail("Failed to open output file");
+        }
+
+        {
+            BinaryText::Statistics::StageTimer timer(BinaryText::Statistics::Stage::WRITE, worker_.output.size());
+
+            fileStream.write(worker_.output.data(), static_cast<std::streamsize>(worker_.output.size()));
+            fileStream.flush();
+        }
+
+        if(fileStream.fail()) {
+            return fail("Failed to write to output file");
+        }
+
+        worker_.report += std::format("OK \"{}\" -> \"{}\" ({} -> {} bytes)\n", inputFile, outputFile, worker_.input.size(), worker_.output.size());
+        worker_.statistics.inputSize += worker_.input.size();
+        worker_.statistics.outputSize += worker_.output.size();
+    }
+
+    /**
+     * Processes a record. The result is added to the report of the worker as a line. Decoded records can have any byte, so with `--decode-text`
+     * a backslash, a carriage return and a line feed are written as \\, \r and \n, and a record that failed is written as \! instead of an empty
+     * line, which is an empty record. Encoded records never fail and never have a line break.
+     *
+     * @param[in] arguments_ Parsed command-line arguments.
+     * @param[in] record_ Record to be encoded or decoded.
+     * @param[in] recordNumber_ Position of the record in stdin, starting at 1.
+     * @param[in,out] worker_ Worker that processes the record.
+    */
+    void ProcessRecord(const Utility::Arguments& arguments_, const std::string_view record_, const std::size_t recordNumber_, Worker& worker_)
+    {
+        const bool isDecoding(arguments_.GetTask() == Utility::Arguments::Task::DECODE_TEXT);
+        std::error_code errorCode;
+
+        Convert(arguments_, record_, worker_.output, errorCode);
+        worker_.statistics.entryCount += 1;
+
+        if(errorCode) {
+            worker_.errorReport += std::format("FAILED record {}: {}\n", recordNumber_, errorCode.message());
+            worker_.statistics.failureCount += 1;
+
+            if(isDecoding) {
+                worker_.report += "\\!";
+            }
+        } else {
+            if(isDecoding) {
+                for(const char character : worker_.output) {
+                    switch(character) {
+                        case '\\': worker_.report += "\\\\"; break;
+                        case '\r': worker_.report += "\\r"; break;
+                        case '\n': worker_.report += "\\n"; break;
+                        default: worker_.report += character;
+                    }
+                }
+            } else {
+                worker_.report += worker_.output;
+            }
+
+            worker_.statistics.inputSize += record_.size();
+            worker_.statistics.outputSize += worker_.output.size();
+        }
+
+        worker_.report += '\n';
+    }
+
+    bool Run(const Utility::Arguments& arguments_)
+    {
+        const bool isRecords(arguments_.IsBatchRecords());
+        const std::size_t threadCount(arguments_.GetThreadCount());
+        const std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+        std::vector<Worker> workers((threadCount != 0) ? threadCount : std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+        std::vector<std::string> lines;
+        std::size_t lineCount(0);
+        std::size_t firstRecordNumber(1);
+        std::string partialLine;
+        Utility::StreamOutput output(std::filesystem::path("-"));
+
+        // The lines of a round are split into one contiguous part per worker, so that the reports can be written in the order of the input
+        Pool pool(workers.size(), [&](const std::size_t workerIndex_) {
+            const std::size_t end((lineCount * (workerIndex_ + 1)) / workers.size());
+
+            for(std::size_t i((lineCount * workerIndex_) / workers.size()); i < end; ++i) {
+                if(isRecords) {
+                    ProcessRecord(arguments_, lines[i], firstRecordNumber + i, workers[workerIndex_]);
+                } else {
+                    ProcessFile(arguments_, lines[i], workers[workerIndex_]);
+                }
+            }
+        });
+        const auto processRound([&]() {
+            pool.RunRound();
+
+            for(Worker& worker : workers) {
+                output.Write(worker.report);
+                std::cerr << worker.errorReport;
+                worker.report.clear();
+                worker.errorReport.clear();
+            }
+
+            firstRecordNumber += lineCount;
+            lineCount = 0;
+        });
+        const auto addLine([&](std::string_view line_) {
+            if(line_.ends_with('\r')) {
+                line_.remove_suffix(1);
+            }
+
+            if(line_.empty() and not isRecords) {
+                return;
+            } else if(lineCount == lines.size()) {
+                lines.emplace_back();
+            }
+
+            lines[lineCount++].assign(line_);
+
+            if(lineCount == roundSize) {
+                processRound();
+            }
+        });
+
+        Utility::ReadFileInBlocks(isRecords ? std::filesystem::path("-") : arguments_.GetBatchFilePath(), arguments_.GetBlockSize(),
+                                  [&partialLine, &addLine](std::string_view block_) {
+                                      for(std::size_t position(block_.find('\n')); position != std::string_view::npos; position = block_.find('\n')) {
+                                          if(partialLine.empty()) {
+                                              addLine(block_.substr(0, position));
+                                          } else {
+                                              partialLine.append(block_.substr(0, position));
+                                              addLine(partialLine);
+                                              partialLine.clear();
+                                          }
+
+                                          block_.remove_prefix(position + 1);
+                                      }
+
+                                      partialLine.append(block_);
+                                  });
+
+        if(not partialLine.empty()) {
+            addLine(partialLine);
+        }
+
+        if(lineCount != 0) {
+            processRound();
+        }
+
+        output.Finish();
+
+        Statistics statistics;
+
+        for(const Worker& worker : workers) {
+            statistics.entryCount += worker.statistics.entryCount;
+            statistics.failureCount += worker.statistics.failureCount;
+            statistics.inputSize += worker.statistics.inputSize;
+            statistics.outputSize += worker.statistics.outputSize;
+        }
+
+        const double seconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        const double throughput((seconds > 0.0) ? (static_cast<double>(statistics.inputSize) / 1000000.0) / seconds : 0.0);
+
+        (isRecords ? std::cerr : std::cout) << std::format("Processed {} entries ({} failed), {} bytes into {} bytes in {:.3f} seconds ({:.1f} MB/s)",
+                                                           statistics.entryCount, statistics.failureCount, statistics.inputSize, statistics.outputSize,
+                                                           seconds, throughput)
+                                            << std::endl;
+
+        return statistics.failureCount == 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+
+#pragma once
+
+#include "Utility.hpp"
+
+/// @brief A namespace that has the batch mode of the test program, which processes many inputs in one invocation.
+namespace Batch
+{
+    /**
+     * Processes every entry of the batch on a pool of worker threads (`--threads=OPTION`). With `--batch-file=OPTION` every line names an input and an
+     * output file separated by a tab and a status line is printed for every file. With `--batch-records` every line of stdin is encoded or decoded
+     * on its own and the results are written to stdout in the same order, one line per record (decoded records are escaped, see ProcessRecord in
+     * Batch.cpp, and `--decode-binary` is rejected). The aggregate throughput is printed at the end.
+     *
+     * @param[in] arguments_ Parsed command-line arguments, Arguments::IsBatch has to be true.
+     * @returns Whether or not every entry succeeded.
+     * @throws Utility::Error
+    */
+    bool Run(const Utility::Arguments& arguments_);
+}
\ No newline at end of file
@@ -0,0 +1,393 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "BinaryText.hpp"
+#include "Utility.hpp"
+
+/// @brief A namespace that has the pieces of the benchmark program.
+namespace Benchmark
+{
+    /// @brief Settings of a benchmark run, taken from the command-line arguments.
+    struct Settings
+    {
+        std::size_t minimumSize = 16;                   ///< Smallest input size in bytes (`--minimum-size=OPTION`).
+        std::size_t maximumSize = std::size_t(1) << 30; ///< Largest input size in bytes (`--maximum-size=OPTION`).
+        double minimumTime = 0.1;                       ///< Least amount of seconds each benchmark runs for (`--minimum-time=OPTION`).
+        std::size_t threadCount = 1;                    ///< Amount of threads passed to the codec functions (`--threads=OPTION`).
+        std::string filter;                             ///< Only benchmarks whose name contains this are run (`--filter=OPTION`).
+        std::string outputFilePath;                     ///< Where the JSON results are written to, stdout if empty (`--output-file=OPTION`).
+    };
+
+    /// @brief Measurement of a single benchmark.
+    struct Result
+    {
+        std::string name;       ///< Unique name (algorithm/operation/api/options/size).
+        std::string algorithm;  ///< Algorithm that was measured.
+        std::string operation;  ///< Either encode, decode or iterate.
+        std::string api;        ///< Either String, ByteBuffer or Pointer.
+        std::string options;    ///< Options passed to the function.
+        std::size_t size;       ///< Amount of not-encoded bytes that were processed per iteration.
+        std::size_t iterations; ///< Amount of iterations that were measured.
+        double seconds;         ///< Time all iterations took.
+    };
+
+    /// @brief One function of a codec with fixed options.
+    struct Case
+    {
+        std::string algorithm;                                                                 ///< Algorithm to be measured.
+        std::string options;                                                                   ///< Options passed to the function.
+        std::function<std::string(std::string_view)> encodeString;                             ///< Encodes a string, empty for decoding only cases.
+        std::function<std::string(const BinaryText::ByteBuffer<std::byte>&)> encodeByteBuffer; ///< Encodes a ByteBuffer, empty for decoding only cases.
+        std::function<std::size_t(std::string_view)> decodeString;                             ///< Decodes into a string and returns its size.
+        std::function<std::size_t(std::string_view)> decodeByteBuffer;                         ///< Decodes into a ByteBuffer and returns its size.
+    };
+
+    /**
+     * @brief Parses an unsigned integer or a floating point number out of a command-line argument.
+     * @param[in] option_ Text after the = of the argument.
+     * @param[out] value_ Parsed value.
+     * @throws Utility::Error
+    */
+    template<typename ValueType>
+    void ParseOption(const std::string_view option_, ValueType& value_)
+    {
+        const std::from_chars_result result(std::from_chars(option_.data(), option_.data() + option_.size(), value_));
+
+        if(option_.empty() or result.ec != std::errc() or result.ptr != option_.data() + option_.size()) {
+            throw Utility::Error(std::format("Invalid option: \"{}\"", option_));
+        }
+    }
+
+    /**
+     * @brief Parses the command-line arguments passed to the benchmark program.
+     * @param[in] argumentVector_ Vector of command-line arguments.
+     * @returns Settings of the run.
+     * @throws Utility::Error
+    */
+    Settings ParseArguments(const std::vector<std::string_view>& argumentVector_)
+    {
+        Settings settings;
+
+        for(std::size_t i(1); i < argumentVector_.size(); ++i) {
+            const std::string_view argument(argumentVector_[i]);
+            const std::string_view option(argument.substr(std::min(argument.find('=') + 1, argument.size())));
+
+            if(argument == "-h" or argument == "--help") {
+                Utility::Exit("binarytext-bench [ARGUMENTS]\n\n"
+                              "Measures encoding and decoding of every algorithm and writes the results as JSON.\n"
+                              "The following are the only command-line arguments that can be passed to this application:\n"
+                              "  -h / --help\n"
+                              "  --minimum-size=OPTION (smallest input size in bytes, the default is 16)\n"
+                              "  --maximum-size=OPTION (largest input size in bytes, the default is 1073741824)\n"
+                              "  --minimum-time=OPTION (least amount of seconds each benchmark runs for, the default is 0.1)\n"
+                              "  --threads=OPTION (amount of threads for large inputs, 0 for one per hardware thread, the default is 1)\n"
+                              "  --filter=OPTION (only run benchmarks whose name contains OPTION)\n"
+                              "  --output-file=OPTION (the default is stdout)",
+                              0);
+            } else if(argument.starts_with("--minimum-size=")) {
+                ParseOption(option, settings.minimumSize);
+            } else if(argument.starts_with("--maximum-size=")) {
+                ParseOption(option, settings.maximumSize);
+            } else if(argument.starts_with("--minimum-time=")) {
+                ParseOption(option, settings.minimumTime);
+            } else if(argument.starts_with("--threads=")) {
+                ParseOption(option, settings.threadCount);
+            } else if(argument.starts_with("--filter=")) {
+                settings.filter = option;
+            } else if(argument.starts_with("--output-file=")) {
+                settings.outputFilePath = option;
+            } else {
+                throw Utility::Error(std::format("Invalid argument: \"{}\"", argument));
+            }
+        }
+
+        if(settings.minimumSize == 0 or settings.minimumSize > settings.maximumSize) {
+            throw Utility::Error("Invalid size range");
+        }
+
+        return settings;
+    }
+
+    /**
+     * @brief Creates the cases of every algorithm: each Base16 case, padding on and off, and every combination of space folding and adobe mode.
+     * @param[in] threadCount_ Amount of threads passed to the codec functions.
+     * @returns Cases to be measured.
+    */
+    std::vector<Case> MakeCases(const std::size_t threadCount_)
+    {
+        using BinaryText::ByteBuffer;
+
+        std::vector<Case> cases;
+        const std::size_t t(threadCount_);
+
+        for(const BinaryText::Base16::Case base16Case : {BinaryText::Base16::Case::UPPERCASE, BinaryText::Base16::Case::LOWERCASE}) {
+            const bool isUppercase(base16Case == BinaryText::Base16::Case::UPPERCASE);
+
+            cases.push_back(Case{"base16", isUppercase ? "uppercase" : "lowercase",
+                                 [=](const std::string_view string_) { return BinaryText::Base16::EncodeStringToString(string_, base16Case, t); },
+                                 [=](const ByteBuffer<std::byte>& byteBuffer_) {
+                                     return BinaryText::Base16::EncodeByteBufferToString(byteBuffer_, base16Case, t);
+                                 },
+                                 [=](const std::string_view string_) { return BinaryText::Base16::DecodeStringToString(string_, base16Case, t).size(); },
+                                 [=](const std::string_view string_) {
+                                     return BinaryText::Base16::DecodeStringToByteBuffer<std::byte>(string_, base16Case, t).GetSize();
+                                 }});
+        }
+
+        // Mixed case is decoding only, its input is uppercase
+        cases.push_back(Case{"base16", "mixed", nullptr, nullptr,
+                             [=](const std::string_view string_) {
+                                 return BinaryText::Base16::DecodeStringToString(string_, BinaryText::Base16::Case::MIXED, t).size();
+                             },
+                             [=](const std::string_view string_) {
+                                 return BinaryText::Base16::DecodeStringToByteBuffer<std::byte>(string_, BinaryText::Base16::Case::MIXED, t).GetSize();
+                             }});
+
+        auto addPaddedCases = [&cases, t]<typename Encode, typename EncodeByteBuffer, typename Decode, typename DecodeByteBuffer>(
+                                  const std::string& algorithm_, Encode encode_, EncodeByteBuffer encodeByteBuffer_, Decode decode_,
+                                  DecodeByteBuffer decodeByteBuffer_) -> void {
+            for(const bool withPadding : {true, false}) {
+                cases.push_back(Case{algorithm_, withPadding ? "padding" : "no-padding",
+                                     [=](const std::string_view string_) { return encode_(string_, withPadding, t); },
+                                     [=](const ByteBuffer<std::byte>& byteBuffer_) { return encodeByteBuffer_(byteBuffer_, withPadding, t); },
+                                     [=](const std::string_view string_) { return decode_(string_, t).size(); },
+                                     [=](const std::string_view string_) { return decodeByteBuffer_(string_, t).GetSize(); }});
+            }
+        };
+
+        addPaddedCases(
+            "base32", [](const std::string_view s_, const bool p_, const std::size_t t_) { return BinaryText::Base32::EncodeStringToString(s_, p_, t_); },
+            [](const ByteBuffer<std::byte>& b_, const bool p_, const std::size_t t_) { return BinaryText::Base32::EncodeByteBufferToString(b_, p_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base32::DecodeStringToString(s_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base32::DecodeStringToByteBuffer<std::byte>(s_, t_); });
+        addPaddedCases(
+            "base32hex", [](const std::string_view s_, const bool p_, const std::size_t t_) { return BinaryText::Base32Hex::EncodeStringToString(s_, p_, t_); },
+            [](const ByteBuffer<std::byte>& b_, const bool p_, const std::size_t t_) { return BinaryText::Base32Hex::EncodeByteBufferToString(b_, p_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base32Hex::DecodeStringToString(s_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base32Hex::DecodeStringToByteBuffer<std::byte>(s_, t_); });
+        addPaddedCases(
+            "base64", [](const std::string_view s_, const bool p_, const std::size_t t_) { return BinaryText::Base64::EncodeStringToString(s_, p_, t_); },
+            [](const ByteBuffer<std::byte>& b_, const bool p_, const std::size_t t_) { return BinaryText::Base64::EncodeByteBufferToString(b_, p_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base64::DecodeStringToString(s_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base64::DecodeStringToByteBuffer<std::byte>(s_, t_); });
+        addPaddedCases(
+            "base64url", [](const std::string_view s_, const bool p_, const std::size_t t_) { return BinaryText::Base64Url::EncodeStringToString(s_, p_, t_); },
+            [](const ByteBuffer<std::byte>& b_, const bool p_, const std::size_t t_) { return BinaryText::Base64Url::EncodeByteBufferToString(b_, p_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base64Url::DecodeStringToString(s_, t_); },
+            [](const std::string_view s_, const std::size_t t_) { return BinaryText::Base64Url::DecodeStringToByteBuffer<std::byte>(s_, t_); });
+
+        for(const bool foldSpaces : {false, true}) {
+            for(const bool adobeMode : {false, true}) {
+                cases.push_back(Case{"ascii85", std::format("{}{}", foldSpaces ? "fold-spaces" : "no-fold-spaces", adobeMode ? "+adobe-mode" : ""),
+                                     [=](const std::string_view string_) {
+                                         return BinaryText::Ascii85::EncodeStringToString(string_, foldSpaces, adobeMode, t);
+                                     },
+                                     [=](const ByteBuffer<std::byte>& byteBuffer_) {
+                                         return BinaryText::Ascii85::EncodeByteBufferToString(byteBuffer_, foldSpaces, adobeMode, t);
+                                     },
+                                     [=](const std::string_view string_) {
+                                         return BinaryText::Ascii85::DecodeStringToString(string_, foldSpaces, adobeMode, t).size();
+                                     },
+                                     [=](const std::string_view string_) {
+                                         return BinaryText::Ascii85::DecodeStringToByteBuffer<std::byte>(string_, foldSpaces, adobeMode, t).GetSize();
+                                     }});
+            }
+        }
+
+        return cases;
+    }
+
+    /**
+     * Runs a function repeatedly until it took at least the minimum time and measures it. The amount of iterations is grown from 1, so small inputs get
+     * many iterations and the largest ones only a few.
+     *
+     * @param[in] minimumTime_ Least amount of seconds to be measured.
+     * @param[in] function_ Function to be measured, it returns a value that is kept so that the call cannot be optimized away.
+     * @returns Amount of iterations and seconds they took.
+    */
+    template<typename Function>
+    std::pair<std::size_t, double> Measure(const double minimumTime_, const Function& function_)
+    {
+        static volatile std::size_t sink(0);
+        std::size_t iterations(1);
+
+        while(true) {
+            const std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+
+            for(std::size_t i(0); i < iterations; ++i) {
+                sink = sink + function_();
+            }
+
+            const double seconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+            if(seconds >= minimumTime_) {
+                return {iterations, seconds};
+            }
+
+            // Aim a bit past the minimum time, but never grow by more than 10 times at once
+            const double factor((seconds > 0.0) ? (minimumTime_ * 1.4) / seconds : 10.0);
+
+            iterations = std::max(iterations + 1, static_cast<std::size_t>(static_cast<double>(iterations) * std::min(factor, 10.0)));
+        }
+    }
+
+    /**
+     * @brief Writes the results as JSON.
+     * @param[out] stream_ Where the JSON is written to.
+     * @param[in] settings_ Settings of the run.
+     * @param[in] results_ Measured results.
+    */
+    void WriteJson(std::ostream& stream_, const Settings& settings_, const std::vector<Result>& results_)
+    {
+        stream_ << "{\n";
+        stream_ << std::format("  \"context\": {{\"minimum_time\": {}, \"threads\": {}, \"size_unit\": \"not-encoded bytes\"}},\n", settings_.minimumTime,
+                               settings_.threadCount);
+        stream_ << "  \"benchmarks\": [\n";
+
+        for(std::size_t i(0); i < results_.size(); ++i) {
+            const Result& result(results_[i]);
+            const double totalBytes(static_cast<double>(result.size) * static_cast<double>(result.iterations));
+
+            stream_ << std::format("    {{\"name\": \"{}\", \"algorithm\": \"{}\", \"operation\": \"{}\", \"api\": \"{}\", \"options\": \"{}\", \"size\": {}, "
+                                   "\"iterations\": {}, \"seconds\": {:.9f}, \"ns_per_byte\": {:.6f}, \"mb_per_s\": {:.3f}}}{}\n",
+                                   result.name, result.algorithm, result.operation, result.api, result.options, result.size, result.iterations,
+                                   result.seconds, (result.seconds * 1e9) / totalBytes, totalBytes / (result.seconds * 1e6),
+                                   (i + 1 < results_.size()) ? "," : "");
+        }
+
+        stream_ << "  ]\n}" << std::endl;
+    }
+}
+
+int main(int argumentCount_, char** argumentArray_)
+{
+    try {
+        const Benchmark::Settings settings(Benchmark::ParseArguments(std::vector<std::string_view>(argumentArray_, argumentArray_ + argumentCount_)));
+        const std::vector<Benchmark::Case> cases(Benchmark::MakeCases(settings.threadCount));
+        std::vector<Benchmark::Result> results;
+        std::string input(settings.maximumSize, '\0');
+        std::mt19937_64 generator(0x42696E61727954ULL);
+
+        for(char& character : input) {
+            character = static_cast<char>(generator());
+        }
+
+        // Sizes grow by 4 times, from 16 B up to 1 GiB with the default settings
+        for(std::size_t size(settings.minimumSize); size <= settings.maximumSize; size *= 4) {
+            const std::string_view string(input.data(), size);
+            BinaryText::ByteBuffer<std::byte> byteBuffer(size);
+
+            std::memcpy(byteBuffer.GetBuffer(), string.data(), size);
+
+            auto run = [&](const std::string& algorithm_, const std::string& operation_, const std::string& api_, const std::string& options_,
+                           const auto& function_) -> void {
+                const std::string name(std::format("{}/{}/{}/{}/{}", algorithm_, operation_, api_, options_, size));
+
+                if(name.find(settings.filter) == std::string::npos) {
+                    return;
+                }
+
+                const std::pair<std::size_t, double> measurement(Benchmark::Measure(settings.minimumTime, function_));
+
+                results.push_back(Benchmark::Result{name, algorithm_, operation_, api_, options_, size, measurement.first, measurement.second});
+                std::cerr << std::format("{} {:.1f} MB/s", name,
+                                         (static_cast<double>(size) * static_cast<double>(measurement.first)) / (measurement.second * 1e6))
+                          << std::endl;
+            };
+
+            for(const Benchmark::Case& testCase : cases) {
+                // Decoding input comes from the encoder with the same options, mixed case Base16 decodes uppercase input
+                const std::string encodedString((testCase.encodeString != nullptr) ? testCase.encodeString(string)
+                                                                                   : BinaryText::Base16::EncodeStringToString(string));
+
+                if(testCase.encodeString != nullptr) {
+                    run(testCase.algorithm, "encode", "String", testCase.options, [&]() { return testCase.encodeString(string).size(); });
+                    run(testCase.algorithm, "encode", "ByteBuffer", testCase.options, [&]() { return testCase.encodeByteBuffer(byteBuffer).size(); });
+                }
+
+                run(testCase.algorithm, "decode", "String", testCase.options, [&]() { return testCase.decodeString(encodedString); });
+                run(testCase.algorithm, "decode", "ByteBuffer", testCase.options, [&]() { return testCase.decodeByteBuffer(encodedString); });
+            }
+
+            // Walking a ByteBuffer through its iterators should be as fast as walking the same bytes through a pointer
+            run("bytebuffer", "iterate", "Pointer", "sum", [&]() {
+                std::size_t sum(0);
+
+                for(const char* character(string.data()); character != string.data() + string.size(); ++character) {
+                    sum += static_cast<unsigned char>(*character);
+                }
+
+                return sum;
+            });
+            run("bytebuffer", "iterate", "ByteBuffer", "sum", [&]() {
+                std::size_t sum(0);
+
+                for(const std::byte byte : byteBuffer) {
+                    sum += std::to_integer<std::size_t>(byte);
+                }
+
+                return sum;
+            });
+
+            if(size > settings.maximumSize / 4) {
+                break;
+            }
+        }
+
+        if(settings.outputFilePath.empty()) {
+            Benchmark::WriteJson(std::cout, settings, results);
+        } else {
+            std::ofstream fileStream(settings.outputFilePath, std::ofstream::out | std::ofstream::trunc);
+
+            if(not fileStream.is_open()) {
+                throw Utility::Error("Failed to open file");
+            }
+
+            Benchmark::WriteJson(fileStream, settings, results);
+        }
+    } catch(const Utility::Error& error) {
+        Utility::Exit(error.What(), -1);
+    } catch(const std::exception& error) {
+        Utility::Exit(error.what(), -1);
+    }
+
+    return 0;
+}
@@ -27,29 +27,76 @@ For more information, please refer to <https://unlicense.org>
 
 #pragma once
 
-#include <algorithm>       // std::fill / std::copy
+#include <algorithm>       // std::fill / std::copy / std::copy_n / std::count_if / std::min / std::max / std::equal
 #include <array>           // std::array
-#include <bitset>          // std::bitset
-#include <cmath>           // std::ceil / std::floor
-#include <compare>         // std::strong_ordering
-#include <concepts>        // std::same_as
+#include <atomic>          // std::atomic
+#include <chrono>          // std::chrono::steady_clock / std::chrono::nanoseconds
+#include <compare>         // std::strong_ordering / std::compare_three_way
+#include <concepts>        // std::same_as / std::unsigned_integral
 #include <cstddef>         // std::size_t / std::ptrdiff_t
+#include <cstdint>         // std::uint8_t / std::uint32_t / std::uint64_t / std::uintmax_t
+#include <cstring>         // std::memcpy / std::memset
 #include <exception>       // std::terminate / std::exception
-#include <filesystem>      // std::filesystem::path
+#include <filesystem>      // std::filesystem::path / std::filesystem::file_size
 #include <format>          // std::format
 #include <fstream>         // std::ifstream / std::ofstream
 #include <iostream>        // std::cerr / std::endl
 #include <iterator>        // std::contiguous_iterator_tag / std::contiguous_iterator / std::next / std::advance / std::prev / std::distance
 #include <limits>          // std::numeric_limits
-#include <memory>          // std::unique_ptr / std::make_unique
+#include <memory>          // std::unique_ptr
+#include <memory_resource> // std::pmr::memory_resource / std::pmr::get_default_resource / std::pmr::polymorphic_allocator
 #include <new>             // std::bad_alloc
 #include <source_location> // std::source_location
-#include <stdexcept>       // std::length_error
+#include <span>            // std::span
+#include <stdexcept>       // std::length_error / std::invalid_argument
 #include <string>          // std::string
-#include <type_traits>     // std::remove_const_t / std::add_const_t / std::is_same_v
+#include <string_view>     // std::string_view
+#include <system_error>    // std::error_code / std::error_category
+#include <thread>          // std::thread
+#include <type_traits>     // std::remove_const_t / std::add_const_t / std::is_same_v / std::is_integral_v / std::is_trivially_copyable_v
 #include <utility>         // std::swap / std::move
 #include <vector>          // std::vector
 
+#if !defined(BINARYTEXT_DISABLE_SIMD)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BINARYTEXT_X86_SIMD
+#include <immintrin.h> // SSE4.1 / AVX2 intrinsics
+#if defined(_MSC_VER)
+#include <intrin.h> // __cpuid / __cpuidex / _xgetbv
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define BINARYTEXT_NEON_SIMD
+#include <arm_neon.h> // NEON intrinsics
+#endif
+#endif
+
+#if defined(_WIN32)
+#define BINARYTEXT_WINDOWS_FILE_MAPPING
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h> // CreateFileW / CreateFileMappingW / MapViewOfFile / UnmapViewOfFile
+#elif defined(__unix__) || defined(__APPLE__)
+#define BINARYTEXT_POSIX_FILE_MAPPING
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap / munmap / madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BINARYTEXT_TARGET(target_) __attribute__((target(target_)))
+#else
+#define BINARYTEXT_TARGET(target_)
+#endif
+
+#if !defined(NDEBUG) && !defined(BINARYTEXT_CHECKED_ITERATORS)
+#define BINARYTEXT_CHECKED_ITERATORS
+#endif
+
 /// @brief BinaryText namespace.
 namespace BinaryText
 {
@@ -62,7 +109,7 @@ namespace BinaryText
          * 
          * @param[in] sourceLocation_ The location at which this function was called from, the default argument should be used.
         */
-        [[noreturn]] void UnreachableTerminate(const std::source_location sourceLocation_ = std::source_location::current()) noexcept
+        [[noreturn]] inline void UnreachableTerminate(const std::source_location sourceLocation_ = std::source_location::current()) noexcept
         {
             std::cerr << std::format(
                 "Something that should not have gone wrong went wrong and this function was called to terminate the program. This function "
@@ -74,6 +121,350 @@ namespace BinaryText
 
         /// @brief How many bits there are in a char on this platform.
         constexpr int charSize = std::numeric_limits<unsigned char>::digits;
+
+        /// @brief Instruction set extensions that the vectorized functions can make use of.
+        enum class InstructionSet
+        {
+            NONE,   ///< Portable scalar code only.
+            SSE4_1, ///< x86 SSE4.1.
+            AVX2,   ///< x86 AVX2.
+            NEON    ///< ARM NEON (always available on AArch64).
+        };
+
+        /**
+         * @brief Detects the best instruction set extension supported by the processor and operating system.
+         * @returns Best supported InstructionSet.
+        */
+        inline InstructionSet DetectInstructionSet() noexcept
+        {
+#if defined(BINARYTEXT_X86_SIMD)
+#if defined(_MSC_VER) && !defined(__clang__)
+            int information[4] = {0, 0, 0, 0};
+
+            __cpuid(information, 0);
+
+            const int highestFunction(information[0]);
+
+            __cpuid(information, 1);
+
+            const bool hasSse41((information[2] & (1 << 19)) != 0);
+            const bool hasAvx((information[2] & (1 << 28)) != 0 and (information[2] & (1 << 27)) != 0 and (_xgetbv(0) & 0x06) == 0x06);
+            bool hasAvx2(false);
+
+            if(highestFunction >= 7) {
+                __cpuidex(information, 7, 0);
+
+                hasAvx2 = hasAvx and (information[1] & (1 << 5)) != 0;
+            }
+#else
+            __builtin_cpu_init();
+
+            const bool hasSse41(__builtin_cpu_supports("sse4.1"));
+            const bool hasAvx2(__builtin_cpu_supports("avx2"));
+#endif
+
+            if(hasAvx2) {
+                return InstructionSet::AVX2;
+            } else if(hasSse41) {
+                return InstructionSet::SSE4_1;
+            } else {
+                return InstructionSet::NONE;
+            }
+#elif defined(BINARYTEXT_NEON_SIMD)
+            return InstructionSet::NEON;
+#else
+            return InstructionSet::NONE;
+#endif
+        }
+
+        /**
+         * @brief Gets the instruction set extension used by the vectorized functions. It is detected once and cached afterwards.
+         * @returns InstructionSet in use.
+        */
+        inline InstructionSet GetInstructionSet() noexcept
+        {
+            static const InstructionSet instructionSet(DetectInstructionSet());
+
+            return instructionSet;
+        }
+
+        /**
+         * Gets the address an iterator of a ByteBuffer refers to. With BINARYTEXT_CHECKED_ITERATORS an iterator that holds nullptr refers to a byte of
+         * its thread that reads as zero, otherwise it is not checked at all.
+         *
+         * @tparam ValueType Byte type of the iterator, can be constant.
+         * @param[in] address_ Address held by the iterator.
+         * @param[in] position_ Position relative to the address.
+         * @returns Address of the byte.
+        */
+        template<typename ValueType>
+        ValueType* DereferenceableAddress(ValueType* address_, const std::ptrdiff_t position_) noexcept
+        {
+#if defined(BINARYTEXT_CHECKED_ITERATORS)
+            if(address_ == nullptr) {
+                thread_local std::remove_const_t<ValueType> failsafe;
+
+                failsafe = static_cast<std::remove_const_t<ValueType>>(0);
+
+                return &failsafe;
+            }
+#endif
+
+            return address_ + position_;
+        }
+        /**
+         * @brief Moves the address of an iterator of a ByteBuffer. With BINARYTEXT_CHECKED_ITERATORS nullptr stays nullptr.
+         * @tparam ValueType Byte type of the iterator, can be constant.
+         * @param[in] address_ Address held by the iterator.
+         * @param[in] difference_ Amount of bytes to move by.
+         * @returns Moved address.
+        */
+        template<typename ValueType>
+        ValueType* OffsetAddress(ValueType* address_, const std::ptrdiff_t difference_) noexcept
+        {
+#if defined(BINARYTEXT_CHECKED_ITERATORS)
+            if(address_ == nullptr) {
+                return nullptr;
+            }
+#endif
+
+            return address_ + difference_;
+        }
+        /**
+         * @brief Gets the distance between the addresses of two iterators of a ByteBuffer. With BINARYTEXT_CHECKED_ITERATORS it is 0 if either is nullptr.
+         * @tparam ValueType Byte type of the iterators, can be constant.
+         * @param[in] first_ Address held by the first iterator.
+         * @param[in] last_ Address held by the last iterator.
+         * @returns Amount of bytes from the first to the last address.
+        */
+        template<typename ValueType>
+        std::ptrdiff_t AddressDistance(ValueType* first_, ValueType* last_) noexcept
+        {
+#if defined(BINARYTEXT_CHECKED_ITERATORS)
+            if(first_ == nullptr or last_ == nullptr) {
+                return 0;
+            }
+#endif
+
+            return last_ - first_;
+        }
+    }
+
+    /**
+     * Counters of where the time and memory of BinaryText go, meant for sizing jobs. They are only compiled in if BINARYTEXT_ENABLE_STATISTICS is defined
+     * before this header is included, otherwise every function in here does nothing and is optimized away. The counters are shared by all threads.
+    */
+    namespace Statistics
+    {
+#if defined(BINARYTEXT_ENABLE_STATISTICS)
+        /// @brief Whether or not the counters are compiled in.
+        constexpr bool isEnabled = true;
+#else
+        /// @brief Whether or not the counters are compiled in.
+        constexpr bool isEnabled = false;
+#endif
+
+        /// @brief Part of the work that time and sizes are counted for.
+        enum class Stage
+        {
+            READ,   ///< Reading files, by ByteBuffer::ReadFromFile / ByteBuffer::MapFromFile or by the application through a StageTimer.
+            ENCODE, ///< Encoding bytes into characters.
+            DECODE, ///< Decoding characters into bytes.
+            WRITE   ///< Writing files, by ByteBuffer::WriteToFile or by the application through a StageTimer.
+        };
+
+        /// @brief Amount of values of Stage.
+        constexpr std::size_t stageCount = 4;
+
+        /// @brief Counters of a Stage.
+        struct StageSnapshot
+        {
+            std::uint64_t callCount;   ///< How many times the stage was entered.
+            std::uint64_t inputSize;   ///< Amount of bytes or characters that went in.
+            std::uint64_t outputSize;  ///< Amount of bytes or characters that came out.
+            std::uint64_t nanoseconds; ///< Time spent in the stage, summed up over all threads.
+        };
+
+        /// @brief Values of all counters at one point in time.
+        struct Snapshot
+        {
+            std::array<StageSnapshot, stageCount> stages; ///< Counters of every Stage, indexed by its value.
+            std::uint64_t allocationCount;                ///< Amount of buffers allocated by ByteBuffers.
+            std::uint64_t allocationSize;                 ///< Amount of bytes allocated by ByteBuffers.
+            std::uint64_t reallocationCount;              ///< Allocations that moved the bytes of a ByteBuffer, when growing it for example.
+        };
+    }
+
+    namespace Internal
+    {
+        /// @brief Counters behind a Statistics::StageSnapshot.
+        struct StageCounters
+        {
+            std::atomic<std::uint64_t> callCount;
+            std::atomic<std::uint64_t> inputSize;
+            std::atomic<std::uint64_t> outputSize;
+            std::atomic<std::uint64_t> nanoseconds;
+        };
+
+        /// @brief Counters behind the Statistics namespace.
+        struct StatisticsCounters
+        {
+            std::array<StageCounters, Statistics::stageCount> stages;
+            std::atomic<std::uint64_t> allocationCount;
+            std::atomic<std::uint64_t> allocationSize;
+            std::atomic<std::uint64_t> reallocationCount;
+        };
+
+        /**
+         * @brief Gets the counters shared by all threads.
+         * @returns Reference to the counters.
+        */
+        inline StatisticsCounters& GetStatisticsCounters() noexcept
+        {
+            static StatisticsCounters counters{};
+
+            return counters;
+        }
+    }
+
+    namespace Statistics
+    {
+        /**
+         * @brief Reads all counters. Counters that are updated at the same time by other threads can be slightly out of step with each other.
+         * @returns Values of the counters, all zero if they are not compiled in.
+        */
+        inline Snapshot GetSnapshot() noexcept
+        {
+            Snapshot snapshot{};
+
+            if constexpr(isEnabled) {
+                Internal::StatisticsCounters& counters(Internal::GetStatisticsCounters());
+
+                for(std::size_t i(0); i < stageCount; ++i) {
+                    const Internal::StageCounters& stage(counters.stages[i]);
+
+                    snapshot.stages[i] = StageSnapshot{stage.callCount.load(std::memory_order_relaxed), stage.inputSize.load(std::memory_order_relaxed),
+                                                       stage.outputSize.load(std::memory_order_relaxed), stage.nanoseconds.load(std::memory_order_relaxed)};
+                }
+
+                snapshot.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+                snapshot.allocationSize = counters.allocationSize.load(std::memory_order_relaxed);
+                snapshot.reallocationCount = counters.reallocationCount.load(std::memory_order_relaxed);
+            }
+
+            return snapshot;
+        }
+        /// @brief Sets all counters back to zero.
+        inline void Reset() noexcept
+        {
+            if constexpr(isEnabled) {
+                Internal::StatisticsCounters& counters(Internal::GetStatisticsCounters());
+
+                for(Internal::StageCounters& stage : counters.stages) {
+                    stage.callCount.store(0, std::memory_order_relaxed);
+                    stage.inputSize.store(0, std::memory_order_relaxed);
+                    stage.outputSize.store(0, std::memory_order_relaxed);
+                    stage.nanoseconds.store(0, std::memory_order_relaxed);
+                }
+
+                counters.allocationCount.store(0, std::memory_order_relaxed);
+                counters.allocationSize.store(0, std::memory_order_relaxed);
+                counters.reallocationCount.store(0, std::memory_order_relaxed);
+            }
+        }
+        /**
+         * @brief Counts a buffer allocated by a ByteBuffer.
+         * @param[in] size_ Size of the buffer in bytes.
+        */
+        inline void CountAllocation(const std::size_t size_) noexcept
+        {
+            if constexpr(isEnabled) {
+                Internal::GetStatisticsCounters().allocationCount.fetch_add(1, std::memory_order_relaxed);
+                Internal::GetStatisticsCounters().allocationSize.fetch_add(size_, std::memory_order_relaxed);
+            }
+        }
+        /// @brief Counts an allocation that moved the bytes of a ByteBuffer.
+        inline void CountReallocation() noexcept
+        {
+            if constexpr(isEnabled) {
+                Internal::GetStatisticsCounters().reallocationCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Measures the time from its creation to its destruction with a steady clock and adds it to the counters of a Stage, together with the sizes that
+         * went in and came out. Timers of different stages can be nested, the time of the inner one is then counted by both.
+        */
+        class StageTimer
+        {
+        public:
+            /**
+             * @brief Starts measuring.
+             * @param[in] stage_ Stage the time is counted for.
+             * @param[in] inputSize_ Amount of bytes or characters that go in.
+            */
+            explicit StageTimer(const Stage stage_, const std::size_t inputSize_ = 0) noexcept :
+                _stage(stage_),
+                _inputSize(inputSize_),
+                _outputSize(0),
+                _start()
+            {
+                if constexpr(isEnabled) {
+                    _start = std::chrono::steady_clock::now();
+                }
+            }
+
+            StageTimer(const StageTimer&) = delete;
+            StageTimer& operator=(const StageTimer&) = delete;
+
+            /// @brief Stops measuring and adds everything to the counters.
+            ~StageTimer()
+            {
+                if constexpr(isEnabled) {
+                    const std::chrono::nanoseconds duration(std::chrono::steady_clock::now() - _start);
+                    Internal::StageCounters& counters(Internal::GetStatisticsCounters().stages[static_cast<std::size_t>(_stage)]);
+
+                    counters.callCount.fetch_add(1, std::memory_order_relaxed);
+                    counters.inputSize.fetch_add(_inputSize, std::memory_order_relaxed);
+                    counters.outputSize.fetch_add(_outputSize, std::memory_order_relaxed);
+                    counters.nanoseconds.fetch_add(static_cast<std::uint64_t>(duration.count()), std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * @brief Adds to the amount of bytes or characters that went in, for inputs whose size is only known bit by bit.
+             * @param[in] size_ Amount to be added.
+            */
+            void AddInputSize(const std::size_t size_) noexcept { _inputSize += size_; }
+            /**
+             * @brief Adds to the amount of bytes or characters that came out.
+             * @param[in] size_ Amount to be added.
+            */
+            void AddOutputSize(const std::size_t size_) noexcept { _outputSize += size_; }
+            /**
+             * @brief Adds the size of a result to the amount that came out and passes the result on, so that a return statement can be wrapped.
+             * @tparam ResultType Either std::size_t or a type with a size member.
+             * @param[in] result_ Result of the measured work.
+             * @returns The given result.
+            */
+            template<typename ResultType>
+            ResultType CountOutput(const ResultType result_) noexcept
+            {
+                if constexpr(std::is_integral_v<ResultType>) {
+                    _outputSize += result_;
+                } else {
+                    _outputSize += result_.size;
+                }
+
+                return result_;
+            }
+
+        private:
+            Stage _stage;
+            std::size_t _inputSize;
+            std::size_t _outputSize;
+            std::chrono::steady_clock::time_point _start;
+        };
     }
 
     /**
@@ -84,8 +475,19 @@ namespace BinaryText
     concept ByteBufferCompatible =
         std::same_as<ByteType, char> or std::same_as<ByteType, signed char> or std::same_as<ByteType, unsigned char> or std::same_as<ByteType, std::byte>;
 
+    /// @brief Tag type of the ByteBuffer constructors that leave the bytes uninitialized.
+    struct Uninitialized
+    {
+        explicit Uninitialized() = default;
+    };
+
+    /// @brief Selects the ByteBuffer constructors that leave the bytes uninitialized, for buffers that are overwritten right away.
+    constexpr Uninitialized uninitialized{};
+
     /**
-     * @brief A class that is able to hold a buffer made up of bytes.
+     * A class that is able to hold a buffer made up of bytes. Memory is allocated from an std::pmr::memory_resource, which is the default
+     * resource (std::pmr::get_default_resource) unless one is passed to the constructor, so buffers can come from a pool or an arena.
+     *
      * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
     */
     template<typename ByteType>
@@ -159,9 +561,10 @@ namespace BinaryText
         };
 
         /**
-         * An iterator class that can be used as a non-constant iterator or a constant one. 
-         * Note that using nullptr with this does not cause undefined behavior.
-         * 
+         * An iterator class that can be used as a non-constant iterator or a constant one. It only holds a pointer, so it is trivially copyable and
+         * loops over it compile to plain pointer walks. The iterators of an empty ByteBuffer hold nullptr: with BINARYTEXT_CHECKED_ITERATORS, which is
+         * defined unless NDEBUG is, moving or dereferencing them does not cause undefined behavior (a dereferenced byte reads as zero).
+         *
          * @tparam ValueType Same as ByteType but can be constant.
         */
         template<typename ValueType>
@@ -180,192 +583,88 @@ namespace BinaryText
             using pointer = Pointer;
             using reference = Reference;
 
-            BaseIterator() noexcept :
-                _failsafe(static_cast<ValueType>(0)),
-                _address(nullptr),
-                _failsafeAddress(&_failsafe)
-            {}
-            explicit BaseIterator(std::add_const_t<Pointer> address_) :
-                _failsafe(static_cast<ValueType>(0)),
-                _address(address_),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseIterator(std::add_const_t<ValueType> failsafe_, std::add_const_t<Pointer> address_) :
-                _failsafe(failsafe_),
-                _address(address_),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseIterator(const BaseIterator& iterator_) :
-                _failsafe(iterator_._failsafe),
-                _address(iterator_._address),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseIterator(BaseIterator&& iterator_) :
-                _failsafe(iterator_._failsafe),
-                _address(iterator_._address),
-                _failsafeAddress(&_failsafe)
+            BaseIterator() noexcept = default;
+            explicit BaseIterator(std::add_const_t<Pointer> address_) noexcept :
+                _address(address_)
             {}
 
-            Reference operator[](const DifferenceType position_) const { return (_address != nullptr) ? _address[position_] : *_failsafeAddress; }
-            Reference operator*() const { return (_address != nullptr) ? *_address : *_failsafeAddress; }
-            Pointer operator->() const { return (_address != nullptr) ? _address : _failsafeAddress; }
-            BaseIterator& operator=(std::add_const_t<Pointer> address_)
+            Reference operator[](const DifferenceType position_) const noexcept { return *Internal::DereferenceableAddress(_address, position_); }
+            Reference operator*() const noexcept { return *Internal::DereferenceableAddress(_address, 0); }
+            Pointer operator->() const noexcept { return Internal::DereferenceableAddress(_address, 0); }
+            BaseIterator& operator=(std::add_const_t<Pointer> address_) noexcept
             {
                 _address = address_;
 
                 return *this;
             }
-            BaseIterator& operator=(const BaseIterator& iterator_)
-            {
-                _failsafe = iterator_._failsafe;
-                _address = iterator_._address;
-
-                return *this;
-            }
-            BaseIterator& operator=(BaseIterator&& iterator_)
-            {
-                _failsafe = iterator_._failsafe;
-                _address = iterator_._address;
-
-                return *this;
-            }
-            BaseIterator& operator+=(const DifferenceType difference_)
+            BaseIterator& operator+=(const DifferenceType difference_) noexcept
             {
-                if(_address != nullptr) _address += difference_;
+                _address = Internal::OffsetAddress(_address, difference_);
 
                 return *this;
             }
-            BaseIterator& operator-=(const DifferenceType difference_)
+            BaseIterator& operator-=(const DifferenceType difference_) noexcept
             {
-                if(_address != nullptr) _address -= difference_;
+                _address = Internal::OffsetAddress(_address, -difference_);
 
                 return *this;
             }
-            BaseIterator& operator++()
+            BaseIterator& operator++() noexcept
             {
-                if(_address != nullptr) _address++;
+                _address = Internal::OffsetAddress(_address, 1);
 
                 return *this;
             }
-            BaseIterator& operator--()
+            BaseIterator& operator--() noexcept
             {
-                if(_address != nullptr) _address--;
+                _address = Internal::OffsetAddress(_address, -1);
 
                 return *this;
             }
-            BaseIterator operator++(const int)
+            BaseIterator operator++(const int) noexcept
             {
-                BaseIterator iterator(*this);
+                const BaseIterator iterator(*this);
 
-                if(_address != nullptr) ++_address;
+                _address = Internal::OffsetAddress(_address, 1);
 
                 return iterator;
             }
-            BaseIterator operator--(const int)
+            BaseIterator operator--(const int) noexcept
             {
-                BaseIterator iterator(*this);
+                const BaseIterator iterator(*this);
 
-                if(_address != nullptr) --_address;
+                _address = Internal::OffsetAddress(_address, -1);
 
                 return iterator;
             }
-            BaseIterator operator+(const DifferenceType difference_) const
-            {
-                return (_address != nullptr) ? BaseIterator(_failsafe, _address + difference_) : *this;
-            }
-            BaseIterator operator-(const DifferenceType difference_) const
-            {
-                return (_address != nullptr) ? BaseIterator(_failsafe, _address - difference_) : *this;
-            }
-            friend BaseIterator operator+(const DifferenceType difference_, const BaseIterator& iterator_)
-            {
-                return (iterator_._address != nullptr) ? BaseIterator(iterator_._failsafe, iterator_._address + difference_) : iterator_;
-            }
-            DifferenceType operator-(const BaseIterator& iterator_) const
-            {
-                return (iterator_._address == nullptr or _address == nullptr) ? 0 : std::distance(iterator_._address, _address);
-            }
-            operator BaseIterator<const ValueType>() const
+            BaseIterator operator+(const DifferenceType difference_) const noexcept { return BaseIterator(Internal::OffsetAddress(_address, difference_)); }
+            BaseIterator operator-(const DifferenceType difference_) const noexcept { return BaseIterator(Internal::OffsetAddress(_address, -difference_)); }
+            friend BaseIterator operator+(const DifferenceType difference_, const BaseIterator& iterator_) noexcept { return iterator_ + difference_; }
+            DifferenceType operator-(const BaseIterator& iterator_) const noexcept { return Internal::AddressDistance(iterator_._address, _address); }
+            operator BaseIterator<const ValueType>() const noexcept
                 requires std::same_as<ValueType, std::remove_const_t<ValueType>>
             {
-                return BaseIterator<const ValueType>(_failsafe, _address);
-            }
-            bool operator<(const BaseIterator& iterator_) const
-            {
-                if(_address == nullptr and iterator_._address == nullptr) {
-                    return false;
-                } else if(_address != nullptr and iterator_._address == nullptr) {
-                    return false;
-                } else if(_address == nullptr and iterator_._address != nullptr) {
-                    return true;
-                } else {
-                    return _address < iterator_._address;
-                }
-            }
-            bool operator>(const BaseIterator& iterator_) const
-            {
-                if(_address == nullptr and iterator_._address == nullptr) {
-                    return false;
-                } else if(_address != nullptr and iterator_._address == nullptr) {
-                    return true;
-                } else if(_address == nullptr and iterator_._address != nullptr) {
-                    return false;
-                } else {
-                    return _address > iterator_._address;
-                }
-            }
-            bool operator<=(const BaseIterator& iterator_) const
-            {
-                if(_address == nullptr and iterator_._address == nullptr) {
-                    return true;
-                } else if(_address != nullptr and iterator_._address == nullptr) {
-                    return false;
-                } else if(_address == nullptr and iterator_._address != nullptr) {
-                    return true;
-                } else {
-                    return _address <= iterator_._address;
-                }
-            }
-            bool operator>=(const BaseIterator& iterator_) const
-            {
-                if(_address == nullptr and iterator_._address == nullptr) {
-                    return true;
-                } else if(_address != nullptr and iterator_._address == nullptr) {
-                    return true;
-                } else if(_address == nullptr and iterator_._address != nullptr) {
-                    return false;
-                } else {
-                    return _address >= iterator_._address;
-                }
+                return BaseIterator<const ValueType>(_address);
             }
-            bool operator==(const BaseIterator& iterator_) const { return _address == iterator_._address; }
-            bool operator!=(const BaseIterator& iterator_) const { return _address != iterator_._address; }
-            std::strong_ordering operator<=>(const BaseIterator& iterator_) const
+            // nullptr is ordered before every other address, like std::less does
+            bool operator==(const BaseIterator& iterator_) const noexcept { return _address == iterator_._address; }
+            std::strong_ordering operator<=>(const BaseIterator& iterator_) const noexcept
             {
-                if(_address == nullptr and iterator_._address == nullptr) {
-                    return std::strong_ordering::equivalent;
-                } else if(_address != nullptr and iterator_._address == nullptr) {
-                    return std::strong_ordering::greater;
-                } else if(_address == nullptr and iterator_._address != nullptr) {
-                    return std::strong_ordering::less;
-                } else {
-                    return _address <=> iterator_._address;
-                }
+                return std::compare_three_way()(_address, iterator_._address);
             }
 
         private:
-            typename std::remove_const_t<ValueType> _failsafe;
-            Pointer _address;
-            Pointer _failsafeAddress;
+            Pointer _address = nullptr;
         };
 
         static_assert(std::contiguous_iterator<BaseIterator<ByteType>>);
         static_assert(std::contiguous_iterator<BaseIterator<const ByteType>>);
+        static_assert(std::is_trivially_copyable_v<BaseIterator<ByteType>> and sizeof(BaseIterator<ByteType>) == sizeof(ByteType*));
 
         /**
-         * A reverse iterator class that can be used as a non-constant rerverse iterator or a constant reverse one.
-         * Note that using nullptr with this does not cause undefined behavior.
-         * 
+         * A reverse iterator class that can be used as a non-constant reverse iterator or a constant reverse one. Like BaseIterator it only holds a
+         * pointer, which points one past the byte it refers to.
+         *
          * @tparam ValueType Same as ByteType but can be constant.
         */
         template<typename ValueType>
@@ -384,193 +683,98 @@ namespace BinaryText
             using pointer = Pointer;
             using reference = Reference;
 
-            BaseReverseIterator() noexcept :
-                _failsafe(static_cast<ValueType>(0)),
-                _address(nullptr),
-                _failsafeAddress(&_failsafe)
-            {}
-            explicit BaseReverseIterator(std::add_const_t<Pointer> address_) :
-                _failsafe(static_cast<ValueType>(0)),
-                _address(address_),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseReverseIterator(std::add_const_t<ValueType> failsafe_, std::add_const_t<Pointer> address_) :
-                _failsafe(failsafe_),
-                _address(address_),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseReverseIterator(const BaseReverseIterator& iterator_) :
-                _failsafe(iterator_._failsafe),
-                _address(iterator_._address),
-                _failsafeAddress(&_failsafe)
-            {}
-            BaseReverseIterator(BaseReverseIterator&& iterator_) :
-                _failsafe(iterator_._failsafe),
-                _address(iterator_._address),
-                _failsafeAddress(&_failsafe)
+            BaseReverseIterator() noexcept = default;
+            explicit BaseReverseIterator(std::add_const_t<Pointer> address_) noexcept :
+                _address(address_)
             {}
 
-            BaseIterator<ValueType> Base() const { return ++BaseIterator<ValueType>(_failsafe, _address - 1); }
+            BaseIterator<ValueType> Base() const noexcept { return BaseIterator<ValueType>(_address); }
 
-            Reference operator[](const DifferenceType position_) const { return (_address != nullptr) ? *((_address - position_) - 1) : *_failsafeAddress; }
-            Reference operator*() const { return (_address != nullptr) ? *(_address - 1) : *_failsafeAddress; }
-            Pointer operator->() const { return (_address != nullptr) ? (_address - 1) : _failsafeAddress; }
-            BaseReverseIterator& operator=(std::add_const_t<Pointer> address_)
+            Reference operator[](const DifferenceType position_) const noexcept { return *Internal::DereferenceableAddress(_address, -position_ - 1); }
+            Reference operator*() const noexcept { return *Internal::DereferenceableAddress(_address, -1); }
+            Pointer operator->() const noexcept { return Internal::DereferenceableAddress(_address, -1); }
+            BaseReverseIterator& operator=(std::add_const_t<Pointer> address_) noexcept
             {
                 _address = address_;
 
                 return *this;
             }
-            BaseReverseIterator& operator=(const BaseReverseIterator& iterator_)
+            BaseReverseIterator& operator+=(const DifferenceType difference_) noexcept
             {
-                _failsafe = iterator_._failsafe;
-                _address = iterator_._address;
+                _address = Internal::OffsetAddress(_address, -difference_);
 
                 return *this;
             }
-            BaseReverseIterator& operator=(BaseReverseIterator&& iterator_)
+            BaseReverseIterator& operator-=(const DifferenceType difference_) noexcept
             {
-                _failsafe = iterator_._failsafe;
-                _address = iterator_._address;
+                _address = Internal::OffsetAddress(_address, difference_);
 
                 return *this;
             }
-            BaseReverseIterator& operator+=(const DifferenceType difference_)
+            BaseReverseIterator& operator++() noexcept
             {
-                if(_address != nullptr) _address -= difference_;
+                _address = Internal::OffsetAddress(_address, -1);
 
                 return *this;
             }
-            BaseReverseIterator& operator-=(const DifferenceType difference_)
+            BaseReverseIterator& operator--() noexcept
             {
-                if(_address != nullptr) _address += difference_;
+                _address = Internal::OffsetAddress(_address, 1);
 
                 return *this;
             }
-            BaseReverseIterator& operator++()
+            BaseReverseIterator operator++(const int) noexcept
             {
-                if(_address != nullptr) _address--;
+                const BaseReverseIterator iterator(*this);
 
-                return *this;
-            }
-            BaseReverseIterator& operator--()
-            {
-                if(_address != nullptr) _address++;
-
-                return *this;
-            }
-            BaseReverseIterator operator++(const int)
-            {
-                BaseReverseIterator iterator(*this);
-
-                if(_address != nullptr) --_address;
+                _address = Internal::OffsetAddress(_address, -1);
 
                 return iterator;
             }
-            BaseReverseIterator operator--(const int)
+            BaseReverseIterator operator--(const int) noexcept
             {
-                BaseReverseIterator iterator(*this);
+                const BaseReverseIterator iterator(*this);
 
-                if(_address != nullptr) ++_address;
+                _address = Internal::OffsetAddress(_address, 1);
 
                 return iterator;
             }
-            BaseReverseIterator operator+(const DifferenceType difference_) const
+            BaseReverseIterator operator+(const DifferenceType difference_) const noexcept
             {
-                return (_address != nullptr) ? BaseReverseIterator(_failsafe, _address - difference_) : *this;
+                return BaseReverseIterator(Internal::OffsetAddress(_address, -difference_));
             }
-            BaseReverseIterator operator-(const DifferenceType difference_) const
+            BaseReverseIterator operator-(const DifferenceType difference_) const noexcept
             {
-                return (_address != nullptr) ? BaseReverseIterator(_failsafe, _address + difference_) : *this;
+                return BaseReverseIterator(Internal::OffsetAddress(_address, difference_));
             }
-            friend BaseReverseIterator operator+(const DifferenceType difference_, const BaseReverseIterator& iterator_)
+            friend BaseReverseIterator operator+(const DifferenceType difference_, const BaseReverseIterator& iterator_) noexcept
             {
-                return (iterator_._address != nullptr) ? BaseReverseIterator(iterator_._failsafe, iterator_._address - difference_) : iterator_;
+                return iterator_ + difference_;
             }
-            DifferenceType operator-(const BaseReverseIterator& iterator_) const
-            {
-                return (iterator_._address == nullptr or _address == nullptr) ? 0 : std::distance(_address, iterator_._address);
-            }
-            operator BaseReverseIterator<const ValueType>() const
+            DifferenceType operator-(const BaseReverseIterator& iterator_) const noexcept { return Internal::AddressDistance(_address, iterator_._address); }
+            operator BaseReverseIterator<const ValueType>() const noexcept
                 requires std::same_as<ValueType, std::remove_const_t<ValueType>>
             {
-                return BaseReverseIterator<const ValueType>(_failsafe, _address);
-            }
-            bool operator<(const BaseReverseIterator& iterator_) const
-            {
-                if(iterator_._address == nullptr and _address == nullptr) {
-                    return false;
-                } else if(iterator_._address != nullptr and _address == nullptr) {
-                    return false;
-                } else if(iterator_._address == nullptr and _address != nullptr) {
-                    return true;
-                } else {
-                    return iterator_._address < _address;
-                }
-            }
-            bool operator>(const BaseReverseIterator& iterator_) const
-            {
-                if(iterator_._address == nullptr and _address == nullptr) {
-                    return false;
-                } else if(iterator_._address != nullptr and _address == nullptr) {
-                    return true;
-                } else if(iterator_._address == nullptr and _address != nullptr) {
-                    return false;
-                } else {
-                    return iterator_._address > _address;
-                }
-            }
-            bool operator<=(const BaseReverseIterator& iterator_) const
-            {
-                if(iterator_._address == nullptr and _address == nullptr) {
-                    return true;
-                } else if(iterator_._address != nullptr and _address == nullptr) {
-                    return false;
-                } else if(iterator_._address == nullptr and _address != nullptr) {
-                    return true;
-                } else {
-                    return iterator_._address <= _address;
-                }
-            }
-            bool operator>=(const BaseReverseIterator& iterator_) const
-            {
-                if(iterator_._address == nullptr and _address == nullptr) {
-                    return true;
-                } else if(iterator_._address != nullptr and _address == nullptr) {
-                    return true;
-                } else if(iterator_._address == nullptr and _address != nullptr) {
-                    return false;
-                } else {
-                    return iterator_._address >= _address;
-                }
+                return BaseReverseIterator<const ValueType>(_address);
             }
-            bool operator==(const BaseReverseIterator& iterator_) const { return iterator_._address == _address; }
-            bool operator!=(const BaseReverseIterator& iterator_) const { return iterator_._address != _address; }
-            std::strong_ordering operator<=>(const BaseReverseIterator& iterator_) const
+            // The order is the reverse of the order of the addresses, nullptr is ordered after every other address
+            bool operator==(const BaseReverseIterator& iterator_) const noexcept { return _address == iterator_._address; }
+            std::strong_ordering operator<=>(const BaseReverseIterator& iterator_) const noexcept
             {
-                if(iterator_._address == nullptr and _address == nullptr) {
-                    return std::strong_ordering::equivalent;
-                } else if(iterator_._address != nullptr and _address == nullptr) {
-                    return std::strong_ordering::greater;
-                } else if(iterator_._address == nullptr and _address != nullptr) {
-                    return std::strong_ordering::less;
-                } else {
-                    return iterator_._address <=> _address;
-                }
+                return std::compare_three_way()(iterator_._address, _address);
             }
 
             // For C++ compatibility purposes
 
-            BaseIterator<ValueType> base() const { return ++BaseIterator<ValueType>(_failsafe, _address - 1); }
+            BaseIterator<ValueType> base() const noexcept { return Base(); }
 
         private:
-            typename std::remove_const_t<ValueType> _failsafe;
-            Pointer _address;
-            Pointer _failsafeAddress;
+            Pointer _address = nullptr;
         };
 
         static_assert(std::contiguous_iterator<BaseReverseIterator<ByteType>>);
         static_assert(std::contiguous_iterator<BaseReverseIterator<const ByteType>>);
+        static_assert(std::is_trivially_copyable_v<BaseReverseIterator<ByteType>> and sizeof(BaseReverseIterator<ByteType>) == sizeof(ByteType*));
 
         using ValueType = ByteType;
         using Reference = ValueType&;
@@ -582,46 +786,56 @@ namespace BinaryText
         using DifferenceType = std::ptrdiff_t;
         using SizeType = std::size_t;
 
-        /// @brief Creates an empty ByteBuffer.
+        /// @brief Creates an empty ByteBuffer that allocates from the default memory resource.
         ByteBuffer() noexcept :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(std::pmr::get_default_resource())
         {}
         /**
-         * @brief Creates a ByteBuffer of given size.
+         * @brief Creates a ByteBuffer of given size with every byte set to zero.
+         * @param[in] size_ Size of ByteBuffer to be created.
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        explicit ByteBuffer(const SizeType size_, std::pmr::memory_resource* memoryResource_ = nullptr) :
+            ByteBuffer(size_, uninitialized, memoryResource_)
+        {
+            std::fill(_buffer.get(), _buffer.get() + _size, static_cast<ValueType>(0));
+        }
+        /**
+         * @brief Creates a ByteBuffer of given size without initializing its bytes, which is cheaper when they are overwritten right away.
          * @param[in] size_ Size of ByteBuffer to be created.
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
          * @throws BinaryText::ByteBuffer::Error
         */
-        explicit ByteBuffer(const SizeType size_) :
+        ByteBuffer(const SizeType size_, Uninitialized, std::pmr::memory_resource* memoryResource_ = nullptr) :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(SelectMemoryResource(memoryResource_))
         {
             if(size_ > GetMaximumSize()) {
                 throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
             } else if(size_ > 0) {
+                _buffer = Allocate(size_);
                 _size = size_;
-
-                try {
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    std::fill(_buffer.get(), _buffer.get() + _size, static_cast<ValueType>(0));
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
-
-                    throw Error(Error::Type::ALLOCATION_ERROR);
-                }
+                _capacity = size_;
             }
         }
         /**
          * @brief Creates a ByteBuffer from a pointer to a ByteType buffer.
          * @param[in] buffer_ Pointer to buffer to be copied.
          * @param[in] size_ Size of the buffer to be copied.
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
          * @throws BinaryText::ByteBuffer::Error
         */
-        ByteBuffer(const ValueType* buffer_, const SizeType size_) :
+        ByteBuffer(const ValueType* buffer_, const SizeType size_, std::pmr::memory_resource* memoryResource_ = nullptr) :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(SelectMemoryResource(memoryResource_))
         {
             if(size_ > GetMaximumSize()) {
                 throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
@@ -633,92 +847,90 @@ namespace BinaryText
                 _size = 0;
                 _buffer = nullptr;
             } else {
+                _buffer = Allocate(size_);
                 _size = size_;
+                _capacity = size_;
 
-                try {
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    std::copy(buffer_, buffer_ + _size, _buffer.get());
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
-
-                    throw Error(Error::Type::ALLOCATION_ERROR);
-                }
+                std::copy(buffer_, buffer_ + _size, _buffer.get());
             }
         }
         /**
          * @brief Creates a ByteBuffer from an std::vector.
          * @param[in] vector_ Vector to be copied.
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
          * @throws BinaryText::ByteBuffer::Error
         */
-        explicit ByteBuffer(const std::vector<ValueType>& vector_)
+        explicit ByteBuffer(const std::vector<ValueType>& vector_, std::pmr::memory_resource* memoryResource_ = nullptr)
             requires std::same_as<SizeType, typename std::vector<ValueType>::size_type>
                          and std::same_as<DifferenceType, typename std::vector<ValueType>::difference_type>
             :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(SelectMemoryResource(memoryResource_))
         {
             if(vector_.size() > GetMaximumSize()) {
                 throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
             } else if(vector_.size() > 0) {
+                _buffer = Allocate(vector_.size());
                 _size = vector_.size();
+                _capacity = _size;
 
-                try {
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    std::copy(vector_.cbegin(), vector_.cend(), _buffer.get());
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
-
-                    throw Error(Error::Type::ALLOCATION_ERROR);
-                }
+                std::copy(vector_.cbegin(), vector_.cend(), _buffer.get());
             }
         }
         /**
          * @brief Creates a ByteBuffer from a given file in the filesystem
          * @param[in] filePath_ Path to file
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
          * @throws BinaryText::ByteBuffer::Error
         */
-        explicit ByteBuffer(const std::filesystem::path& filePath_) :
+        explicit ByteBuffer(const std::filesystem::path& filePath_, std::pmr::memory_resource* memoryResource_ = nullptr) :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(SelectMemoryResource(memoryResource_))
         {
             ReadFromFile(filePath_);
         }
         /**
-         * @brief Copy constructor of ByteBuffer.
+         * @brief Copy constructor of ByteBuffer. Like the std::pmr containers, the copy allocates from the default memory resource.
          * @param[in] byteBuffer_ ByteBuffer to be copied.
         */
         ByteBuffer(const ByteBuffer& byteBuffer_) :
+            ByteBuffer(byteBuffer_, nullptr)
+        {}
+        /**
+         * @brief Copy constructor of ByteBuffer that allocates from given memory resource.
+         * @param[in] byteBuffer_ ByteBuffer to be copied.
+         * @param[in] memoryResource_ Memory resource to allocate from, nullptr for the default one. It must outlive the ByteBuffer.
+        */
+        ByteBuffer(const ByteBuffer& byteBuffer_, std::pmr::memory_resource* memoryResource_) :
             _size(0),
-            _buffer(nullptr)
+            _capacity(0),
+            _buffer(nullptr),
+            _memoryResource(SelectMemoryResource(memoryResource_))
         {
-            if(byteBuffer_._buffer != nullptr) {
+            if(byteBuffer_._size > 0) {
+                _buffer = Allocate(byteBuffer_._size);
                 _size = byteBuffer_._size;
+                _capacity = _size;
 
-                try {
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + _size, _buffer.get());
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
-
-                    throw Error(Error::Type::ALLOCATION_ERROR);
-                }
+                std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + _size, _buffer.get());
             }
         }
         /**
-         * @brief Move constructor of ByteBuffer.
+         * @brief Move constructor of ByteBuffer. The memory resource is moved along with the buffer.
          * @param[in] byteBuffer_ ByteBuffer to be moved.
         */
         ByteBuffer(ByteBuffer&& byteBuffer_) noexcept :
             _size(byteBuffer_._size),
-            _buffer(std::move(byteBuffer_._buffer))
+            _capacity(byteBuffer_._capacity),
+            _buffer(std::move(byteBuffer_._buffer)),
+            _memoryResource(byteBuffer_._memoryResource)
         {
             byteBuffer_._size = 0;
+            byteBuffer_._capacity = 0;
             byteBuffer_._buffer = nullptr;
         }
 
@@ -733,8 +945,7 @@ namespace BinaryText
                 try {
                     std::fill(_buffer.get(), _buffer.get() + _size, byte_);
                 } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
+                    Clear();
 
                     throw Error(Error::Type::ALLOCATION_ERROR);
                 }
@@ -755,6 +966,16 @@ namespace BinaryText
          * @returns Size of the ByteBuffer.
         */
         SizeType GetSize() const noexcept { return _size; }
+        /**
+         * @brief Gets how many bytes the ByteBuffer can hold without allocating again.
+         * @returns Capacity of the ByteBuffer.
+        */
+        SizeType GetCapacity() const noexcept { return _capacity; }
+        /**
+         * @brief Gets the memory resource the ByteBuffer allocates from.
+         * @returns Memory resource of the ByteBuffer.
+        */
+        std::pmr::memory_resource* GetMemoryResource() const noexcept { return _memoryResource; }
         /**
          * @brief Gets maximum size that a ByteBuffer can have.
          * @returns Maximum size that a ByteBuffer can have.
@@ -796,51 +1017,30 @@ namespace BinaryText
          * @brief Checks if the ByteBuffer is empty.
          * @returns Whether ByteBuffer is empty or not.
         */
-        bool IsEmpty() const noexcept { return _buffer == nullptr; }
+        bool IsEmpty() const noexcept { return _size == 0; }
+        /**
+         * @brief Resizes the ByteBuffer to given size. Shrinking and growing within the capacity happen in place.
+         * @param[in] size_ Size to resize it to.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void Resize(const SizeType size_) { Resize(size_, static_cast<ValueType>(0)); }
         /**
-         * @brief Resizes the ByteBuffer to given size.
+         * @brief Resizes the ByteBuffer to given size without initializing the bytes that are added, for bytes that are overwritten right away.
          * @param[in] size_ Size to resize it to.
          * @throws BinaryText::ByteBuffer::Error
         */
-        void Resize(const SizeType size_)
+        void Resize(const SizeType size_, Uninitialized)
         {
             if(size_ > GetMaximumSize()) {
                 throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-            } else if(size_ == _size) {
-                return;
-            } else if(size_ < 1) {
-                _size = 0;
-                _buffer = nullptr;
-            } else {
-                const SizeType previousSize(_size);
-                _size = size_;
-
-                try {
-                    std::unique_ptr<ValueType[]> previousBuffer(std::make_unique<ValueType[]>(previousSize));
-
-                    std::copy(_buffer.get(), _buffer.get() + previousSize, previousBuffer.get());
-
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    if(_size < previousSize) {
-                        std::copy(previousBuffer.get(), previousBuffer.get() + _size, _buffer.get());
-                    } else {
-                        std::copy(previousBuffer.get(), previousBuffer.get() + previousSize, _buffer.get());
-
-                        previousBuffer = nullptr;
-
-                        std::fill(_buffer.get() + previousSize, _buffer.get() + _size, static_cast<ValueType>(0));
-                    }
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
-
-                    throw Error(Error::Type::ALLOCATION_ERROR);
-                }
+            } else if(size_ > _capacity) {
+                Reallocate(GetGrowthCapacity(size_));
             }
+
+            _size = size_;
         }
         /**
-         * @brief Resizes the ByteBuffer to given size.
+         * @brief Resizes the ByteBuffer to given size. Shrinking and growing within the capacity happen in place.
          * @param[in] size_ Size to resize it to.
          * @param[in] byte_ Byte to append in case the provided size is bigger than current size.
          * @throws BinaryText::ByteBuffer::Error
@@ -849,52 +1049,111 @@ namespace BinaryText
         {
             if(size_ > GetMaximumSize()) {
                 throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-            } else if(size_ == _size) {
-                return;
-            } else if(size_ < 1) {
-                _size = 0;
-                _buffer = nullptr;
-            } else {
-                const SizeType previousSize(_size);
-                _size = size_;
-
-                try {
-                    std::unique_ptr<ValueType[]> previousBuffer(std::make_unique<ValueType[]>(previousSize));
+            } else if(size_ > _capacity) {
+                Reallocate(GetGrowthCapacity(size_));
+            }
 
-                    std::copy(_buffer.get(), _buffer.get() + previousSize, previousBuffer.get());
+            if(size_ > _size) {
+                std::fill(_buffer.get() + _size, _buffer.get() + size_, byte_);
+            }
 
-                    _buffer = std::make_unique<ValueType[]>(_size);
+            _size = size_;
+        }
+        /**
+         * @brief Makes sure the ByteBuffer can hold at least given amount of bytes without allocating again. The size is not changed.
+         * @param[in] capacity_ Capacity to reserve.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void Reserve(const SizeType capacity_)
+        {
+            if(capacity_ > GetMaximumSize()) {
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            } else if(capacity_ > _capacity) {
+                Reallocate(capacity_);
+            }
+        }
+        /**
+         * @brief Releases the capacity that is not being used.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void ShrinkToFit()
+        {
+            if(_size == 0) {
+                Clear();
+            } else if(_capacity > _size) {
+                Reallocate(_size);
+            }
+        }
+        /**
+         * @brief Appends a byte to the end of the ByteBuffer.
+         * @param[in] byte_ Byte to append.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void PushBack(const ValueType byte_)
+        {
+            if(_size == _capacity) {
+                if(_size == GetMaximumSize()) {
+                    throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+                }
 
-                    if(_size < previousSize) {
-                        std::copy(previousBuffer.get(), previousBuffer.get() + _size, _buffer.get());
-                    } else {
-                        std::copy(previousBuffer.get(), previousBuffer.get() + previousSize, _buffer.get());
+                Reallocate(GetGrowthCapacity(_size + 1));
+            }
 
-                        previousBuffer = nullptr;
+            _buffer[_size] = byte_;
+            _size += 1;
+        }
+        /**
+         * @brief Appends bytes to the end of the ByteBuffer. The bytes can be part of the ByteBuffer itself.
+         * @param[in] buffer_ Pointer to the bytes to append.
+         * @param[in] size_ Amount of bytes to append.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void Append(const ValueType* buffer_, const SizeType size_)
+        {
+            if(size_ < 1) {
+                return;
+            } else if(buffer_ == nullptr) {
+                throw Error(Error::Type::INVALID_ARGUMENTS_ERROR);
+            } else if(size_ > GetMaximumSize() - _size) {
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            }
 
-                        std::fill(_buffer.get() + previousSize, _buffer.get() + _size, byte_);
-                    }
-                } catch(const std::bad_alloc&) {
-                    _size = 0;
-                    _buffer = nullptr;
+            if(size_ > _capacity - _size) {
+                // Both copies are made before the previous buffer is released in case buffer_ points into it
+                const SizeType nextCapacity(GetGrowthCapacity(_size + size_));
+                BufferPointer nextBuffer(Allocate(nextCapacity));
 
-                    throw Error(Error::Type::ALLOCATION_ERROR);
+                if(_size > 0) {
+                    Statistics::CountReallocation();
                 }
+
+                std::copy(_buffer.get(), _buffer.get() + _size, nextBuffer.get());
+                std::copy(buffer_, buffer_ + size_, nextBuffer.get() + _size);
+
+                _capacity = nextCapacity;
+                _buffer = std::move(nextBuffer);
+            } else {
+                std::copy(buffer_, buffer_ + size_, _buffer.get() + _size);
             }
+
+            _size += size_;
         }
         /**
-         * @brief Swaps two ByteBuffers with each other.
+         * @brief Swaps two ByteBuffers with each other, including their memory resources.
          * @param[in,out] byteBuffer_ ByteBuffer to swap with.
         */
         void Swap(ByteBuffer& byteBuffer_) noexcept
         {
             std::swap(_size, byteBuffer_._size);
+            std::swap(_capacity, byteBuffer_._capacity);
             std::swap(_buffer, byteBuffer_._buffer);
+            std::swap(_memoryResource, byteBuffer_._memoryResource);
         }
-        /// @brief Clears the ByteBuffer
+        /// @brief Clears the ByteBuffer and releases its memory. The memory resource is kept.
         void Clear() noexcept
         {
             _size = 0;
+            _capacity = 0;
             _buffer = nullptr;
         }
         /**
@@ -904,119 +1163,188 @@ namespace BinaryText
         */
         void ReadFromFile(const std::filesystem::path& filePath_)
         {
+            Statistics::StageTimer timer(Statistics::Stage::READ);
             std::ifstream fileStream(filePath_, std::ifstream::in | std::ifstream::binary);
-            _size = 0;
-            _buffer = nullptr;
 
-            if(fileStream.is_open()) {
-                while(fileStream) {
-                    ByteBuffer byteBuffer(8192);
+            Clear();
 
-                    if constexpr(std::is_same_v<ValueType, char>) {
-                        fileStream.read(byteBuffer._buffer.get(), 8192);
-                    } else {
-                        fileStream.read(reinterpret_cast<char*>(byteBuffer._buffer.get()), 8192);
-                    }
+            if(not fileStream.is_open()) {
+                throw Error(Error::Type::OPEN_FILE_ERROR);
+            }
+
+            try {
+                std::error_code errorCode;
+                const std::uintmax_t fileSize(std::filesystem::file_size(filePath_, errorCode));
 
-                    if(not fileStream.fail() or fileStream.eof()) {
-                        const std::streamsize readCount(fileStream.gcount());
+                // The file size is only a hint (the file can change or not report one at all), one extra byte lets the first read reach the end of file
+                if(not errorCode and fileSize < GetMaximumSize()) {
+                    Reserve(static_cast<SizeType>(fileSize) + 1);
+                }
 
-                        if(readCount > 0) {
-                            byteBuffer.Resize(static_cast<SizeType>(readCount));
-                            operator+=(byteBuffer);
+                while(fileStream) {
+                    if(_size == _capacity) {
+                        if(_size > GetMaximumSize() - 8192) {
+                            throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
                         }
+
+                        Reallocate(GetGrowthCapacity(_size + 8192));
+                    }
+
+                    if constexpr(std::is_same_v<ValueType, char>) {
+                        fileStream.read(_buffer.get() + _size, static_cast<std::streamsize>(_capacity - _size));
                     } else {
-                        _size = 0;
-                        _buffer = nullptr;
+                        fileStream.read(reinterpret_cast<char*>(_buffer.get() + _size), static_cast<std::streamsize>(_capacity - _size));
+                    }
 
+                    if(fileStream.fail() and not fileStream.eof()) {
                         throw Error(Error::Type::READ_FROM_FILE_ERROR);
                     }
+
+                    _size += static_cast<SizeType>(fileStream.gcount());
                 }
-            } else {
-                _size = 0;
-                _buffer = nullptr;
 
-                throw Error(Error::Type::OPEN_FILE_ERROR);
+                timer.AddInputSize(_size * sizeof(ValueType));
+            } catch(const Error&) {
+                Clear();
+
+                throw;
             }
         }
         /**
-         * @brief Writes the entire ByteBuffer into a file.
+         * Maps a file into memory and uses the mapping as the internal buffer, so the contents of the file are not copied. The mapping is copy-on-write,
+         * the ByteBuffer can be changed like any other but the file itself is never written to. Growing past the size of the file moves the bytes to
+         * the heap. Files that cannot be mapped (pipes for example) are read with ReadFromFile instead. If an error is thrown the ByteBuffer is reset.
+         *
          * @param[in] filePath_ Path to file.
          * @throws BinaryText::ByteBuffer::Error
         */
-        void WriteToFile(const std::filesystem::path& filePath_) const
+        void MapFromFile(const std::filesystem::path& filePath_)
         {
-            if(_buffer != nullptr) {
-                std::ofstream fileStream(filePath_, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+            Clear();
 
-                if(fileStream.is_open()) {
-                    if(_size > 8192) {
-                        const SizeType chunkAmount(static_cast<SizeType>(static_cast<double>(_size) / 8192.0));
-                        const SizeType lastChunkSize(_size - (8192 * chunkAmount));
-
-                        for(SizeType i(0); i < chunkAmount; ++i) {
-                            std::unique_ptr<ValueType[]> chunk(nullptr);
-
-                            try {
-                                chunk = std::make_unique<ValueType[]>(8192);
-
-                                std::copy(_buffer.get() + (8192 * i), _buffer.get() + (8192 * i) + 8192, chunk.get());
-                            } catch(const std::bad_alloc&) {
-                                throw Error(Error::Type::ALLOCATION_ERROR);
-                            }
-
-                            if constexpr(std::is_same_v<ValueType, char>) {
-                                fileStream.write(chunk.get(), 8192);
-                            } else {
-                                fileStream.write(reinterpret_cast<char*>(chunk.get()), 8192);
-                            }
-
-                            if(fileStream.fail()) {
-                                throw Error(Error::Type::WRITE_TO_FILE_ERROR);
-                            }
-                        }
+#if defined(BINARYTEXT_WINDOWS_FILE_MAPPING)
+            const HANDLE file(::CreateFileW(filePath_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+            LARGE_INTEGER fileSize{};
+
+            if(file == INVALID_HANDLE_VALUE) {
+                throw Error(Error::Type::OPEN_FILE_ERROR);
+            } else if(::GetFileType(file) != FILE_TYPE_DISK or ::GetFileSizeEx(file, &fileSize) == 0) {
+                ::CloseHandle(file);
+                ReadFromFile(filePath_);
+
+                return;
+            } else if(fileSize.QuadPart < 1) {
+                ::CloseHandle(file);
+
+                return;
+            } else if(static_cast<std::uintmax_t>(fileSize.QuadPart) > GetMaximumSize()) {
+                ::CloseHandle(file);
+
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            }
 
-                        if(lastChunkSize > 0) {
-                            std::unique_ptr<ValueType[]> chunk(nullptr);
+            const SizeType size(static_cast<SizeType>(fileSize.QuadPart));
+            // Only the mapping itself is measured, the pages are read when they are first touched
+            Statistics::StageTimer timer(Statistics::Stage::READ, size);
+            const HANDLE mapping(::CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+            // The view keeps the mapping alive so both handles can be closed right away
+            void* address((mapping != nullptr) ? ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr);
 
-                            try {
-                                chunk = std::make_unique<ValueType[]>(lastChunkSize);
+            if(mapping != nullptr) {
+                ::CloseHandle(mapping);
+            }
 
-                                std::copy(_buffer.get() + (8192 * chunkAmount), _buffer.get() + ((8192 * chunkAmount) + lastChunkSize), chunk.get());
-                            } catch(const std::bad_alloc&) {
-                                throw Error(Error::Type::ALLOCATION_ERROR);
-                            }
+            ::CloseHandle(file);
 
-                            if constexpr(std::is_same_v<ValueType, char>) {
-                                fileStream.write(chunk.get(), lastChunkSize);
-                            } else {
-                                fileStream.write(reinterpret_cast<char*>(chunk.get()), static_cast<std::streamsize>(lastChunkSize));
-                            }
+            if(address == nullptr) {
+                throw Error(Error::Type::READ_FROM_FILE_ERROR);
+            }
+#elif defined(BINARYTEXT_POSIX_FILE_MAPPING)
+            const int file(::open(filePath_.c_str(), O_RDONLY | O_CLOEXEC));
+            struct stat fileStatus;
 
-                            if(fileStream.fail()) {
-                                throw Error(Error::Type::WRITE_TO_FILE_ERROR);
-                            }
-                        }
-                    } else {
-                        std::unique_ptr<ValueType[]> chunk(nullptr);
+            if(file < 0) {
+                throw Error(Error::Type::OPEN_FILE_ERROR);
+            } else if(::fstat(file, &fileStatus) != 0 or not S_ISREG(fileStatus.st_mode)) {
+                ::close(file);
+                ReadFromFile(filePath_);
 
-                        try {
-                            chunk = std::make_unique<ValueType[]>(_size);
+                return;
+            } else if(fileStatus.st_size < 1) {
+                ::close(file);
 
-                            std::copy(_buffer.get(), _buffer.get() + _size, chunk.get());
-                        } catch(const std::bad_alloc&) {
-                            throw Error(Error::Type::ALLOCATION_ERROR);
-                        }
+                return;
+            } else if(static_cast<std::uintmax_t>(fileStatus.st_size) > GetMaximumSize()) {
+                ::close(file);
+
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            }
+
+            const SizeType size(static_cast<SizeType>(fileStatus.st_size));
+            // Only the mapping itself is measured, the pages are read when they are first touched
+            Statistics::StageTimer timer(Statistics::Stage::READ, size);
+            void* address(::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0));
+
+            ::close(file);
+
+            if(address == MAP_FAILED) {
+                throw Error(Error::Type::READ_FROM_FILE_ERROR);
+            }
+
+            ::madvise(address, size, MADV_SEQUENTIAL);
+#else
+            ReadFromFile(filePath_);
+
+            return;
+#endif
+
+#if defined(BINARYTEXT_WINDOWS_FILE_MAPPING) || defined(BINARYTEXT_POSIX_FILE_MAPPING)
+            _buffer = BufferPointer(static_cast<ValueType*>(address), BufferDeleter{size});
+            _size = size;
+            _capacity = size;
+#endif
+        }
+        /**
+         * @brief Checks if the internal buffer is a memory mapping of a file (see MapFromFile).
+         * @returns Whether the internal buffer is a memory mapping or not.
+        */
+        bool IsMapped() const noexcept { return _buffer != nullptr and _buffer.get_deleter().mappedSize > 0; }
+        /**
+         * @brief Writes the entire ByteBuffer into a file.
+         * @param[in] filePath_ Path to file.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void WriteToFile(const std::filesystem::path& filePath_) const
+        {
+            Statistics::StageTimer timer(Statistics::Stage::WRITE, _size * sizeof(ValueType));
+
+            if(_size > 0) {
+                std::ofstream fileStream(filePath_, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+                if(fileStream.is_open()) {
+                    // Written straight from the internal buffer, in pieces only if the size does not fit into an std::streamsize
+                    constexpr SizeType maximumWriteSize(static_cast<SizeType>(std::numeric_limits<std::streamsize>::max()));
+
+                    for(SizeType position(0); position < _size;) {
+                        const SizeType writeSize(std::min(_size - position, maximumWriteSize));
 
                         if constexpr(std::is_same_v<ValueType, char>) {
-                            fileStream.write(chunk.get(), _size);
+                            fileStream.write(_buffer.get() + position, static_cast<std::streamsize>(writeSize));
                         } else {
-                            fileStream.write(reinterpret_cast<char*>(chunk.get()), static_cast<std::streamsize>(_size));
+                            fileStream.write(reinterpret_cast<const char*>(_buffer.get() + position), static_cast<std::streamsize>(writeSize));
                         }
 
                         if(fileStream.fail()) {
                             throw Error(Error::Type::WRITE_TO_FILE_ERROR);
                         }
+
+                        position += writeSize;
+                    }
+
+                    fileStream.flush();
+
+                    if(fileStream.fail()) {
+                        throw Error(Error::Type::WRITE_TO_FILE_ERROR);
                     }
                 } else {
                     throw Error(Error::Type::OPEN_FILE_ERROR);
@@ -1110,7 +1438,7 @@ namespace BinaryText
         }
 
         /**
-         * @brief Copy assignment operator of ByteBuffer.
+         * @brief Copy assignment operator of ByteBuffer. The memory resource is kept.
          * @param[in] byteBuffer_ ByteBuffer to be copied.
          * @throws BinaryText::ByteBuffer::Error
         */
@@ -1119,31 +1447,21 @@ namespace BinaryText
             if(&byteBuffer_ == this) {
                 return *this;
             } else {
-                if(byteBuffer_._buffer != nullptr) {
-                    _size = byteBuffer_._size;
-
-                    try {
-                        _buffer = std::make_unique<ValueType[]>(_size);
-
-                        std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + _size, _buffer.get());
-                    } catch(const std::bad_alloc&) {
-                        _size = 0;
-                        _buffer = nullptr;
+                // The current capacity is reused whenever it is big enough
+                if(byteBuffer_._size > _capacity) {
+                    _buffer = Allocate(byteBuffer_._size);
+                    _capacity = byteBuffer_._size;
+                }
 
-                        throw Error(Error::Type::ALLOCATION_ERROR);
-                    }
+                std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + byteBuffer_._size, _buffer.get());
 
-                    return *this;
-                } else {
-                    _size = 0;
-                    _buffer = nullptr;
+                _size = byteBuffer_._size;
 
-                    return *this;
-                }
+                return *this;
             }
         }
         /**
-         * @brief Move assignment operator of ByteBuffer.
+         * @brief Move assignment operator of ByteBuffer. The memory resource is moved along with the buffer.
          * @param[in] byteBuffer_ ByteBuffer to be moved.
         */
         ByteBuffer& operator=(ByteBuffer&& byteBuffer_) noexcept
@@ -1152,63 +1470,26 @@ namespace BinaryText
                 return *this;
             } else {
                 _size = byteBuffer_._size;
+                _capacity = byteBuffer_._capacity;
                 _buffer = std::move(byteBuffer_._buffer);
+                _memoryResource = byteBuffer_._memoryResource;
                 byteBuffer_._size = 0;
+                byteBuffer_._capacity = 0;
                 byteBuffer_._buffer = nullptr;
 
                 return *this;
             }
         }
         /**
-         * @brief Addition compound assignment operator of ByteBuffer.
+         * @brief Addition compound assignment operator of ByteBuffer. The capacity grows geometrically so that repeated appending is amortized.
          * @param[in] byteBuffer_ ByteBuffer to add.
          * @throws BinaryText::ByteBuffer::Error
         */
         ByteBuffer& operator+=(const ByteBuffer& byteBuffer_)
         {
-            if(_buffer != nullptr) {
-                if(byteBuffer_._buffer != nullptr) {
-                    const SizeType nextSize(_size + byteBuffer_._size);
-
-                    if(nextSize > GetMaximumSize()) {
-                        throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-                    } else if(nextSize < _size) {
-                        throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-                    } else {
-                        std::unique_ptr<ValueType[]> nextBuffer(nullptr);
-
-                        try {
-                            nextBuffer = std::make_unique<ValueType[]>(nextSize);
-
-                            std::copy(_buffer.get(), _buffer.get() + _size, nextBuffer.get());
-                            std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + byteBuffer_._size, nextBuffer.get() + _size);
-                        } catch(const std::bad_alloc&) {
-                            _size = 0;
-                            _buffer = nullptr;
-
-                            throw Error(Error::Type::ALLOCATION_ERROR);
-                        }
-
-                        _size = nextSize;
-                        _buffer = std::move(nextBuffer);
-
-                        return *this;
-                    }
-                } else {
-                    return *this;
-                }
-            } else {
-                if(byteBuffer_._buffer != nullptr) {
-                    _size = byteBuffer_._size;
-                    _buffer = std::make_unique<ValueType[]>(_size);
-
-                    std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + _size, _buffer.get());
+            Append(byteBuffer_._buffer.get(), byteBuffer_._size);
 
-                    return *this;
-                } else {
-                    return *this;
-                }
-            }
+            return *this;
         }
         /**
          * @brief Addition operator of ByteBuffer
@@ -1217,42 +1498,17 @@ namespace BinaryText
         */
         ByteBuffer operator+(const ByteBuffer& byteBuffer_) const
         {
-            if(_buffer != nullptr) {
-                if(byteBuffer_._buffer != nullptr) {
-                    const SizeType nextSize(_size + byteBuffer_._size);
-
-                    if(nextSize > GetMaximumSize()) {
-                        throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-                    } else if(nextSize < _size) {
-                        throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
-                    } else {
-                        std::unique_ptr<ValueType[]> nextBuffer(nullptr);
-
-                        try {
-                            nextBuffer = std::make_unique<ValueType[]>(nextSize);
+            if(byteBuffer_._size > GetMaximumSize() - _size) {
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            }
 
-                            std::copy(_buffer.get(), _buffer.get() + _size, nextBuffer.get());
-                            std::copy(byteBuffer_._buffer.get(), byteBuffer_._buffer.get() + byteBuffer_._size, nextBuffer.get() + _size);
-                        } catch(const std::bad_alloc&) {
-                            throw Error(Error::Type::ALLOCATION_ERROR);
-                        }
+            ByteBuffer byteBuffer;
 
-                        ByteBuffer byteBuffer;
-                        byteBuffer._size = nextSize;
-                        byteBuffer._buffer = std::move(nextBuffer);
+            byteBuffer.Reserve(_size + byteBuffer_._size);
+            byteBuffer.Append(_buffer.get(), _size);
+            byteBuffer.Append(byteBuffer_._buffer.get(), byteBuffer_._size);
 
-                        return byteBuffer;
-                    }
-                } else {
-                    return *this;
-                }
-            } else {
-                if(byteBuffer_._buffer != nullptr) {
-                    return byteBuffer_;
-                } else {
-                    return *this;
-                }
-            }
+            return byteBuffer;
         }
         /**
          * @brief Equality operator of ByteBuffer.
@@ -1261,25 +1517,13 @@ namespace BinaryText
         bool operator==(const ByteBuffer& byteBuffer_) const noexcept
         {
             if(_size == byteBuffer_._size) {
-                if(_buffer == nullptr) {
-                    if(byteBuffer_._buffer == nullptr) {
-                        return true;
-                    } else {
-                        return false;
-                    }
-                } else {
-                    if(byteBuffer_._buffer == nullptr) {
+                for(SizeType i(0); i < _size; ++i) {
+                    if(_buffer[i] != byteBuffer_._buffer[i]) {
                         return false;
-                    } else {
-                        for(SizeType i(0); i < _size; ++i) {
-                            if(_buffer[i] != byteBuffer_._buffer[i]) {
-                                return false;
-                            }
-                        }
-
-                        return true;
                     }
                 }
+
+                return true;
             } else {
                 return false;
             }
@@ -1321,19 +1565,26 @@ namespace BinaryText
         using difference_type = DifferenceType;
         using size_type = SizeType;
 
-        bool empty() const noexcept { return _buffer == nullptr; }
+        bool empty() const noexcept { return _size == 0; }
         size_type size() const noexcept { return _size; }
+        size_type capacity() const noexcept { return _capacity; }
         static consteval size_type max_size() noexcept { return static_cast<size_type>(std::numeric_limits<difference_type>::max()); }
         void resize(const size_type size_) { Resize(size_); }
         void resize(const size_type size_, const value_type byte_) { Resize(size_, byte_); }
+        void reserve(const size_type capacity_) { Reserve(capacity_); }
+        void shrink_to_fit() { ShrinkToFit(); }
+        void push_back(const value_type byte_) { PushBack(byte_); }
+        void append(const value_type* buffer_, const size_type size_) { Append(buffer_, size_); }
+        void clear() noexcept { Clear(); }
+        std::pmr::polymorphic_allocator<value_type> get_allocator() const noexcept { return std::pmr::polymorphic_allocator<value_type>(_memoryResource); }
         reference at(const size_type position_) { return (position_ < _size and _buffer != nullptr) ? _buffer[position_] : throw Error(Error::Type::OUT_OF_RANGE_ERROR); }
         const_reference at(const size_type position_) const { return (position_ < _size and _buffer != nullptr) ? _buffer[position_] : throw Error(Error::Type::OUT_OF_RANGE_ERROR); }
         reference unchecked_at(const size_type position_) { return _buffer[position_]; }
         const_reference unchecked_at(const size_type position_) const { return _buffer[position_]; }
         value_type* data() noexcept { return _buffer.get(); }
         const value_type* data() const noexcept { return _buffer.get(); }
-        void swap(ByteBuffer& byteBuffer_) noexcept { std::swap(_size, byteBuffer_._size); std::swap(_buffer, byteBuffer_._buffer); }
-        friend void swap(ByteBuffer& first_, ByteBuffer& second_) noexcept { std::swap(first_._size, second_._size); std::swap(first_._buffer, second_._buffer); }
+        void swap(ByteBuffer& byteBuffer_) noexcept { Swap(byteBuffer_); }
+        friend void swap(ByteBuffer& first_, ByteBuffer& second_) noexcept { first_.Swap(second_); }
         iterator begin() noexcept { return (_buffer != nullptr) ? iterator(&_buffer[0]) : iterator(); }
         iterator end() noexcept { return (_buffer != nullptr) ? iterator(&_buffer[_size]) : iterator(); }
         const_iterator begin() const noexcept { return (_buffer != nullptr) ? const_iterator(&_buffer[0]) : const_iterator(); }
@@ -1350,1994 +1601,8082 @@ namespace BinaryText
         // clang-format on
 
     private:
+        /// @brief Releases the internal buffer, which is either allocated from a memory resource or a memory mapping of a file.
+        struct BufferDeleter
+        {
+            SizeType mappedSize = 0;                             ///< Size of the memory mapping or 0 if the buffer was allocated from a memory resource.
+            SizeType allocatedSize = 0;                          ///< Size the buffer was allocated with.
+            std::pmr::memory_resource* memoryResource = nullptr; ///< Memory resource the buffer was allocated from.
+
+            void operator()(ValueType* buffer_) const noexcept
+            {
+                if(mappedSize == 0) {
+                    memoryResource->deallocate(buffer_, allocatedSize, alignof(ValueType));
+                } else {
+#if defined(BINARYTEXT_WINDOWS_FILE_MAPPING)
+                    ::UnmapViewOfFile(buffer_);
+#elif defined(BINARYTEXT_POSIX_FILE_MAPPING)
+                    ::munmap(buffer_, mappedSize);
+#endif
+                }
+            }
+        };
+
+        using BufferPointer = std::unique_ptr<ValueType[], BufferDeleter>;
+
+        /**
+         * @brief Gets the memory resource to allocate from.
+         * @param[in] memoryResource_ Memory resource passed to a constructor, nullptr for the default one.
+         * @returns Given memory resource or the default one.
+        */
+        static std::pmr::memory_resource* SelectMemoryResource(std::pmr::memory_resource* memoryResource_) noexcept
+        {
+            return (memoryResource_ != nullptr) ? memoryResource_ : std::pmr::get_default_resource();
+        }
+        /**
+         * @brief Allocates an uninitialized buffer from the memory resource.
+         * @param[in] size_ Size of the buffer.
+         * @returns Allocated buffer.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        BufferPointer Allocate(const SizeType size_) const
+        {
+            try {
+                BufferPointer buffer(static_cast<ValueType*>(_memoryResource->allocate(size_, alignof(ValueType))), BufferDeleter{0, size_, _memoryResource});
+
+                Statistics::CountAllocation(size_ * sizeof(ValueType));
+
+                return buffer;
+            } catch(const std::bad_alloc&) {
+                throw Error(Error::Type::ALLOCATION_ERROR);
+            }
+        }
+        /**
+         * @brief Calculates the capacity to grow to, at least doubling the current one so that growing is amortized.
+         * @param[in] size_ Size that must fit, it must not be bigger than the maximum size.
+         * @returns Capacity to grow to.
+        */
+        SizeType GetGrowthCapacity(const SizeType size_) const noexcept
+        {
+            if(_capacity > GetMaximumSize() / 2) {
+                return GetMaximumSize();
+            } else {
+                return std::max(size_, _capacity * 2);
+            }
+        }
+        /**
+         * @brief Moves the contents into a new buffer of given capacity. The ByteBuffer is left unchanged if an Error is thrown.
+         * @param[in] capacity_ Capacity of the new buffer, bytes past it are discarded.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        void Reallocate(const SizeType capacity_)
+        {
+            BufferPointer nextBuffer(Allocate(capacity_));
+
+            if(_size > 0) {
+                Statistics::CountReallocation();
+            }
+
+            _size = std::min(_size, capacity_);
+
+            std::copy(_buffer.get(), _buffer.get() + _size, nextBuffer.get());
+
+            _capacity = capacity_;
+            _buffer = std::move(nextBuffer);
+        }
+
         SizeType _size;
-        std::unique_ptr<ValueType[]> _buffer;
+        SizeType _capacity;
+        BufferPointer _buffer;
+        std::pmr::memory_resource* _memoryResource;
     };
 
     /**
-     * A concept that only accepts types supported by ByteBuffer.
-     * Additionally the given ByteBuffer's SizeType and DifferenceType must match std::string::size_type and std::string::difference_type respectively.
-     * 
-     * @tparam ByteType Either char, signed char, unsigned char or std::byte.
+     * A view of a range of bytes that does not own them, such as a whole ByteBuffer or a part of one. Neither copying it nor taking a Subview of it
+     * copies the bytes, so a slice of a big ByteBuffer can be encoded where it is. The bytes must outlive the ByteBufferView and every Subview of it.
+     *
+     * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
     */
     template<typename ByteType>
-    concept ByteBufferStringCompatible = ByteBufferCompatible<ByteType> and std::same_as<typename ByteBuffer<ByteType>::SizeType, std::string::size_type>
-        and std::same_as<typename ByteBuffer<ByteType>::DifferenceType, std::string::difference_type>;
-
-    /// @brief A namespace that has functions that implement Base16 encoding and decoding in accordance to RFC 4648 §8.
-    namespace Base16
+        requires ByteBufferCompatible<ByteType>
+    class ByteBufferView
     {
-        /// @brief A simple error class for the Base16 namespace.
-        class Error : public std::exception
-        {
-        public:
-            /// @brief The type of Error.
-            enum class Type
-            {
-                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                INVALID_CASE_ERROR,            ///< Invalid case.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
-            };
+    public:
+        using Error = typename ByteBuffer<ByteType>::Error;
+        using ValueType = ByteType;
+        using ConstantReference = const ValueType&;
+        using ConstantIterator = typename ByteBuffer<ByteType>::ConstantIterator;
+        using ConstantReverseIterator = typename ByteBuffer<ByteType>::ConstantReverseIterator;
+        using DifferenceType = std::ptrdiff_t;
+        using SizeType = std::size_t;
 
-            /**
-             * @brief Creates an Error of given Type.
-             * @param[in] type_ Type of Error.
-             * @param[in] sourceLocation_ Source location of Error.
-            */
-            explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
-                _type(type_),
-                _sourceLocation(sourceLocation_)
-            {
-                switch(_type) {
-                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
-                    case Type::INVALID_CASE_ERROR: _what = "Invalid case"; break;
-                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
-                    default: _what = "Invalid error type"; break;
-                }
+        /// @brief Creates an empty ByteBufferView.
+        constexpr ByteBufferView() noexcept :
+            _buffer(nullptr),
+            _size(0)
+        {}
+        /**
+         * @brief Creates a ByteBufferView of given bytes.
+         * @param[in] buffer_ Pointer to the bytes, which may only be nullptr if the size is 0.
+         * @param[in] size_ Amount of bytes.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        ByteBufferView(const ValueType* buffer_, const SizeType size_) :
+            _buffer((size_ > 0) ? buffer_ : nullptr),
+            _size(size_)
+        {
+            if(size_ > ByteBuffer<ByteType>::GetMaximumSize()) {
+                throw Error(Error::Type::MAXIMUM_SIZE_LIMIT_ERROR);
+            } else if(size_ > 0 and buffer_ == nullptr) {
+                throw Error(Error::Type::INVALID_ARGUMENTS_ERROR);
             }
+        }
+        /**
+         * @brief Creates a ByteBufferView of every byte of a ByteBuffer. It is implicit, so a ByteBuffer can be passed wherever a ByteBufferView is taken.
+         * @param[in] byteBuffer_ ByteBuffer to be viewed.
+        */
+        ByteBufferView(const ByteBuffer<ByteType>& byteBuffer_) noexcept :
+            _buffer(byteBuffer_.GetBuffer()),
+            _size(byteBuffer_.GetSize())
+        {}
+        /**
+         * @brief Creates a ByteBufferView of the bytes of an std::span, or of anything that converts to one such as an std::vector.
+         * @param[in] span_ Bytes to be viewed.
+        */
+        explicit ByteBufferView(const std::span<const ValueType> span_) noexcept :
+            _buffer(span_.empty() ? nullptr : span_.data()),
+            _size(span_.size())
+        {}
 
-            /**
-             * @brief Gets the Type of the Error.
-             * @returns Type of Error.
-            */
-            Type GetType() const noexcept { return _type; }
-            /**
-             * @brief Gets the location at which the Error was thrown.
-             * @returns Source location of Error.
-            */
-            std::source_location GetSourceLocation() const { return _sourceLocation; }
-            /**
-             * @brief Gets reason for the Error.
-             * @returns Reason for the Error.
-            */
-            std::string What() const { return _what; }
-
-            // For C++ compatibility purposes
-
-            const char* what() const noexcept override { return _what.c_str(); }
-
-        private:
-            Type _type;
-            std::source_location _sourceLocation;
-            std::string _what;
-        };
+        /**
+         * @brief Gets constant pointer to the viewed bytes.
+         * @returns Constant pointer to the viewed bytes, nullptr if the ByteBufferView is empty.
+        */
+        const ValueType* GetBuffer() const noexcept { return _buffer; }
+        /**
+         * @brief Gets size of the ByteBufferView.
+         * @returns Amount of viewed bytes.
+        */
+        SizeType GetSize() const noexcept { return _size; }
+        /**
+         * @brief Checks if the ByteBufferView is empty.
+         * @returns Whether ByteBufferView is empty or not.
+        */
+        bool IsEmpty() const noexcept { return _size == 0; }
+        /**
+         * @brief Gets constant reference to a position in the ByteBufferView.
+         * @param[in] position_ Position to be accessed.
+         * @returns Constant reference to a position in the ByteBufferView.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        ConstantReference At(const SizeType position_) const { return (position_ < _size) ? _buffer[position_] : throw Error(Error::Type::OUT_OF_RANGE_ERROR); }
+        /**
+         * @brief Gets constant reference to a position in the ByteBufferView. It does not check if the position is valid.
+         * @param[in] position_ Position to be accessed.
+         * @returns Constant reference to a position in the ByteBufferView.
+        */
+        ConstantReference UncheckedAt(const SizeType position_) const { return _buffer[position_]; }
+        /**
+         * @brief Gets a ByteBufferView of a part of the viewed bytes, without copying them.
+         * @param[in] offset_ Position of the first byte of the part.
+         * @param[in] size_ Amount of bytes of the part.
+         * @returns ByteBufferView of the part.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        ByteBufferView Subview(const SizeType offset_, const SizeType size_) const
+        {
+            if(offset_ > _size or size_ > _size - offset_) {
+                throw Error(Error::Type::OUT_OF_RANGE_ERROR);
+            }
 
-        /// @brief Case setting.
-        enum class Case
+            return (size_ > 0) ? ByteBufferView(_buffer + offset_, size_) : ByteBufferView();
+        }
+        /**
+         * @brief Gets a ByteBufferView of the viewed bytes from a given position to the end, without copying them.
+         * @param[in] offset_ Position of the first byte of the part.
+         * @returns ByteBufferView of the part.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        ByteBufferView Subview(const SizeType offset_) const
         {
-            LOWERCASE, ///< Lowercase (example: 7a7a).
-            MIXED,     ///< Mixed (example: 7a7A).
-            UPPERCASE  ///< Uppercase (example: 7A7A).
-        };
+            if(offset_ > _size) {
+                throw Error(Error::Type::OUT_OF_RANGE_ERROR);
+            }
 
-        static_assert(Internal::charSize == 8, "These Base16 functions only works if a char is 8 bits big");
+            return Subview(offset_, _size - offset_);
+        }
+        /**
+         * @brief Copies the viewed bytes into a ByteBuffer.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns ByteBuffer that holds a copy of the viewed bytes.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        ByteBuffer<ByteType> ToByteBuffer(std::pmr::memory_resource* memoryResource_ = nullptr) const
+        {
+            return (_size > 0) ? ByteBuffer<ByteType>(_buffer, _size, memoryResource_) : ByteBuffer<ByteType>(0, memoryResource_);
+        }
+        /**
+         * @brief Gets a constant iterator that points to the beginning of the ByteBufferView.
+         * @returns Constant iterator that points to the beginning of the ByteBufferView.
+        */
+        ConstantIterator Begin() const noexcept { return (_buffer != nullptr) ? ConstantIterator(_buffer) : ConstantIterator(); }
+        /**
+         * @brief Gets a constant iterator that points to the end of the ByteBufferView.
+         * @returns Constant iterator that points to the end of the ByteBufferView.
+        */
+        ConstantIterator End() const noexcept { return (_buffer != nullptr) ? ConstantIterator(_buffer + _size) : ConstantIterator(); }
+        /**
+         * @brief Gets a constant reverse iterator that points to the beginning of the ByteBufferView.
+         * @returns Constant reverse iterator that points to the beginning of the ByteBufferView.
+        */
+        ConstantReverseIterator ReverseBegin() const noexcept
+        {
+            return (_buffer != nullptr) ? ConstantReverseIterator(_buffer + _size) : ConstantReverseIterator();
+        }
+        /**
+         * @brief Gets a constant reverse iterator that points to the end of the ByteBufferView.
+         * @returns Constant reverse iterator that points to the end of the ByteBufferView.
+        */
+        ConstantReverseIterator ReverseEnd() const noexcept { return (_buffer != nullptr) ? ConstantReverseIterator(_buffer) : ConstantReverseIterator(); }
 
         /**
-         * @brief Encodes a not-encoded string into a Base16 encoded string.
-         * @param[in] string_ String to be encoded.
-         * @param[in] case_ Case to be used (mixed case not supported).
-         * @throws BinaryText::Base16::Error
+         * @brief Equality operator of ByteBufferView, which compares the viewed bytes.
+         * @param[in] byteBufferView_ ByteBufferView to compare with.
         */
-        std::string EncodeStringToString(const std::string& string_, const Case case_ = Case::UPPERCASE)
+        bool operator==(const ByteBufferView& byteBufferView_) const noexcept
         {
-            using Internal::charSize;
+            return _size == byteBufferView_._size and std::equal(_buffer, _buffer + _size, byteBufferView_._buffer);
+        }
+        /**
+         * @brief Gets constant reference to a position in the ByteBufferView.
+         * @param[in] position_ Position to be accessed.
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        const ValueType& operator[](const SizeType position_) const { return At(position_); }
 
-            std::string encodedString;
+        // For C++ compatibility purposes
+        // clang-format off
 
-            try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(string_.size() * 2);
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
+        using value_type = ValueType;
+        using const_reference = ConstantReference;
+        using const_iterator = ConstantIterator;
+        using const_reverse_iterator = ConstantReverseIterator;
+        using difference_type = DifferenceType;
+        using size_type = SizeType;
 
-            for(std::string::const_iterator iter(string_.cbegin()); iter != string_.cend(); ++iter) {
-                std::bitset<charSize> bitset(static_cast<unsigned char>(*iter));
+        bool empty() const noexcept { return _size == 0; }
+        size_type size() const noexcept { return _size; }
+        const_reference at(const size_type position_) const { return At(position_); }
+        const value_type* data() const noexcept { return _buffer; }
+        ByteBufferView subview(const size_type offset_, const size_type size_) const { return Subview(offset_, size_); }
+        const_iterator begin() const noexcept { return Begin(); }
+        const_iterator end() const noexcept { return End(); }
+        const_iterator cbegin() const noexcept { return Begin(); }
+        const_iterator cend() const noexcept { return End(); }
+        const_reverse_iterator rbegin() const noexcept { return ReverseBegin(); }
+        const_reverse_iterator rend() const noexcept { return ReverseEnd(); }
+        const_reverse_iterator crbegin() const noexcept { return ReverseBegin(); }
+        const_reverse_iterator crend() const noexcept { return ReverseEnd(); }
 
-                for(unsigned int i(0U); i < 2U; ++i) {
-                    std::bitset<charSize / 2> partialBitset;
+        // clang-format on
 
-                    if(i == 0U) {
-                        partialBitset = std::bitset<charSize / 2>((bitset >> 4).to_ullong());
-                    } else {
-                        partialBitset = std::bitset<charSize / 2>(((bitset << 4) >> 4).to_ullong());
-                    }
+    private:
+        const ValueType* _buffer;
+        SizeType _size;
+    };
 
-                    switch(case_) {
-                        case Case::UPPERCASE: {
-                            switch(partialBitset.to_ullong()) {
-                                case 0B0000ULL: encodedString.append(1, '0'); break;
-                                case 0B0001ULL: encodedString.append(1, '1'); break;
-                                case 0B0010ULL: encodedString.append(1, '2'); break;
-                                case 0B0011ULL: encodedString.append(1, '3'); break;
-                                case 0B0100ULL: encodedString.append(1, '4'); break;
-                                case 0B0101ULL: encodedString.append(1, '5'); break;
-                                case 0B0110ULL: encodedString.append(1, '6'); break;
-                                case 0B0111ULL: encodedString.append(1, '7'); break;
-                                case 0B1000ULL: encodedString.append(1, '8'); break;
-                                case 0B1001ULL: encodedString.append(1, '9'); break;
-                                case 0B1010ULL: encodedString.append(1, 'A'); break;
-                                case 0B1011ULL: encodedString.append(1, 'B'); break;
-                                case 0B1100ULL: encodedString.append(1, 'C'); break;
-                                case 0B1101ULL: encodedString.append(1, 'D'); break;
-                                case 0B1110ULL: encodedString.append(1, 'E'); break;
-                                case 0B1111ULL: encodedString.append(1, 'F'); break;
-                                default: Internal::UnreachableTerminate();
-                            }
+    /**
+     * A concept that only accepts types supported by ByteBuffer.
+     * Additionally the given ByteBuffer's SizeType and DifferenceType must match std::string::size_type and std::string::difference_type respectively.
+     * 
+     * @tparam ByteType Either char, signed char, unsigned char or std::byte.
+    */
+    template<typename ByteType>
+    concept ByteBufferStringCompatible = ByteBufferCompatible<ByteType> and std::same_as<typename ByteBuffer<ByteType>::SizeType, std::string::size_type>
+        and std::same_as<typename ByteBuffer<ByteType>::DifferenceType, std::string::difference_type>;
 
-                            break;
-                        }
-                        case Case::LOWERCASE: {
-                            switch(partialBitset.to_ullong()) {
-                                case 0B0000ULL: encodedString.append(1, '0'); break;
-                                case 0B0001ULL: encodedString.append(1, '1'); break;
-                                case 0B0010ULL: encodedString.append(1, '2'); break;
-                                case 0B0011ULL: encodedString.append(1, '3'); break;
-                                case 0B0100ULL: encodedString.append(1, '4'); break;
-                                case 0B0101ULL: encodedString.append(1, '5'); break;
-                                case 0B0110ULL: encodedString.append(1, '6'); break;
-                                case 0B0111ULL: encodedString.append(1, '7'); break;
-                                case 0B1000ULL: encodedString.append(1, '8'); break;
-                                case 0B1001ULL: encodedString.append(1, '9'); break;
-                                case 0B1010ULL: encodedString.append(1, 'a'); break;
-                                case 0B1011ULL: encodedString.append(1, 'b'); break;
-                                case 0B1100ULL: encodedString.append(1, 'c'); break;
-                                case 0B1101ULL: encodedString.append(1, 'd'); break;
-                                case 0B1110ULL: encodedString.append(1, 'e'); break;
-                                case 0B1111ULL: encodedString.append(1, 'f'); break;
-                                default: Internal::UnreachableTerminate();
-                            }
+    /// @brief Result of the Validate functions of the codec namespaces.
+    struct ValidationResult
+    {
+        bool isValid;            ///< Whether or not the input can be decoded.
+        std::size_t decodedSize; ///< Exact amount of bytes the input is decoded into, or the amount decoded before the error if it is invalid.
+        std::size_t errorOffset; ///< Offset of the character (or of the group of characters) that cannot be decoded, the input size if it is valid.
+    };
 
-                            break;
-                        }
-                        case Case::MIXED: throw Error(Error::Type::INVALID_CASE_ERROR);
-                        default: throw Error(Error::Type::INVALID_CASE_ERROR);
-                    }
-                }
-            }
+    /**
+     * Result of the TryDecode functions of the codec namespaces, which report errors through an error code instead of throwing, in the way of
+     * std::expected. Either the value holds the decoded bytes and the error code is empty, or the error code is set and the value is empty.
+     *
+     * @tparam ValueType Type of the decoded value, std::string or a ByteBuffer.
+    */
+    template<typename ValueType>
+    struct Result
+    {
+        ValueType value;           ///< Decoded value, empty if decoding failed.
+        std::error_code errorCode; ///< Why decoding failed, in the error category of the codec, empty if it did not.
 
-            return encodedString;
-        }
         /**
-         * @brief Encodes a ByteBuffer into a Base16 encoded string.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] case_ Case to be used (mixed case not supported).
-         * @throws BinaryText::Base16::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @brief Checks whether or not decoding succeeded.
+         * @returns Whether or not there is a value.
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const Case case_ = Case::UPPERCASE)
-        {
-            using Internal::charSize;
+        explicit operator bool() const noexcept { return not errorCode; }
+    };
 
-            std::string encodedString;
+    /// @brief How the line-wrapping encoding functions of Base64, Base64Url and Ascii85 split their output into lines.
+    struct LineWrapping
+    {
+        std::size_t lineLength;     ///< Maximum amount of characters per line, 0 for no line breaks at all.
+        std::string_view separator; ///< Characters written between two lines, but not after the last one.
+    };
 
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(byteBuffer_.GetSize() * 2);
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
+    /// @brief Lines of 76 characters separated by CRLF, as used by MIME (RFC 2045 §6.8).
+    constexpr LineWrapping mimeLineWrapping{76, "\r\n"};
+    /// @brief Lines of 64 characters separated by LF, as used by PEM (RFC 7468 §2).
+    constexpr LineWrapping pemLineWrapping{64, "\n"};
 
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize> bitset(static_cast<unsigned char>(*iter));
+    /// @brief Tag type of the decoding functions that skip whitespace anywhere in their input.
+    struct IgnoreWhitespace
+    {
+        explicit IgnoreWhitespace() = default;
+    };
 
-                for(unsigned int i(0U); i < 2U; ++i) {
-                    std::bitset<charSize / 2> partialBitset;
+    /// @brief Selects the decoding functions that skip space, tab, newline, vertical tab, form feed and carriage return anywhere in their input.
+    constexpr IgnoreWhitespace ignoreWhitespace{};
 
-                    if(i == 0U) {
-                        partialBitset = std::bitset<charSize / 2>((bitset >> 4).to_ullong());
-                    } else {
-                        partialBitset = std::bitset<charSize / 2>(((bitset << 4) >> 4).to_ullong());
-                    }
+    namespace Internal
+    {
+        /// @brief Value used in decoding tables for characters that are not part of the alphabet.
+        constexpr unsigned char invalidSymbol = 0xFF;
+        /// @brief Value used in decoding tables for characters that are ignored (whitespace and newline).
+        constexpr unsigned char ignoredSymbol = 0xFE;
 
-                    switch(case_) {
-                        case Case::UPPERCASE: {
-                            switch(partialBitset.to_ullong()) {
-                                case 0B0000ULL: encodedString.append(1, '0'); break;
-                                case 0B0001ULL: encodedString.append(1, '1'); break;
-                                case 0B0010ULL: encodedString.append(1, '2'); break;
-                                case 0B0011ULL: encodedString.append(1, '3'); break;
-                                case 0B0100ULL: encodedString.append(1, '4'); break;
-                                case 0B0101ULL: encodedString.append(1, '5'); break;
-                                case 0B0110ULL: encodedString.append(1, '6'); break;
-                                case 0B0111ULL: encodedString.append(1, '7'); break;
-                                case 0B1000ULL: encodedString.append(1, '8'); break;
-                                case 0B1001ULL: encodedString.append(1, '9'); break;
-                                case 0B1010ULL: encodedString.append(1, 'A'); break;
-                                case 0B1011ULL: encodedString.append(1, 'B'); break;
-                                case 0B1100ULL: encodedString.append(1, 'C'); break;
-                                case 0B1101ULL: encodedString.append(1, 'D'); break;
-                                case 0B1110ULL: encodedString.append(1, 'E'); break;
-                                case 0B1111ULL: encodedString.append(1, 'F'); break;
-                                default: Internal::UnreachableTerminate();
-                            }
+        /// @brief Result of an internal decoding function.
+        struct DecodeResult
+        {
+            std::size_t size; ///< Amount of bytes written to the output.
+            bool isValid;     ///< Whether or not the entire input could be parsed.
+        };
 
-                            break;
-                        }
-                        case Case::LOWERCASE: {
-                            switch(partialBitset.to_ullong()) {
-                                case 0B0000ULL: encodedString.append(1, '0'); break;
-                                case 0B0001ULL: encodedString.append(1, '1'); break;
-                                case 0B0010ULL: encodedString.append(1, '2'); break;
-                                case 0B0011ULL: encodedString.append(1, '3'); break;
-                                case 0B0100ULL: encodedString.append(1, '4'); break;
-                                case 0B0101ULL: encodedString.append(1, '5'); break;
-                                case 0B0110ULL: encodedString.append(1, '6'); break;
-                                case 0B0111ULL: encodedString.append(1, '7'); break;
-                                case 0B1000ULL: encodedString.append(1, '8'); break;
-                                case 0B1001ULL: encodedString.append(1, '9'); break;
-                                case 0B1010ULL: encodedString.append(1, 'a'); break;
-                                case 0B1011ULL: encodedString.append(1, 'b'); break;
-                                case 0B1100ULL: encodedString.append(1, 'c'); break;
-                                case 0B1101ULL: encodedString.append(1, 'd'); break;
-                                case 0B1110ULL: encodedString.append(1, 'e'); break;
-                                case 0B1111ULL: encodedString.append(1, 'f'); break;
-                                default: Internal::UnreachableTerminate();
-                            }
+        /**
+         * A string literal that can be used as a template argument, so that it can be encoded or decoded at compile time. It holds no terminating null
+         * character.
+         *
+         * @tparam size_ Amount of characters, without the terminating null character.
+        */
+        template<std::size_t size_>
+        struct ConstantString
+        {
+            std::array<char, size_> characters; ///< Characters of the string.
 
-                            break;
-                        }
-                        case Case::MIXED: throw Error(Error::Type::INVALID_CASE_ERROR);
-                        default: throw Error(Error::Type::INVALID_CASE_ERROR);
-                    }
-                }
+            /**
+             * @brief Creates a ConstantString from a string literal.
+             * @param[in] characters_ String literal to be copied.
+            */
+            consteval ConstantString(const char (&characters_)[size_ + 1]) noexcept :
+                characters()
+            {
+                std::copy_n(characters_, size_, characters.begin());
             }
+        };
+
+        template<std::size_t size_>
+        ConstantString(const char (&)[size_]) -> ConstantString<size_ - 1>;
 
-            return encodedString;
-        }
         /**
-         * @brief Decodes a Base16 encoded string into a decoded string. Whitespace and newline characters are ignored.
-         * @param[in] encodedString_ String to be decoded.
-         * @param[in] case_ Case to be used. The default is mixed case.
-         * @throws BinaryText::Base16::Error
+         * @brief Output of an encoding or decoding at compile time, it has room for the maximum amount of values and holds how many were written.
+         * @tparam ValueType Either char for encoding or unsigned char for decoding.
+         * @tparam maximumSize_ Maximum amount of values.
         */
-        std::string DecodeStringToString(const std::string& encodedString_, const Case case_ = Case::MIXED)
+        template<typename ValueType, std::size_t maximumSize_>
+        struct ConstantResult
         {
-            using Internal::charSize;
+            std::array<ValueType, maximumSize_> values; ///< Written values, followed by zeros.
+            std::size_t size;                           ///< Amount of values written.
+            bool isValid;                               ///< Whether or not the entire input could be parsed.
+        };
 
-            std::string decodedString;
+        /**
+         * @brief Encodes a ConstantString with a constexpr encoding function.
+         * @tparam maximumSize_ Maximum amount of encoded characters.
+         * @param[in] string_ String to be encoded.
+         * @param[in] encode_ Function that encodes (input, inputSize, output) and returns the amount of characters written.
+         * @returns The encoded characters.
+        */
+        template<std::size_t maximumSize_, std::size_t size_, typename EncodeFunction>
+        constexpr ConstantResult<char, maximumSize_> EncodeConstant(const ConstantString<size_>& string_, const EncodeFunction& encode_) noexcept
+        {
+            std::array<unsigned char, size_> bytes{};
+            ConstantResult<char, maximumSize_> result{};
 
-            try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(encodedString_.size() / 2);
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            for(std::size_t i(0); i < size_; ++i) {
+                bytes[i] = static_cast<unsigned char>(string_.characters[i]);
             }
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                if(*iter == ' ' or *iter == '\n') {
-                    continue;
-                } else {
-                    std::bitset<charSize> bitset;
-                    unsigned int counter(0U);
-
-                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                        if(*jter == ' ' or *jter == '\n') {
-                            if(std::next(jter, 1) == encodedString_.cend()) {
-                                break;
-                            } else {
-                                std::advance(iter, 1);
-
-                                continue;
-                            }
-                        } else {
-                            counter += 1U;
-                            bitset <<= charSize / 2;
-
-                            switch(case_) {
-                                case Case::MIXED: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                case Case::UPPERCASE: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                case Case::LOWERCASE: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                default: throw Error(Error::Type::INVALID_CASE_ERROR);
-                            }
-
-                            if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 2)) {
-                                iter = jter;
-
-                                break;
-                            }
-                        }
-                    }
+            result.size = encode_(bytes.data(), size_, result.values.data());
+            result.isValid = true;
 
-                    switch(counter) {
-                        case 2U: break;
-                        case 1U: bitset <<= charSize / 2; break;
-                        default: Internal::UnreachableTerminate();
-                    }
+            return result;
+        }
 
-                    decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
-                }
-            }
+        /**
+         * @brief Decodes a ConstantString with a constexpr decoding function.
+         * @tparam maximumSize_ Maximum amount of decoded bytes.
+         * @param[in] string_ String to be decoded.
+         * @param[in] decode_ Function that decodes (input, inputSize, output) and returns a DecodeResult.
+         * @returns The decoded bytes and whether or not the string was valid.
+        */
+        template<std::size_t maximumSize_, std::size_t size_, typename DecodeFunction>
+        constexpr ConstantResult<unsigned char, maximumSize_> DecodeConstant(const ConstantString<size_>& string_, const DecodeFunction& decode_) noexcept
+        {
+            ConstantResult<unsigned char, maximumSize_> result{};
+            const DecodeResult decodeResult(decode_(string_.characters.data(), size_, result.values.data()));
 
-            return decodedString;
+            result.size = decodeResult.size;
+            result.isValid = decodeResult.isValid;
+
+            return result;
         }
+
         /**
-         * @brief Decodes a Base16 encoded string into a decoded ByteBuffer. Whitespace and newline characters are ignored.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] encodedString_ String to be decoded.
-         * @param[in] case_ Case to be used. The default is mixed case.
-         * @throws BinaryText::Base16::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @brief Copies the written values of a ConstantResult into a std::array of exactly their size.
+         * @tparam OutputType Type of the values of the std::array.
+         * @tparam size_ Amount of values written, the size of the ConstantResult.
+         * @param[in] result_ Result to be copied.
+         * @returns The written values.
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_, const Case case_ = Case::MIXED)
+        template<typename OutputType, std::size_t size_, typename ValueType, std::size_t maximumSize_>
+        constexpr std::array<OutputType, size_> MakeConstantArray(const ConstantResult<ValueType, maximumSize_>& result_) noexcept
         {
-            using Internal::charSize;
+            static_assert(size_ <= maximumSize_, "The size must not be bigger than the maximum size");
 
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
+            std::array<OutputType, size_> values{};
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                if(*iter == ' ' or *iter == '\n') {
-                    continue;
-                } else {
-                    std::bitset<charSize> bitset;
-                    unsigned int counter(0U);
-
-                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                        if(*jter == ' ' or *jter == '\n') {
-                            if(std::next(jter, 1) == encodedString_.cend()) {
-                                break;
-                            } else {
-                                std::advance(iter, 1);
-
-                                continue;
-                            }
-                        } else {
-                            counter += 1U;
-                            bitset <<= charSize / 2;
-
-                            switch(case_) {
-                                case Case::MIXED: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                case Case::UPPERCASE: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                case Case::LOWERCASE: {
-                                    switch(*jter) {
-                                        case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
-                                        case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
-                                        case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
-                                        case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
-                                        case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
-                                        case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
-                                        case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
-                                        case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
-                                        case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
-                                        case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
-                                        case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
-                                        case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
-                                        case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
-                                        case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
-                                        case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
-                                        case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
-                                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                                    }
-
-                                    break;
-                                }
-                                default: throw Error(Error::Type::INVALID_CASE_ERROR);
-                            }
-
-                            if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 2)) {
-                                iter = jter;
-
-                                break;
-                            }
-                        }
-                    }
+            for(std::size_t i(0); i < size_; ++i) {
+                values[i] = static_cast<OutputType>(result_.values[i]);
+            }
 
-                    switch(counter) {
-                        case 2U: break;
-                        case 1U: bitset <<= charSize / 2; break;
-                        default: Internal::UnreachableTerminate();
-                    }
+            return values;
+        }
 
-                    if(bufferIterator < 8192) {
-                        if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                            byteBuffer.At(bufferIterator) = static_cast<unsigned char>(bitset.to_ullong());
-                        } else {
-                            byteBuffer.At(bufferIterator) = static_cast<ByteType>(static_cast<unsigned char>(bitset.to_ullong()));
-                        }
+        /**
+         * @brief Views the bytes of a ByteBuffer as encoded characters.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be viewed.
+         * @returns View of the bytes of the ByteBuffer.
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        std::string_view ViewAsCharacters(const ByteBuffer<ByteType>& byteBuffer_) noexcept
+        {
+            return std::string_view(reinterpret_cast<const char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize());
+        }
+        /**
+         * @brief Views the bytes of a ByteBufferView as encoded characters.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be viewed.
+         * @returns View of the bytes of the ByteBufferView.
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        std::string_view ViewAsCharacters(const ByteBufferView<ByteType> byteBufferView_) noexcept
+        {
+            return std::string_view(reinterpret_cast<const char*>(byteBufferView_.GetBuffer()), byteBufferView_.GetSize());
+        }
 
-                        bufferIterator += 1;
-                    } else {
-                        decodedByteBuffer += byteBuffer;
-                        bufferIterator = 0;
+        /**
+         * Decodes the characters held by a ByteBuffer into the ByteBuffer itself and shrinks it to the decoded size. This works because the internal
+         * decoding functions read every character before the bytes decoded from it are written and never write more bytes than they have read
+         * characters. Ascii85 folding ('z' and 'y') breaks the latter, so it needs to be ruled out by the caller. If the input is invalid the
+         * ByteBuffer is cleared.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @returns Whether or not the input was valid.
+        */
+        template<typename ByteType, typename DecodeFunction>
+            requires ByteBufferCompatible<ByteType>
+        bool DecodeInPlace(ByteBuffer<ByteType>& byteBuffer_, const DecodeFunction& decode_)
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, byteBuffer_.GetSize());
+            const DecodeResult result(decode_(reinterpret_cast<const char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(),
+                                              reinterpret_cast<unsigned char*>(byteBuffer_.GetBuffer())));
 
-                        if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                            byteBuffer.At(bufferIterator) = static_cast<unsigned char>(bitset.to_ullong());
-                        } else {
-                            byteBuffer.At(bufferIterator) = static_cast<ByteType>(static_cast<unsigned char>(bitset.to_ullong()));
-                        }
+            if(not result.isValid) {
+                byteBuffer_.Clear();
 
-                        bufferIterator += 1;
-                    }
-                }
+                return false;
             }
 
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+            byteBuffer_.Resize(result.size);
+            timer.AddOutputSize(result.size);
 
-                decodedByteBuffer += byteBuffer;
-            }
-
-            return decodedByteBuffer;
+            return true;
         }
-    };
 
-    /// @brief A namespace that has functions that implement Base32 encoding and decoding in accordance to RFC 4648 §6.
-    namespace Base32
-    {
-        /// @brief A simple error class for the Base32 namespace.
-        class Error : public std::exception
+        /**
+         * Decodes into a new string without throwing, for the TryDecode functions of the codec namespaces. It does the same as the throwing
+         * DecodeStringToString functions with the same decoding function, only errors become error codes. The error path copies nothing but the code.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has an INTERNAL_STRING_RESERVE_ERROR and a STRING_PARSE_ERROR.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] maximumDecodedSize_ Amount of bytes the decoding function may write.
+         * @param[in] makeErrorCode_ Function of the codec that turns an ErrorType::Type into an error code.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @returns Decoded string or error code.
+        */
+        template<typename ErrorType, typename MakeErrorCodeFunction, typename DecodeFunction>
+        Result<std::string> TryDecodeToString(const std::string_view input_, const std::size_t maximumDecodedSize_, const MakeErrorCodeFunction& makeErrorCode_,
+                                              const DecodeFunction& decode_) noexcept
         {
-        public:
-            /// @brief The type of Error.
-            enum class Type
-            {
-                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
-            };
-
-            /**
-             * @brief Creates an Error of given Type.
-             * @param[in] type_ Type of Error.
-             * @param[in] sourceLocation_ Source location of Error.
-            */
-            explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
-                _type(type_),
-                _sourceLocation(sourceLocation_)
-            {
-                switch(_type) {
-                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
-                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
-                    default: _what = "Invalid error type"; break;
-                }
-            }
+            Result<std::string> result{};
 
-            /**
-             * @brief Gets the Type of the Error.
-             * @returns Type of Error.
-            */
-            Type GetType() const noexcept { return _type; }
-            /**
-             * @brief Gets the location at which the Error was thrown.
-             * @returns Source location of Error.
-            */
-            std::source_location GetSourceLocation() const { return _sourceLocation; }
-            /**
-             * @brief Gets reason for the Error.
-             * @returns Reason for the Error.
-            */
-            std::string What() const { return _what; }
+            try {
+                result.value.resize(maximumDecodedSize_);
+            } catch(const std::length_error&) {
+                result.errorCode = makeErrorCode_(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
 
-            // For C++ compatibility purposes
+                return result;
+            } catch(const std::bad_alloc&) {
+                result.errorCode = makeErrorCode_(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
 
-            const char* what() const noexcept override { return _what.c_str(); }
+                return result;
+            }
 
-        private:
-            Type _type;
-            std::source_location _sourceLocation;
-            std::string _what;
-        };
+            const DecodeResult decodeResult(decode_(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(result.value.data())));
 
-        static_assert(Internal::charSize == 8, "These Base32 functions only works if a char is 8 bits big");
+            if(not decodeResult.isValid) {
+                result.value = std::string();
+                result.errorCode = makeErrorCode_(ErrorType::Type::STRING_PARSE_ERROR);
+            } else {
+                result.value.resize(decodeResult.size);
+            }
 
+            return result;
+        }
         /**
-         * @brief Encodes a not-encoded string into a Base32 encoded string.
-         * @param[in] string_ String to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base32::Error
+         * Decodes into a new ByteBuffer without throwing, for the TryDecode functions of the codec namespaces. It does the same as the throwing
+         * DecodeStringToByteBuffer functions with the same decoding function, only errors become error codes, a failed allocation of the ByteBuffer
+         * included.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has an INTERNAL_STRING_RESERVE_ERROR and a STRING_PARSE_ERROR.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] maximumDecodedSize_ Amount of bytes the decoding function may write.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @param[in] makeErrorCode_ Function of the codec that turns an ErrorType::Type into an error code.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @returns Decoded ByteBuffer or error code.
         */
-        std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+        template<typename ErrorType, typename ByteType, typename MakeErrorCodeFunction, typename DecodeFunction>
+            requires ByteBufferCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeToByteBuffer(const std::string_view input_, const std::size_t maximumDecodedSize_,
+                                                           std::pmr::memory_resource* memoryResource_, const MakeErrorCodeFunction& makeErrorCode_,
+                                                           const DecodeFunction& decode_) noexcept
         {
-            using Internal::charSize;
-
-            std::string encodedString;
+            // An empty ByteBuffer allocates nothing, so only the ByteBuffer that is decoded into can fail
+            Result<ByteBuffer<ByteType>> result{ByteBuffer<ByteType>(0, memoryResource_), std::error_code()};
 
             try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 5.0) * 8.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
+                ByteBuffer<ByteType> decodedByteBuffer(maximumDecodedSize_, uninitialized, memoryResource_);
+                const DecodeResult decodeResult(decode_(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer())));
 
-            for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int counter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 5)) {
-                        iter = jter;
-
-                        break;
-                    }
+                if(not decodeResult.isValid) {
+                    result.errorCode = makeErrorCode_(ErrorType::Type::STRING_PARSE_ERROR);
+                } else {
+                    decodedByteBuffer.Resize(decodeResult.size);
+                    result.value = std::move(decodedByteBuffer);
                 }
+            } catch(const typename ByteBuffer<ByteType>::Error&) {
+                result.errorCode = makeErrorCode_(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
 
-                switch(counter) {
-                    case 5U: counter = 8U; break;
-                    case 4U: {
-                        bitset <<= charSize;
-                        counter = 7U;
-
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= (charSize * 2);
-                        counter = 5U;
-
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (charSize * 3);
-                        counter = 4U;
-
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 4);
-                        counter = 2U;
+            return result;
+        }
 
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
-                }
+        /**
+         * Encodes into a string of the caller, for the EncodeInto functions of the codec namespaces. The string is cleared and resized, so its capacity
+         * is reused and it only allocates if it is too small, without copying the previous contents.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has an INTERNAL_STRING_RESERVE_ERROR.
+         * @param[out] output_ String the encoded characters are written to.
+         * @param[in] encodedSize_ Amount of characters the encoding function may write.
+         * @param[in] encode_ Internal encoding function that takes the output and returns the amount of characters written.
+         * @throws ErrorType
+        */
+        template<typename ErrorType, typename EncodeFunction>
+        void EncodeIntoString(std::string& output_, const std::size_t encodedSize_, const EncodeFunction& encode_)
+        {
+            output_.clear();
 
-                for(unsigned int i(1U); i < 9U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 5) / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B00000ULL: encodedString.append(1, 'A'); break;
-                            case 0B00001ULL: encodedString.append(1, 'B'); break;
-                            case 0B00010ULL: encodedString.append(1, 'C'); break;
-                            case 0B00011ULL: encodedString.append(1, 'D'); break;
-                            case 0B00100ULL: encodedString.append(1, 'E'); break;
-                            case 0B00101ULL: encodedString.append(1, 'F'); break;
-                            case 0B00110ULL: encodedString.append(1, 'G'); break;
-                            case 0B00111ULL: encodedString.append(1, 'H'); break;
-                            case 0B01000ULL: encodedString.append(1, 'I'); break;
-                            case 0B01001ULL: encodedString.append(1, 'J'); break;
-                            case 0B01010ULL: encodedString.append(1, 'K'); break;
-                            case 0B01011ULL: encodedString.append(1, 'L'); break;
-                            case 0B01100ULL: encodedString.append(1, 'M'); break;
-                            case 0B01101ULL: encodedString.append(1, 'N'); break;
-                            case 0B01110ULL: encodedString.append(1, 'O'); break;
-                            case 0B01111ULL: encodedString.append(1, 'P'); break;
-                            case 0B10000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B10001ULL: encodedString.append(1, 'R'); break;
-                            case 0B10010ULL: encodedString.append(1, 'S'); break;
-                            case 0B10011ULL: encodedString.append(1, 'T'); break;
-                            case 0B10100ULL: encodedString.append(1, 'U'); break;
-                            case 0B10101ULL: encodedString.append(1, 'V'); break;
-                            case 0B10110ULL: encodedString.append(1, 'W'); break;
-                            case 0B10111ULL: encodedString.append(1, 'X'); break;
-                            case 0B11000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B11001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B11010ULL: encodedString.append(1, '2'); break;
-                            case 0B11011ULL: encodedString.append(1, '3'); break;
-                            case 0B11100ULL: encodedString.append(1, '4'); break;
-                            case 0B11101ULL: encodedString.append(1, '5'); break;
-                            case 0B11110ULL: encodedString.append(1, '6'); break;
-                            case 0B11111ULL: encodedString.append(1, '7'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
+            try {
+                output_.resize(encodedSize_);
+            } catch(const std::length_error&) {
+                throw ErrorType(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            return encodedString;
+            output_.resize(encode_(output_.data()));
         }
         /**
-         * @brief Encodes a ByteBuffer into a Base32 encoded string.
+         * Encodes the bytes of several ByteBufferViews one after another as if they were one buffer, for the EncodeByteBufferViewsToString functions of
+         * the codec namespaces. The views are passed to the streaming encoder of the codec one by one, so they are never concatenated.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has an INTERNAL_STRING_RESERVE_ERROR.
+         * @tparam EncoderType Encoder class of the codec.
          * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base32::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @param[in,out] encoder_ Encoder that has not been updated yet.
+         * @param[in] byteBufferViews_ Views of the bytes to be encoded, in order.
+         * @returns Encoded string.
+         * @throws ErrorType
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true)
+        template<typename ErrorType, typename EncoderType, typename ByteType>
+        std::string EncodeByteBufferViews(EncoderType& encoder_, const std::span<const ByteBufferView<ByteType>> byteBufferViews_)
         {
-            using Internal::charSize;
-
             std::string encodedString;
+            std::size_t size(0);
 
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(byteBuffer_.GetSize()) / 5.0) * 8.0));
+            for(const ByteBufferView<ByteType>& byteBufferView : byteBufferViews_) {
+                // No encoding is more than twice the size of its input
+                if(byteBufferView.GetSize() > encodedString.max_size() / 2 - size) {
+                    throw ErrorType(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
                 }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
-
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int counter(0U);
 
-                for(typename ByteBuffer<ByteType>::ConstantIterator jter(iter); jter != byteBuffer_.ConstantEnd(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == byteBuffer_.ConstantEnd() or std::next(jter, 1) == std::next(iter, 5)) {
-                        iter = jter;
+                size += byteBufferView.GetSize();
+            }
 
-                        break;
-                    }
+            // Encoding everything at once fits into this, the size is only grown in case the maximum sizes of the single pieces add up to more than that
+            const auto resize([&encodedString](const std::size_t size_) -> void {
+                try {
+                    encodedString.resize(size_);
+                } catch(const std::length_error&) {
+                    throw ErrorType(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
                 }
+            });
+            std::size_t encodedSize(0);
 
-                switch(counter) {
-                    case 5U: counter = 8U; break;
-                    case 4U: {
-                        bitset <<= charSize;
-                        counter = 7U;
-
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= (charSize * 2);
-                        counter = 5U;
-
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (charSize * 3);
-                        counter = 4U;
+            resize(EncoderType::GetMaximumUpdateSize(size) + EncoderType::GetMaximumFinishSize());
 
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 4);
-                        counter = 2U;
+            for(const ByteBufferView<ByteType>& byteBufferView : byteBufferViews_) {
+                const std::size_t maximumSize(EncoderType::GetMaximumUpdateSize(byteBufferView.GetSize()));
 
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
+                if(encodedString.size() - encodedSize < maximumSize) {
+                    resize(encodedSize + maximumSize);
                 }
 
-                for(unsigned int i(1U); i < 9U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize) * 5 / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B00000ULL: encodedString.append(1, 'A'); break;
-                            case 0B00001ULL: encodedString.append(1, 'B'); break;
-                            case 0B00010ULL: encodedString.append(1, 'C'); break;
-                            case 0B00011ULL: encodedString.append(1, 'D'); break;
-                            case 0B00100ULL: encodedString.append(1, 'E'); break;
-                            case 0B00101ULL: encodedString.append(1, 'F'); break;
-                            case 0B00110ULL: encodedString.append(1, 'G'); break;
-                            case 0B00111ULL: encodedString.append(1, 'H'); break;
-                            case 0B01000ULL: encodedString.append(1, 'I'); break;
-                            case 0B01001ULL: encodedString.append(1, 'J'); break;
-                            case 0B01010ULL: encodedString.append(1, 'K'); break;
-                            case 0B01011ULL: encodedString.append(1, 'L'); break;
-                            case 0B01100ULL: encodedString.append(1, 'M'); break;
-                            case 0B01101ULL: encodedString.append(1, 'N'); break;
-                            case 0B01110ULL: encodedString.append(1, 'O'); break;
-                            case 0B01111ULL: encodedString.append(1, 'P'); break;
-                            case 0B10000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B10001ULL: encodedString.append(1, 'R'); break;
-                            case 0B10010ULL: encodedString.append(1, 'S'); break;
-                            case 0B10011ULL: encodedString.append(1, 'T'); break;
-                            case 0B10100ULL: encodedString.append(1, 'U'); break;
-                            case 0B10101ULL: encodedString.append(1, 'V'); break;
-                            case 0B10110ULL: encodedString.append(1, 'W'); break;
-                            case 0B10111ULL: encodedString.append(1, 'X'); break;
-                            case 0B11000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B11001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B11010ULL: encodedString.append(1, '2'); break;
-                            case 0B11011ULL: encodedString.append(1, '3'); break;
-                            case 0B11100ULL: encodedString.append(1, '4'); break;
-                            case 0B11101ULL: encodedString.append(1, '5'); break;
-                            case 0B11110ULL: encodedString.append(1, '6'); break;
-                            case 0B11111ULL: encodedString.append(1, '7'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
+                encodedSize += encoder_.Update(std::as_bytes(std::span(byteBufferView.GetBuffer(), byteBufferView.GetSize())),
+                                               std::span(encodedString).subspan(encodedSize));
             }
 
+            if(encodedString.size() - encodedSize < EncoderType::GetMaximumFinishSize()) {
+                resize(encodedSize + EncoderType::GetMaximumFinishSize());
+            }
+
+            encodedSize += encoder_.Finish(std::span(encodedString).subspan(encodedSize));
+            encodedString.resize(encodedSize);
+
             return encodedString;
         }
         /**
-         * @brief Decodes a Base32 encoded string into a decoded string. Whitespace and newline characters are not ignored.
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base32::Error
+         * Decodes into a string of the caller, for the DecodeInto functions of the codec namespaces. The string is cleared and resized, so its capacity
+         * is reused and it only allocates if it is too small. If the input is invalid the string is left empty.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has an INTERNAL_STRING_RESERVE_ERROR and a STRING_PARSE_ERROR.
+         * @param[in] input_ Characters to be decoded, they must not be part of the output.
+         * @param[out] output_ String the decoded bytes are written to.
+         * @param[in] maximumDecodedSize_ Amount of bytes the decoding function may write.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @throws ErrorType
         */
-        std::string DecodeStringToString(const std::string& encodedString_)
+        template<typename ErrorType, typename DecodeFunction>
+        void DecodeIntoString(const std::string_view input_, std::string& output_, const std::size_t maximumDecodedSize_, const DecodeFunction& decode_)
         {
-            using Internal::charSize;
-
-            std::string decodedString;
+            output_.clear();
 
             try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 8.0) * 5.0));
-                }
+                output_.resize(maximumDecodedSize_);
             } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                throw ErrorType(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 5) / 8;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
+            const DecodeResult result(decode_(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data())));
 
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
+            if(not result.isValid) {
+                output_.clear();
 
-                switch(loopCounter) {
-                    case 8U: break;
-                    case 7U: {
-                        bitset <<= (charSize * 5) / 8;
+                throw ErrorType(ErrorType::Type::STRING_PARSE_ERROR);
+            }
 
-                        switch(paddingCounter) {
-                            case 5U: paddingCounter = 6U; break;
-                            case 3U: paddingCounter = 4U; break;
-                            case 2U: paddingCounter = 3U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            output_.resize(result.size);
+        }
+        /**
+         * Decodes into a ByteBuffer of the caller, for the DecodeInto functions of the codec namespaces. The ByteBuffer is emptied and resized without
+         * initializing its bytes, so its capacity is reused and it only allocates if it is too small. If the input is invalid the ByteBuffer is left
+         * empty, its capacity is kept.
+         *
+         * @tparam ErrorType Error class of the codec, whose Type has a STRING_PARSE_ERROR.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] input_ Characters to be decoded, they must not be part of the output.
+         * @param[out] output_ ByteBuffer the decoded bytes are written to.
+         * @param[in] maximumDecodedSize_ Amount of bytes the decoding function may write.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @throws ErrorType
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ErrorType, typename ByteType, typename DecodeFunction>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeIntoByteBuffer(const std::string_view input_, ByteBuffer<ByteType>& output_, const std::size_t maximumDecodedSize_,
+                                  const DecodeFunction& decode_)
+        {
+            output_.Resize(0);
+            output_.Resize(maximumDecodedSize_, uninitialized);
 
-                        break;
-                    }
-                    case 6U: {
-                        bitset <<= ((charSize * 5) / 8) * 2;
-
-                        switch(paddingCounter) {
-                            case 4U: paddingCounter = 6U; break;
-                            case 2U: paddingCounter = 4U; break;
-                            case 1U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            const DecodeResult result(decode_(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.GetBuffer())));
 
-                        break;
-                    }
-                    case 5U: {
-                        bitset <<= ((charSize * 5) / 8) * 3;
-
-                        switch(paddingCounter) {
-                            case 3U: paddingCounter = 6U; break;
-                            case 1U: paddingCounter = 4U; break;
-                            case 0U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            if(not result.isValid) {
+                output_.Resize(0);
 
-                        break;
-                    }
-                    case 4U: {
-                        bitset <<= ((charSize * 5) / 8) * 4;
+                throw ErrorType(ErrorType::Type::STRING_PARSE_ERROR);
+            }
 
-                        switch(paddingCounter) {
-                            case 2U: paddingCounter = 6U; break;
-                            case 0U: paddingCounter = 4U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            output_.Resize(result.size);
+        }
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= ((charSize * 5) / 8) * 5;
+        /**
+         * Validates an input of a codec that decodes groups of characters independently of each other, by decoding it chunk by chunk into a small
+         * buffer on the stack with the actual decoding function (vectorized kernels included), so the rules are exactly the ones of the decoder.
+         * Decoders stop after a padded group, which shows up as a chunk that is decoded into fewer bytes than it has whole groups.
+         *
+         * @tparam groupSize_ Amount of characters in a group.
+         * @tparam decodedGroupSize_ Amount of bytes a whole group is decoded into.
+         * @param[in] input_ Characters to be validated.
+         * @param[in] decode_ Internal decoding function that takes the input, its size and the output.
+         * @returns Whether or not the input is valid, its decoded size and the offset of the first group that cannot be decoded.
+        */
+        template<std::size_t groupSize_, std::size_t decodedGroupSize_, typename DecodeFunction>
+        ValidationResult ValidateGroups(const std::string_view input_, const DecodeFunction& decode_) noexcept
+        {
+            constexpr std::size_t chunkGroupCount(512);
+            std::array<unsigned char, chunkGroupCount * decodedGroupSize_> output;
+            std::size_t decodedSize(0);
 
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            for(std::size_t i(0); i < input_.size(); i += chunkGroupCount * groupSize_) {
+                const std::size_t chunkSize(std::min(chunkGroupCount * groupSize_, input_.size() - i));
+                const DecodeResult result(decode_(input_.data() + i, chunkSize, output.data()));
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 5) / 8) * 6;
+                if(not result.isValid) {
+                    // Groups before a padded one are never invalid, so the chunk can be decoded group by group to find the one that failed
+                    for(std::size_t j(0); j < chunkSize; j += groupSize_) {
+                        const DecodeResult groupResult(decode_(input_.data() + i + j, std::min(groupSize_, chunkSize - j), output.data()));
 
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                        if(not groupResult.isValid) {
+                            return ValidationResult{false, decodedSize, i + j};
                         }
 
-                        break;
+                        decodedSize += groupResult.size;
                     }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
                 }
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
-
-                        break;
-                    }
-                    case 1U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-
-                        break;
-                    }
-                    case 3U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-
-                        break;
-                    }
-                    case 4U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-
-                        break;
-                    }
-                    case 6U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()))); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
+                decodedSize += result.size;
 
-                if(paddingCounter > 0U) {
+                if(result.size < (chunkSize / groupSize_) * decodedGroupSize_) {
                     break;
                 }
             }
 
-            return decodedString;
+            return ValidationResult{true, decodedSize, input_.size()};
         }
+
         /**
-         * @brief Decodes a Base32 encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base32::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @brief Checks whether a character is skipped by the decoding functions that take IgnoreWhitespace.
+         * @param[in] character_ Character to be checked.
+         * @returns Whether or not the character is a space, tab, newline, vertical tab, form feed or carriage return.
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_)
+        constexpr bool IsWhitespace(const char character_) noexcept { return character_ == ' ' or (character_ >= '\t' and character_ <= '\r'); }
+
+        /**
+         * Calls a function for every run of characters between whitespace, so that a decoder which does not know about whitespace processes the runs
+         * right where they are in the input instead of a copy without whitespace. Stops as soon as the function returns false.
+         *
+         * @param[in] input_ Characters to be split into runs.
+         * @param[in] inputSize_ Amount of characters.
+         * @param[in] function_ Function that takes a run and its size and returns whether or not to go on.
+        */
+        template<typename RunFunction>
+        void ForEachRun(const char* input_, const std::size_t inputSize_, const RunFunction& function_) noexcept
         {
-            using Internal::charSize;
+            std::size_t i(0);
 
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
-            auto addToByteBuffer = [&decodedByteBuffer, &byteBuffer, &bufferIterator](const unsigned char byte_) -> void {
-                if(bufferIterator < 8192) {
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
+            while(i < inputSize_) {
+                if(IsWhitespace(input_[i])) {
+                    ++i;
 
-                    bufferIterator += 1;
-                } else {
-                    decodedByteBuffer += byteBuffer;
-                    bufferIterator = 0;
+                    continue;
+                }
 
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
+                std::size_t end(i + 1);
 
-                    bufferIterator += 1;
+                while(end < inputSize_ and not IsWhitespace(input_[end])) {
+                    ++end;
                 }
-            };
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
+                if(not function_(input_ + i, end - i)) {
+                    return;
+                }
 
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 5) / 8;
+                i = end;
+            }
+        }
 
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
+        /**
+         * @brief Calculates the size of encoded characters once they are split into lines.
+         * @param[in] size_ Amount of encoded characters.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @returns Amount of characters including the separators.
+        */
+        constexpr std::size_t WrappedSize(const std::size_t size_, const LineWrapping& lineWrapping_) noexcept
+        {
+            if(size_ == 0 or lineWrapping_.lineLength == 0) {
+                return size_;
+            }
 
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
-                        iter = jter;
+            return size_ + (((size_ - 1) / lineWrapping_.lineLength) * lineWrapping_.separator.size());
+        }
 
-                        break;
-                    }
+        /**
+         * Checks that a file of the given size can be encoded or decoded without the output size overflowing an std::uint64_t. Every group of
+         * bytesPerGroup_ input units becomes charactersPerGroup_ output units and extraSize_ units come on top (such as the delimiters of Ascii85).
+         *
+         * @param[in] size_ Size of the input.
+         * @param[in] bytesPerGroup_ Input units in a whole group.
+         * @param[in] charactersPerGroup_ Output units a whole group turns into.
+         * @param[in] extraSize_ Output units that are added once.
+         * @returns The given size.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t CheckFileSize(const std::uint64_t size_, const std::uint64_t bytesPerGroup_, const std::uint64_t charactersPerGroup_,
+                                              const std::uint64_t extraSize_ = 0)
+        {
+            // Rounded down to whole groups, an incomplete last group never has more characters than a whole one
+            if(size_ > ((std::numeric_limits<std::uint64_t>::max() - extraSize_ - charactersPerGroup_) / charactersPerGroup_) * bytesPerGroup_) {
+                throw std::length_error("The output size does not fit into 64 bits");
+            }
+
+            return size_;
+        }
+
+        /**
+         * Writes the characters of an encoder line by line. An encoder asks for the room left in the current line, encodes as many whole groups as fit
+         * directly into the output and only hands groups that have to be split between two lines to Write.
+        */
+        class LineWriter
+        {
+        public:
+            /**
+             * @brief Starts the first line.
+             * @param[out] output_ Where the lines are written to, must have room for WrappedSize characters.
+             * @param[in] lineWrapping_ Line length, which must not be 0, and separator.
+            */
+            LineWriter(char* output_, const LineWrapping& lineWrapping_) noexcept :
+                _output(output_),
+                _lineWrapping(lineWrapping_),
+                _size(0),
+                _column(0)
+            {
+            }
+
+            /**
+             * @brief Writes the separator if the current line is full. Only to be called when more characters follow.
+             * @returns Amount of characters that fit into the current line.
+            */
+            std::size_t StartLine() noexcept
+            {
+                if(_column == _lineWrapping.lineLength) {
+                    std::copy_n(_lineWrapping.separator.data(), _lineWrapping.separator.size(), _output + _size);
+                    _size += _lineWrapping.separator.size();
+                    _column = 0;
                 }
 
-                switch(loopCounter) {
-                    case 8U: break;
-                    case 7U: {
-                        bitset <<= (charSize * 5) / 8;
+                return _lineWrapping.lineLength - _column;
+            }
+            /// @returns Where the next character is written to.
+            char* GetPosition() const noexcept { return _output + _size; }
+            /// @brief Counts characters written to GetPosition directly, at most as many as StartLine allowed.
+            void Advance(const std::size_t size_) noexcept
+            {
+                _size += size_;
+                _column += size_;
+            }
+            /**
+             * @brief Writes characters, starting as many lines as needed.
+             * @param[in] characters_ Characters to be written.
+             * @param[in] size_ Amount of characters.
+            */
+            void Write(const char* characters_, const std::size_t size_) noexcept
+            {
+                for(std::size_t i(0); i < size_;) {
+                    const std::size_t size(std::min(size_ - i, StartLine()));
 
-                        switch(paddingCounter) {
-                            case 5U: paddingCounter = 6U; break;
-                            case 3U: paddingCounter = 4U; break;
-                            case 2U: paddingCounter = 3U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                    std::copy_n(characters_ + i, size, GetPosition());
+                    Advance(size);
+                    i += size;
+                }
+            }
+            /// @returns Amount of characters written, including the separators.
+            std::size_t GetSize() const noexcept { return _size; }
 
-                        break;
-                    }
-                    case 6U: {
-                        bitset <<= ((charSize * 5) / 8) * 2;
-
-                        switch(paddingCounter) {
-                            case 4U: paddingCounter = 6U; break;
-                            case 2U: paddingCounter = 4U; break;
-                            case 1U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        private:
+            char* _output;
+            LineWrapping _lineWrapping;
+            std::size_t _size;
+            std::size_t _column;
+        };
 
-                        break;
-                    }
-                    case 5U: {
-                        bitset <<= ((charSize * 5) / 8) * 3;
-
-                        switch(paddingCounter) {
-                            case 3U: paddingCounter = 6U; break;
-                            case 1U: paddingCounter = 4U; break;
-                            case 0U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        /**
+         * @brief Category of the error codes set by the non-throwing functions of a codec namespace.
+         * @tparam ErrorType Error class of the codec namespace. Error code values are its Type values plus one, as zero means success.
+        */
+        template<typename ErrorType>
+        class ErrorCategory : public std::error_category
+        {
+        public:
+            /**
+             * @brief Creates an ErrorCategory.
+             * @param[in] name_ Name of the category.
+            */
+            explicit ErrorCategory(const char* name_) noexcept :
+                _name(name_)
+            {}
 
-                        break;
-                    }
-                    case 4U: {
-                        bitset <<= ((charSize * 5) / 8) * 4;
+            const char* name() const noexcept override { return _name; }
+            std::string message(const int value_) const override { return ErrorType(static_cast<typename ErrorType::Type>(value_ - 1)).What(); }
 
-                        switch(paddingCounter) {
-                            case 2U: paddingCounter = 6U; break;
-                            case 0U: paddingCounter = 4U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        private:
+            const char* _name;
+        };
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= ((charSize * 5) / 8) * 5;
+        /**
+         * @brief Bytes kept by a streaming encoder until they fill a whole group.
+         * @tparam groupSize_ Amount of bytes in a whole group.
+        */
+        template<std::size_t groupSize_>
+        struct GroupEncodeState
+        {
+            std::array<unsigned char, groupSize_> pending{}; ///< Kept bytes.
+            std::size_t pendingSize = 0;                     ///< Amount of kept bytes.
+        };
 
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        /**
+         * @brief Characters kept by a streaming decoder until they fill a whole group.
+         * @tparam groupSize_ Amount of characters in a whole group.
+         * @tparam decodedGroupSize_ Amount of bytes a whole group without padding is decoded into.
+        */
+        template<std::size_t groupSize_, std::size_t decodedGroupSize_>
+        struct GroupDecodeState
+        {
+            std::array<char, groupSize_> pending{}; ///< Kept characters.
+            std::size_t pendingSize = 0;            ///< Amount of kept characters.
+            bool isFinished = false;                ///< Whether or not a padded group was decoded, everything after it is ignored.
+        };
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 5) / 8) * 6;
+        /**
+         * Encodes the whole groups available in the kept bytes and the input, and keeps the rest for the next call.
+         * 
+         * @param[in,out] state_ Bytes kept from previous calls.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] encode_ Function that encodes (input, inputSize, output) and returns the amount of characters written.
+         * @returns Amount of characters written.
+        */
+        template<std::size_t groupSize_, typename EncodeFunction>
+        std::size_t UpdateGroupEncoder(GroupEncodeState<groupSize_>& state_, const unsigned char* input_, std::size_t inputSize_, char* output_,
+                                       const EncodeFunction& encode_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, inputSize_);
+            std::size_t written(0);
 
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            if(state_.pendingSize > 0) {
+                const std::size_t amount(std::min(groupSize_ - state_.pendingSize, inputSize_));
 
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
+                std::copy_n(input_, amount, state_.pending.begin() + static_cast<std::ptrdiff_t>(state_.pendingSize));
+                state_.pendingSize += amount;
+                input_ += amount;
+                inputSize_ -= amount;
+
+                if(state_.pendingSize < groupSize_) {
+                    return 0;
                 }
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>(bitset.to_ullong()));
+                written = encode_(state_.pending.data(), groupSize_, output_);
+                state_.pendingSize = 0;
+            }
 
-                        break;
-                    }
-                    case 1U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
+            const std::size_t wholeSize(inputSize_ - (inputSize_ % groupSize_));
 
-                        break;
-                    }
-                    case 3U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
+            written += encode_(input_, wholeSize, output_ + written);
+            state_.pendingSize = inputSize_ - wholeSize;
+            std::copy_n(input_ + wholeSize, state_.pendingSize, state_.pending.begin());
 
-                        break;
-                    }
-                    case 4U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
+            return timer.CountOutput(written);
+        }
 
-                        break;
-                    }
-                    case 6U: addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
+        /**
+         * @brief Encodes the bytes kept for an incomplete group at the end of the input.
+         * @param[in,out] state_ Bytes kept from previous calls, cleared afterwards.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] encode_ Function that encodes (input, inputSize, output) and returns the amount of characters written.
+         * @returns Amount of characters written.
+        */
+        template<std::size_t groupSize_, typename EncodeFunction>
+        std::size_t FinishGroupEncoder(GroupEncodeState<groupSize_>& state_, char* output_, const EncodeFunction& encode_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, state_.pendingSize);
+            const std::size_t written(encode_(state_.pending.data(), state_.pendingSize, output_));
+
+            state_ = GroupEncodeState<groupSize_>();
+
+            return timer.CountOutput(written);
+        }
+
+        /**
+         * Decodes the whole groups available in the kept characters and the input, and keeps the rest for the next call. Once a padded group has been
+         * decoded the rest of the input is ignored.
+         * 
+         * @param[in,out] state_ Characters kept from previous calls.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] decode_ Function that decodes (input, inputSize, output) and returns a DecodeResult.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        template<std::size_t groupSize_, std::size_t decodedGroupSize_, typename DecodeFunction>
+        DecodeResult UpdateGroupDecoder(GroupDecodeState<groupSize_, decodedGroupSize_>& state_, const char* input_, std::size_t inputSize_,
+                                        unsigned char* output_, const DecodeFunction& decode_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            std::size_t written(0);
+
+            if(state_.isFinished) {
+                return timer.CountOutput(DecodeResult{0, true});
+            } else if(state_.pendingSize > 0) {
+                const std::size_t amount(std::min(groupSize_ - state_.pendingSize, inputSize_));
+
+                std::copy_n(input_, amount, state_.pending.begin() + static_cast<std::ptrdiff_t>(state_.pendingSize));
+                state_.pendingSize += amount;
+                input_ += amount;
+                inputSize_ -= amount;
+
+                if(state_.pendingSize < groupSize_) {
+                    return timer.CountOutput(DecodeResult{0, true});
                 }
 
-                if(paddingCounter > 0U) {
-                    break;
+                const DecodeResult result(decode_(state_.pending.data(), groupSize_, output_));
+
+                state_.pendingSize = 0;
+
+                if(not result.isValid or result.size < decodedGroupSize_) {
+                    state_.isFinished = true;
+
+                    return timer.CountOutput(result);
                 }
+
+                written = result.size;
             }
 
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+            const std::size_t wholeSize(inputSize_ - (inputSize_ % groupSize_));
+            const DecodeResult result(decode_(input_, wholeSize, output_ + written));
+
+            written += result.size;
 
-                decodedByteBuffer += byteBuffer;
+            if(not result.isValid or result.size < (wholeSize / groupSize_) * decodedGroupSize_) {
+                state_.isFinished = true;
+
+                return timer.CountOutput(DecodeResult{written, result.isValid});
             }
 
-            return decodedByteBuffer;
+            state_.pendingSize = inputSize_ - wholeSize;
+            std::copy_n(input_ + wholeSize, state_.pendingSize, state_.pending.begin());
+
+            return timer.CountOutput(DecodeResult{written, true});
         }
-    };
 
-    /// @brief A namespace that has functions that implement Base32Hex encoding and decoding in accordance to RFC 4648 §7.
-    namespace Base32Hex
-    {
-        /// @brief A simple error class for the Base32Hex namespace.
-        class Error : public std::exception
+        /**
+         * @brief Decodes the characters kept for an incomplete group at the end of the input.
+         * @param[in,out] state_ Characters kept from previous calls, cleared afterwards.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] decode_ Function that decodes (input, inputSize, output) and returns a DecodeResult.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        template<std::size_t groupSize_, std::size_t decodedGroupSize_, typename DecodeFunction>
+        DecodeResult FinishGroupDecoder(GroupDecodeState<groupSize_, decodedGroupSize_>& state_, unsigned char* output_,
+                                        const DecodeFunction& decode_) noexcept
         {
-        public:
-            /// @brief The type of Error.
-            enum class Type
-            {
-                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
-            };
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, state_.pendingSize);
+            DecodeResult result{0, true};
 
-            /**
-             * @brief Creates an Error of given Type.
-             * @param[in] type_ Type of Error.
-             * @param[in] sourceLocation_ Source location of Error.
-            */
-            explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
-                _type(type_),
-                _sourceLocation(sourceLocation_)
-            {
-                switch(_type) {
-                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
-                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
-                    default: _what = "Invalid error type"; break;
+            if(not state_.isFinished and state_.pendingSize > 0) {
+                result = decode_(state_.pending.data(), state_.pendingSize, output_);
+            }
+
+            state_ = GroupDecodeState<groupSize_, decodedGroupSize_>();
+
+            return timer.CountOutput(result);
+        }
+
+        /// @brief Least amount of input given to a thread, splitting smaller inputs costs more than it gains.
+        constexpr std::size_t minimumParallelChunkSize = 1 << 20;
+
+        /**
+         * @brief Calculates how many chunks an input is split into for parallel encoding or decoding.
+         * @param[in] threadCount_ Requested amount of threads, 0 for one per hardware thread.
+         * @param[in] inputSize_ Size of the input.
+         * @returns Amount of chunks, 1 if the input should not be split.
+        */
+        inline std::size_t GetChunkCount(const std::size_t threadCount_, const std::size_t inputSize_) noexcept
+        {
+            const std::size_t chunkCount((threadCount_ == 0) ? std::thread::hardware_concurrency() : threadCount_);
+
+            return std::max<std::size_t>(std::min(chunkCount, inputSize_ / minimumParallelChunkSize), 1);
+        }
+
+        /**
+         * Calls function_ once for every chunk index below chunkCount_, each call on its own thread. The calling thread takes the last chunk and every
+         * chunk for which no thread could be started, so all chunks are processed even if threads are unavailable.
+         *
+         * @param[in] chunkCount_ Amount of chunks.
+         * @param[in] function_ Function that processes (chunkIndex), it must not throw.
+        */
+        template<typename ChunkFunction>
+        void RunChunksInParallel(const std::size_t chunkCount_, const ChunkFunction& function_) noexcept
+        {
+            std::vector<std::thread> threads;
+            std::size_t i(0);
+
+            try {
+                threads.reserve(chunkCount_ - 1);
+
+                for(; i + 1 < chunkCount_; ++i) {
+                    threads.emplace_back([&function_, i]() noexcept { function_(i); });
                 }
+            } catch(const std::exception&) {}
+
+            for(; i < chunkCount_; ++i) {
+                function_(i);
             }
 
-            /**
-             * @brief Gets the Type of the Error.
-             * @returns Type of Error.
-            */
-            Type GetType() const noexcept { return _type; }
-            /**
-             * @brief Gets the location at which the Error was thrown.
-             * @returns Source location of Error.
-            */
-            std::source_location GetSourceLocation() const { return _sourceLocation; }
-            /**
-             * @brief Gets reason for the Error.
-             * @returns Reason for the Error.
-            */
-            std::string What() const { return _what; }
+            for(std::thread& thread : threads) {
+                thread.join();
+            }
+        }
 
-            // For C++ compatibility purposes
+        /**
+         * Encodes bytes on several threads. Every whole group is encoded into a fixed amount of characters, so the input is split at group boundaries and
+         * each chunk is written straight to its final position. Only the last chunk can end with an incomplete group.
+         *
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @param[in] encode_ Function that encodes (input, inputSize, output) and returns the amount of characters written.
+         * @returns Amount of characters written.
+        */
+        template<std::size_t groupSize_, std::size_t encodedGroupSize_, typename EncodeFunction>
+        std::size_t EncodeGroupsInParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const std::size_t threadCount_,
+                                           const EncodeFunction& encode_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, inputSize_);
+            const std::size_t chunkCount(GetChunkCount(threadCount_, inputSize_));
 
-            const char* what() const noexcept override { return _what.c_str(); }
+            if(chunkCount == 1) {
+                return timer.CountOutput(encode_(input_, inputSize_, output_));
+            }
 
-        private:
-            Type _type;
-            std::source_location _sourceLocation;
-            std::string _what;
-        };
+            const std::size_t chunkSize(((inputSize_ / chunkCount) / groupSize_) * groupSize_);
+            const std::size_t lastOffset(chunkSize * (chunkCount - 1));
+            std::size_t lastWritten(0);
+
+            RunChunksInParallel(chunkCount, [&](const std::size_t chunk_) noexcept {
+                const std::size_t offset(chunk_ * chunkSize);
+                char* const output(output_ + ((offset / groupSize_) * encodedGroupSize_));
+
+                if(offset == lastOffset) {
+                    lastWritten = encode_(input_ + offset, inputSize_ - offset, output);
+                } else {
+                    encode_(input_ + offset, chunkSize, output);
+                }
+            });
 
-        static_assert(Internal::charSize == 8, "These Base32Hex functions only works if a char is 8 bits big");
+            return timer.CountOutput(((lastOffset / groupSize_) * encodedGroupSize_) + lastWritten);
+        }
 
         /**
-         * @brief Encodes a not-encoded string into a Base32Hex encoded string.
-         * @param[in] string_ String to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base32Hex::Error
+         * Decodes characters on several threads. The input is split at group boundaries and each chunk is written straight to its final position. A padded
+         * group or an invalid character before the last chunk changes where decoding stops, the input is then decoded again on the calling thread.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @param[in] decode_ Function that decodes (input, inputSize, output) and returns a DecodeResult.
+         * @returns Amount of bytes written and whether or not the input was valid.
         */
-        std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+        template<std::size_t groupSize_, std::size_t decodedGroupSize_, typename DecodeFunction>
+        DecodeResult DecodeGroupsInParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_, const std::size_t threadCount_,
+                                            const DecodeFunction& decode_) noexcept
         {
-            using Internal::charSize;
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            const std::size_t chunkCount(GetChunkCount(threadCount_, inputSize_));
 
-            std::string encodedString;
+            if(chunkCount == 1) {
+                return timer.CountOutput(decode_(input_, inputSize_, output_));
+            }
 
-            try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 5.0) * 8.0));
+            const std::size_t chunkSize(((inputSize_ / chunkCount) / groupSize_) * groupSize_);
+            const std::size_t lastOffset(chunkSize * (chunkCount - 1));
+            DecodeResult lastResult{0, true};
+            std::atomic<bool> isComplete(true);
+
+            RunChunksInParallel(chunkCount, [&](const std::size_t chunk_) noexcept {
+                const std::size_t offset(chunk_ * chunkSize);
+                unsigned char* const output(output_ + ((offset / groupSize_) * decodedGroupSize_));
+
+                if(offset == lastOffset) {
+                    lastResult = decode_(input_ + offset, inputSize_ - offset, output);
+                } else if(const DecodeResult result(decode_(input_ + offset, chunkSize, output));
+                          not result.isValid or result.size != (chunkSize / groupSize_) * decodedGroupSize_) {
+                    isComplete.store(false, std::memory_order_relaxed);
                 }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            });
+
+            if(not isComplete.load(std::memory_order_relaxed)) {
+                return timer.CountOutput(decode_(input_, inputSize_, output_));
             }
 
-            for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int counter(0U);
+            return timer.CountOutput(DecodeResult{((lastOffset / groupSize_) * decodedGroupSize_) + lastResult.size, lastResult.isValid});
+        }
 
-                for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+        /**
+         * @brief Creates a table that maps every character to its position in an alphabet.
+         * @param[in] alphabet_ Alphabet to be used.
+         * @returns Table that holds the position of each character of the alphabet and invalidSymbol for everything else.
+        */
+        consteval std::array<unsigned char, 256> MakeDecodeTable(const std::string_view alphabet_)
+        {
+            std::array<unsigned char, 256> table{};
 
-                    if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 5)) {
-                        iter = jter;
+            table.fill(invalidSymbol);
 
-                        break;
-                    }
+            for(std::size_t i(0); i < alphabet_.size(); ++i) {
+                table[static_cast<unsigned char>(alphabet_[i])] = static_cast<unsigned char>(i);
+            }
+
+            return table;
+        }
+
+        /**
+         * @brief Creates a table that maps every byte to its two Base16 digits.
+         * @param[in] digits_ The 16 digits to be used.
+         * @returns Table where positions 2 * byte and 2 * byte + 1 hold the high and low digit of the byte.
+        */
+        consteval std::array<char, 512> MakeBase16EncodeTable(const std::string_view digits_)
+        {
+            std::array<char, 512> table{};
+
+            for(std::size_t i(0); i < 256; ++i) {
+                table[i * 2] = digits_[i >> 4];
+                table[(i * 2) + 1] = digits_[i & 0x0F];
+            }
+
+            return table;
+        }
+
+        /**
+         * @brief Creates a table that maps every character to its Base16 value.
+         * @param[in] acceptUppercase_ Whether or not A-F are accepted.
+         * @param[in] acceptLowercase_ Whether or not a-f are accepted.
+         * @returns Table that holds the value of each digit, ignoredSymbol for whitespace and newline characters and invalidSymbol for everything else.
+        */
+        consteval std::array<unsigned char, 256> MakeBase16DecodeTable(const bool acceptUppercase_, const bool acceptLowercase_)
+        {
+            std::array<unsigned char, 256> table{};
+
+            table.fill(invalidSymbol);
+            table[static_cast<unsigned char>(' ')] = ignoredSymbol;
+            table[static_cast<unsigned char>('\n')] = ignoredSymbol;
+
+            for(unsigned char i(0); i < 10; ++i) {
+                table[static_cast<unsigned char>('0' + i)] = i;
+            }
+
+            for(unsigned char i(0); i < 6; ++i) {
+                if(acceptUppercase_) table[static_cast<unsigned char>('A' + i)] = static_cast<unsigned char>(10 + i);
+                if(acceptLowercase_) table[static_cast<unsigned char>('a' + i)] = static_cast<unsigned char>(10 + i);
+            }
+
+            return table;
+        }
+
+        constexpr std::string_view base16UppercaseDigits = "0123456789ABCDEF";
+        constexpr std::string_view base16LowercaseDigits = "0123456789abcdef";
+        constexpr std::array<char, 512> base16UppercaseEncodeTable = MakeBase16EncodeTable(base16UppercaseDigits);
+        constexpr std::array<char, 512> base16LowercaseEncodeTable = MakeBase16EncodeTable(base16LowercaseDigits);
+        constexpr std::array<unsigned char, 256> base16UppercaseDecodeTable = MakeBase16DecodeTable(true, false);
+        constexpr std::array<unsigned char, 256> base16LowercaseDecodeTable = MakeBase16DecodeTable(false, true);
+        constexpr std::array<unsigned char, 256> base16MixedDecodeTable = MakeBase16DecodeTable(true, true);
+
+        /**
+         * Signature of the vectorized Base16 encoding functions. They encode as many whole blocks as they can and leave the rest for the scalar code.
+         * The output must have room for the entire encoded input.
+         *
+         * Arguments are the input bytes, the amount of input bytes, the output and the 16 digits to be used.
+         * The amount of input bytes consumed is returned.
+        */
+        using Base16EncodeBlocksFunction = std::size_t (*)(const unsigned char*, std::size_t, char*, const char*) noexcept;
+        /**
+         * Signature of the vectorized Base16 decoding functions. They decode whole blocks until one contains a character that is not a digit of the
+         * case (whitespace and newline characters included) and leave the rest for the scalar code. The output must have room for half of the input.
+         *
+         * Arguments are the input characters, the amount of input characters, the output, whether or not A-F and whether or not a-f are accepted.
+         * The amount of input characters consumed (always a multiple of 2) is returned.
+        */
+        using Base16DecodeBlocksFunction = std::size_t (*)(const char*, std::size_t, unsigned char*, bool, bool) noexcept;
+
+        /// @brief Vectorized Base16 functions picked for an InstructionSet.
+        struct Base16Kernels
+        {
+            Base16EncodeBlocksFunction encodeBlocks; ///< Block encoder, can be nullptr.
+            Base16DecodeBlocksFunction decodeBlocks; ///< Block decoder, can be nullptr.
+        };
+
+#if defined(BINARYTEXT_X86_SIMD)
+        /// @brief Base16EncodeBlocksFunction that handles 16 bytes per iteration using SSE4.1.
+        BINARYTEXT_TARGET("sse4.1") inline std::size_t EncodeBase16BlocksSse41(const unsigned char* input_, const std::size_t size_, char* output_,
+                                                                               const char* digits_) noexcept
+        {
+            const __m128i table(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits_)));
+            std::size_t i(0);
+
+            for(; i + 16 <= size_; i += 16, output_ += 32) {
+                const __m128i bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i)));
+                const __m128i high(_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F)));
+                const __m128i low(_mm_and_si128(bytes, _mm_set1_epi8(0x0F)));
+
+                // Each nibble picks its digit out of the table and the high digit of a byte comes first
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_), _mm_shuffle_epi8(table, _mm_unpacklo_epi8(high, low)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_ + 16), _mm_shuffle_epi8(table, _mm_unpackhi_epi8(high, low)));
+            }
+
+            return i;
+        }
+
+        /// @brief Base16DecodeBlocksFunction that handles 16 characters per iteration using SSE4.1.
+        BINARYTEXT_TARGET("sse4.1") inline std::size_t DecodeBase16BlocksSse41(const char* input_, const std::size_t size_, unsigned char* output_,
+                                                                               const bool acceptUppercase_, const bool acceptLowercase_) noexcept
+        {
+            // Mixed case turns A-F into a-f by setting bit 5, which leaves the digits as they are and turns nothing else into a-f
+            const __m128i caseBit(_mm_set1_epi8((acceptUppercase_ and acceptLowercase_) ? 0x20 : 0));
+            const __m128i letterFirst(_mm_set1_epi8(acceptLowercase_ ? 'a' - 1 : 'A' - 1));
+            const __m128i letterLast(_mm_set1_epi8(acceptLowercase_ ? 'f' + 1 : 'F' + 1));
+            const __m128i letterShift(_mm_set1_epi8(static_cast<char>(acceptLowercase_ ? 10 - 'a' : 10 - 'A')));
+            std::size_t i(0);
+
+            for(; i + 16 <= size_; i += 16, output_ += 8) {
+                const __m128i characters(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i)));
+                const __m128i letters(_mm_or_si128(characters, caseBit));
+                const __m128i digit(_mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), characters)));
+                const __m128i letter(_mm_and_si128(_mm_cmpgt_epi8(letters, letterFirst), _mm_cmpgt_epi8(letterLast, letters)));
+
+                if(_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF) {
+                    break;
                 }
 
-                switch(counter) {
-                    case 5U: counter = 8U; break;
-                    case 4U: {
-                        bitset <<= charSize;
-                        counter = 7U;
+                const __m128i values(_mm_blendv_epi8(_mm_add_epi8(letters, letterShift), _mm_sub_epi8(characters, _mm_set1_epi8('0')), digit));
+                // Every pair of digits becomes high * 16 + low in a 16-bit element, which is then packed into a byte
+                const __m128i bytes(_mm_maddubs_epi16(values, _mm_set1_epi16(0x0110)));
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= (charSize * 2);
-                        counter = 5U;
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(output_), _mm_packus_epi16(bytes, bytes));
+            }
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (charSize * 3);
-                        counter = 4U;
+            return i;
+        }
+
+        /// @brief Base16EncodeBlocksFunction that handles 32 bytes per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t EncodeBase16BlocksAvx2(const unsigned char* input_, const std::size_t size_, char* output_,
+                                                                            const char* digits_) noexcept
+        {
+            const __m256i table(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits_))));
+            std::size_t i(0);
+
+            for(; i + 32 <= size_; i += 32, output_ += 64) {
+                // Unpacking works per lane, so the quarters are put in the order 0, 2, 1, 3 first for the digits to come out in order
+                const __m256i bytes(_mm256_permute4x64_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input_ + i)), _MM_SHUFFLE(3, 1, 2, 0)));
+                const __m256i high(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F)));
+                const __m256i low(_mm256_and_si256(bytes, _mm256_set1_epi8(0x0F)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_), _mm256_shuffle_epi8(table, _mm256_unpacklo_epi8(high, low)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_ + 32), _mm256_shuffle_epi8(table, _mm256_unpackhi_epi8(high, low)));
+            }
+
+            return i + EncodeBase16BlocksSse41(input_ + i, size_ - i, output_, digits_);
+        }
+
+        /// @brief Base16DecodeBlocksFunction that handles 32 characters per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t DecodeBase16BlocksAvx2(const char* input_, const std::size_t size_, unsigned char* output_,
+                                                                            const bool acceptUppercase_, const bool acceptLowercase_) noexcept
+        {
+            const __m256i caseBit(_mm256_set1_epi8((acceptUppercase_ and acceptLowercase_) ? 0x20 : 0));
+            const __m256i letterFirst(_mm256_set1_epi8(acceptLowercase_ ? 'a' - 1 : 'A' - 1));
+            const __m256i letterLast(_mm256_set1_epi8(acceptLowercase_ ? 'f' + 1 : 'F' + 1));
+            const __m256i letterShift(_mm256_set1_epi8(static_cast<char>(acceptLowercase_ ? 10 - 'a' : 10 - 'A')));
+            std::size_t i(0);
+
+            for(; i + 32 <= size_; i += 32, output_ += 16) {
+                const __m256i characters(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input_ + i)));
+                const __m256i letters(_mm256_or_si256(characters, caseBit));
+                const __m256i digit(
+                    _mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters)));
+                const __m256i letter(_mm256_and_si256(_mm256_cmpgt_epi8(letters, letterFirst), _mm256_cmpgt_epi8(letterLast, letters)));
+
+                if(_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1) {
+                    break;
+                }
+
+                const __m256i values(_mm256_blendv_epi8(_mm256_add_epi8(letters, letterShift), _mm256_sub_epi8(characters, _mm256_set1_epi8('0')), digit));
+                // Packing works per lane, so the 8 bytes of each lane are moved next to each other afterwards
+                const __m256i bytes(_mm256_packus_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110)), _mm256_setzero_si256()));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_), _mm256_castsi256_si128(_mm256_permute4x64_epi64(bytes, _MM_SHUFFLE(3, 1, 2, 0))));
+            }
+
+            return i + DecodeBase16BlocksSse41(input_ + i, size_ - i, output_, acceptUppercase_, acceptLowercase_);
+        }
+#endif
+
+#if defined(BINARYTEXT_NEON_SIMD)
+        /// @brief Base16EncodeBlocksFunction that handles 16 bytes per iteration using NEON.
+        inline std::size_t EncodeBase16BlocksNeon(const unsigned char* input_, const std::size_t size_, char* output_, const char* digits_) noexcept
+        {
+            const uint8x16_t table(vld1q_u8(reinterpret_cast<const std::uint8_t*>(digits_)));
+            std::size_t i(0);
+
+            for(; i + 16 <= size_; i += 16, output_ += 32) {
+                const uint8x16_t bytes(vld1q_u8(input_ + i));
+                uint8x16x2_t characters;
+
+                characters.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+                characters.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+
+                vst2q_u8(reinterpret_cast<std::uint8_t*>(output_), characters);
+            }
+
+            return i;
+        }
+
+        /// @brief Base16DecodeBlocksFunction that handles 32 characters per iteration using NEON.
+        inline std::size_t DecodeBase16BlocksNeon(const char* input_, const std::size_t size_, unsigned char* output_, const bool acceptUppercase_,
+                                                  const bool acceptLowercase_) noexcept
+        {
+            const uint8x16_t caseBit(vdupq_n_u8((acceptUppercase_ and acceptLowercase_) ? 0x20 : 0));
+            const uint8x16_t letterFirst(vdupq_n_u8(acceptLowercase_ ? 'a' : 'A'));
+            std::size_t i(0);
+
+            for(; i + 32 <= size_; i += 32, output_ += 16) {
+                const uint8x16x2_t characters(vld2q_u8(reinterpret_cast<const std::uint8_t*>(input_ + i)));
+                uint8x16x2_t values;
+                uint8x16_t valid(vdupq_n_u8(0xFF));
+
+                // A digit or a letter is a small value after subtracting the first one, everything else wraps around to something larger
+                for(int j(0); j < 2; ++j) {
+                    const uint8x16_t digit(vsubq_u8(characters.val[j], vdupq_n_u8('0')));
+                    const uint8x16_t letter(vsubq_u8(vorrq_u8(characters.val[j], caseBit), letterFirst));
+                    const uint8x16_t isDigit(vcltq_u8(digit, vdupq_n_u8(10)));
+
+                    values.val[j] = vbslq_u8(isDigit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+                    valid = vandq_u8(valid, vorrq_u8(isDigit, vcltq_u8(letter, vdupq_n_u8(6))));
+                }
+
+                if(vminvq_u8(valid) == 0) {
+                    break;
+                }
+
+                vst1q_u8(output_, vorrq_u8(vshlq_n_u8(values.val[0], 4), values.val[1]));
+            }
+
+            return i;
+        }
+#endif
+
+        /**
+         * @brief Picks the vectorized Base16 functions for an InstructionSet.
+         * @param[in] instructionSet_ InstructionSet to be used. It must be supported by the processor.
+         * @returns Picked functions.
+        */
+        inline Base16Kernels MakeBase16Kernels(const InstructionSet instructionSet_) noexcept
+        {
+            switch(instructionSet_) {
+#if defined(BINARYTEXT_X86_SIMD)
+                case InstructionSet::AVX2: return Base16Kernels{&EncodeBase16BlocksAvx2, &DecodeBase16BlocksAvx2};
+                case InstructionSet::SSE4_1: return Base16Kernels{&EncodeBase16BlocksSse41, &DecodeBase16BlocksSse41};
+#endif
+#if defined(BINARYTEXT_NEON_SIMD)
+                case InstructionSet::NEON: return Base16Kernels{&EncodeBase16BlocksNeon, &DecodeBase16BlocksNeon};
+#endif
+                default: return Base16Kernels{nullptr, nullptr};
+            }
+        }
+
+        /**
+         * @brief Gets the vectorized Base16 functions for the InstructionSet in use. They are picked once and cached afterwards.
+         * @returns Picked functions.
+        */
+        inline const Base16Kernels& GetBase16Kernels() noexcept
+        {
+            static const Base16Kernels kernels(MakeBase16Kernels(GetInstructionSet()));
+
+            return kernels;
+        }
+
+        /**
+         * @brief Encodes bytes into Base16. The output must have room for twice as many characters as there are input bytes.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] table_ Table created by MakeBase16EncodeTable.
+         * @param[in] kernels_ Vectorized functions to be used, only for base16UppercaseEncodeTable and base16LowercaseEncodeTable.
+        */
+        constexpr void EncodeBase16(const unsigned char* input_, const std::size_t inputSize_, char* output_, const std::array<char, 512>& table_,
+                                    const Base16Kernels& kernels_ = GetBase16Kernels()) noexcept
+        {
+            const bool uppercase(&table_ == &base16UppercaseEncodeTable);
+            const bool hasKernel(kernels_.encodeBlocks != nullptr and (uppercase or &table_ == &base16LowercaseEncodeTable));
+            const std::size_t blockSize(
+                hasKernel ? kernels_.encodeBlocks(input_, inputSize_, output_, uppercase ? base16UppercaseDigits.data() : base16LowercaseDigits.data()) : 0);
+
+            for(std::size_t i(blockSize); i < inputSize_; ++i) {
+                std::copy_n(table_.data() + (static_cast<std::size_t>(input_[i]) * 2), 2, output_ + (i * 2));
+            }
+        }
+
+        /**
+         * Decodes Base16 characters into bytes. Whitespace and newline characters are skipped. A high digit that is not followed by a low digit is kept
+         * in highDigit_, so that decoding can continue with the next piece of input. The output must have room for half as many bytes as there are input
+         * characters plus the kept digit.
+         * 
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table created by MakeBase16DecodeTable.
+         * @param[in,out] highDigit_ Kept high digit, invalidSymbol if there is none.
+         * @param[in] kernels_ Vectorized functions to be used, only for base16UppercaseDecodeTable, base16LowercaseDecodeTable and base16MixedDecodeTable.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeBase16(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                            const std::array<unsigned char, 256>& table_, unsigned char& highDigit_,
+                                            const Base16Kernels& kernels_ = GetBase16Kernels()) noexcept
+        {
+            const bool acceptUppercase(&table_ == &base16UppercaseDecodeTable or &table_ == &base16MixedDecodeTable);
+            const bool acceptLowercase(&table_ == &base16LowercaseDecodeTable or &table_ == &base16MixedDecodeTable);
+            const bool hasKernel(kernels_.decodeBlocks != nullptr and (acceptUppercase or acceptLowercase));
+            std::size_t i(0);
+            std::size_t written(0);
+            std::size_t nextBlock(0);
+
+            while(true) {
+                if(highDigit_ == invalidSymbol) {
+                    // After a block that is not all digits, at least one more block is left to the scalar code so that spaced digits stay cheap
+                    if(hasKernel and i >= nextBlock) {
+                        const std::size_t blockSize(kernels_.decodeBlocks(input_ + i, inputSize_ - i, output_ + written, acceptUppercase, acceptLowercase));
+
+                        i += blockSize;
+                        written += blockSize / 2;
+                        nextBlock = i + 32;
+                    }
+
+                    while(i + 1 < inputSize_) {
+                        const unsigned char high(table_[static_cast<unsigned char>(input_[i])]);
+                        const unsigned char low(table_[static_cast<unsigned char>(input_[i + 1])]);
+
+                        if((high | low) > 0x0F) {
+                            break;
+                        }
+
+                        output_[written++] = static_cast<unsigned char>((high << 4) | low);
+                        i += 2;
+                    }
+
+                    if(i >= inputSize_) {
+                        break;
+                    }
+
+                    const unsigned char high(table_[static_cast<unsigned char>(input_[i++])]);
+
+                    if(high == ignoredSymbol) {
+                        continue;
+                    } else if(high == invalidSymbol) {
+                        return DecodeResult{written, false};
+                    }
+
+                    highDigit_ = high;
+                }
+
+                while(i < inputSize_ and table_[static_cast<unsigned char>(input_[i])] == ignoredSymbol) {
+                    ++i;
+                }
+
+                if(i >= inputSize_) {
+                    break;
+                }
+
+                const unsigned char low(table_[static_cast<unsigned char>(input_[i++])]);
+
+                if(low == invalidSymbol) {
+                    return DecodeResult{written, false};
+                }
+
+                output_[written++] = static_cast<unsigned char>((highDigit_ << 4) | low);
+                highDigit_ = invalidSymbol;
+            }
+
+            return DecodeResult{written, true};
+        }
+
+        /**
+         * Decodes Base16 characters into bytes. Whitespace and newline characters are skipped and an odd trailing digit becomes the high half of the
+         * last byte. The output must have room for half as many bytes as there are input characters, rounded up.
+         * 
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table created by MakeBase16DecodeTable.
+         * @param[in] kernels_ Vectorized functions to be used.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeBase16(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                            const std::array<unsigned char, 256>& table_, const Base16Kernels& kernels_ = GetBase16Kernels()) noexcept
+        {
+            unsigned char highDigit(invalidSymbol);
+            DecodeResult result(DecodeBase16(input_, inputSize_, output_, table_, highDigit, kernels_));
+
+            if(result.isValid and highDigit != invalidSymbol) {
+                output_[result.size++] = static_cast<unsigned char>(highDigit << 4);
+            }
+
+            return result;
+        }
+
+        /**
+         * Validates Base16 characters by decoding them chunk by chunk into a small buffer on the stack, carrying the high digit from one chunk to the
+         * next. A character that is neither a digit of the table nor whitespace is the only thing that makes an input invalid.
+         *
+         * @param[in] input_ Characters to be validated.
+         * @param[in] table_ Table created by MakeBase16DecodeTable.
+         * @returns Whether or not the input is valid, its decoded size and the offset of the first invalid character.
+        */
+        inline ValidationResult ValidateBase16(const std::string_view input_, const std::array<unsigned char, 256>& table_) noexcept
+        {
+            constexpr std::size_t chunkSize(4096);
+            std::array<unsigned char, (chunkSize / 2) + 1> output;
+            unsigned char highDigit(invalidSymbol);
+            std::size_t decodedSize(0);
+
+            for(std::size_t i(0); i < input_.size(); i += chunkSize) {
+                const std::size_t size(std::min(chunkSize, input_.size() - i));
+                const DecodeResult result(DecodeBase16(input_.data() + i, size, output.data(), table_, highDigit));
+
+                decodedSize += result.size;
+
+                if(not result.isValid) {
+                    for(std::size_t j(0); j < size; ++j) {
+                        if(table_[static_cast<unsigned char>(input_[i + j])] == invalidSymbol) {
+                            return ValidationResult{false, decodedSize, i + j};
+                        }
+                    }
+                }
+            }
+
+            return ValidationResult{true, decodedSize + ((highDigit != invalidSymbol) ? 1 : 0), input_.size()};
+        }
+
+        /**
+         * @brief Encodes bytes into Base16 on several threads. The output must have room for twice as many characters as there are input bytes.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] table_ Table created by MakeBase16EncodeTable.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+        */
+        inline void EncodeBase16InParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const std::array<char, 512>& table_,
+                                           const std::size_t threadCount_) noexcept
+        {
+            EncodeGroupsInParallel<1, 2>(input_, inputSize_, output_, threadCount_,
+                                         [&table_](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                                             EncodeBase16(bytes_, size_, characters_, table_);
+
+                                             return size_ * 2;
+                                         });
+        }
+
+        /**
+         * Decodes Base16 characters into bytes on several threads. Skipped whitespace and newline characters make the output position of a chunk depend
+         * on everything before it, so the digits of every chunk are counted first and each boundary is moved past one more digit if an odd amount of
+         * digits comes before it. The output must have room for half as many bytes as there are input characters, rounded up.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table created by MakeBase16DecodeTable.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeBase16InParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                                   const std::array<unsigned char, 256>& table_, const std::size_t threadCount_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            const std::size_t chunkCount(GetChunkCount(threadCount_, inputSize_));
+
+            if(chunkCount == 1) {
+                return timer.CountOutput(DecodeBase16(input_, inputSize_, output_, table_));
+            }
+
+            const std::size_t chunkSize(inputSize_ / chunkCount);
+            std::vector<std::size_t> boundaries;
+            std::vector<std::size_t> digitCounts;
+
+            try {
+                boundaries.resize(chunkCount + 1);
+                digitCounts.resize(chunkCount);
+            } catch(const std::exception&) {
+                return timer.CountOutput(DecodeBase16(input_, inputSize_, output_, table_));
+            }
+
+            RunChunksInParallel(chunkCount - 1, [&](const std::size_t chunk_) noexcept {
+                const char* const begin(input_ + (chunk_ * chunkSize));
+
+                digitCounts[chunk_ + 1] = static_cast<std::size_t>(std::count_if(begin, begin + chunkSize, [&table_](const char character_) noexcept {
+                    return table_[static_cast<unsigned char>(character_)] != ignoredSymbol;
+                }));
+            });
+
+            std::size_t digitCount(0);
+
+            boundaries[chunkCount] = inputSize_;
+
+            for(std::size_t i(1); i < chunkCount; ++i) {
+                digitCount += digitCounts[i];
+
+                std::size_t boundary(i * chunkSize);
+                std::size_t adjustedDigitCount(digitCount);
+
+                if(digitCount % 2 == 1) {
+                    while(boundary < inputSize_ and table_[static_cast<unsigned char>(input_[boundary])] == ignoredSymbol) {
+                        ++boundary;
+                    }
+
+                    if(boundary == inputSize_ or boundary >= (i + 1) * chunkSize) {
+                        return timer.CountOutput(DecodeBase16(input_, inputSize_, output_, table_));
+                    }
+
+                    ++boundary;
+                    ++adjustedDigitCount;
+                }
+
+                boundaries[i] = boundary;
+                digitCounts[i] = adjustedDigitCount;
+            }
+
+            DecodeResult lastResult{0, true};
+            std::atomic<bool> isComplete(true);
+
+            RunChunksInParallel(chunkCount, [&](const std::size_t chunk_) noexcept {
+                const std::size_t begin(boundaries[chunk_]);
+                const DecodeResult result(DecodeBase16(input_ + begin, boundaries[chunk_ + 1] - begin, output_ + (digitCounts[chunk_] / 2), table_));
+
+                if(chunk_ + 1 == chunkCount) {
+                    lastResult = result;
+                } else if(not result.isValid or result.size != (digitCounts[chunk_ + 1] - digitCounts[chunk_]) / 2) {
+                    isComplete.store(false, std::memory_order_relaxed);
+                }
+            });
+
+            if(not isComplete.load(std::memory_order_relaxed)) {
+                return timer.CountOutput(DecodeBase16(input_, inputSize_, output_, table_));
+            }
+
+            return timer.CountOutput(DecodeResult{(digitCounts[chunkCount - 1] / 2) + lastResult.size, lastResult.isValid});
+        }
+    }
+
+    /// @brief A namespace that has functions that implement Base16 encoding and decoding in accordance to RFC 4648 §8.
+    namespace Base16
+    {
+        /// @brief A simple error class for the Base16 namespace.
+        class Error : public std::exception
+        {
+        public:
+            /// @brief The type of Error.
+            enum class Type
+            {
+                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
+                INVALID_CASE_ERROR,            ///< Invalid case.
+                STRING_PARSE_ERROR,            ///< Failed to parse string.
+                OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
+            };
+
+            /**
+             * @brief Creates an Error of given Type.
+             * @param[in] type_ Type of Error.
+             * @param[in] sourceLocation_ Source location of Error.
+            */
+            explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
+                _type(type_),
+                _sourceLocation(sourceLocation_)
+            {
+                switch(_type) {
+                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
+                    case Type::INVALID_CASE_ERROR: _what = "Invalid case"; break;
+                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                    case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
+                    default: _what = "Invalid error type"; break;
+                }
+            }
+
+            /**
+             * @brief Gets the Type of the Error.
+             * @returns Type of Error.
+            */
+            Type GetType() const noexcept { return _type; }
+            /**
+             * @brief Gets the location at which the Error was thrown.
+             * @returns Source location of Error.
+            */
+            std::source_location GetSourceLocation() const { return _sourceLocation; }
+            /**
+             * @brief Gets reason for the Error.
+             * @returns Reason for the Error.
+            */
+            std::string What() const { return _what; }
+
+            // For C++ compatibility purposes
+
+            const char* what() const noexcept override { return _what.c_str(); }
+
+        private:
+            Type _type;
+            std::source_location _sourceLocation;
+            std::string _what;
+        };
+
+        /// @brief Case setting.
+        enum class Case
+        {
+            LOWERCASE, ///< Lowercase (example: 7a7a).
+            MIXED,     ///< Mixed (example: 7a7A).
+            UPPERCASE  ///< Uppercase (example: 7A7A).
+        };
+
+        static_assert(Internal::charSize == 8, "These Base16 functions only works if a char is 8 bits big");
+
+        /**
+         * @brief Gets the category of the error codes set by the non-throwing functions.
+         * @returns Error category of the Base16 namespace.
+        */
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            static const Internal::ErrorCategory<Error> errorCategory("BinaryText::Base16");
+
+            return errorCategory;
+        }
+        /**
+         * @brief Creates an error code of given Type.
+         * @param[in] type_ Type of Error.
+         * @returns Error code in the category returned by GetErrorCategory.
+        */
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return std::error_code(static_cast<int>(type_) + 1, GetErrorCategory()); }
+        /**
+         * @brief Calculates the size of a Base16 encoded string.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @returns Amount of characters the encoded string will have.
+        */
+        constexpr std::size_t EncodedSize(const std::size_t size_) noexcept { return size_ * 2; }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base16 encoded string can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return (size_ / 2) + (size_ % 2); }
+        /**
+         * @brief Calculates the size of a Base16 encoded file, which can be larger than memory and than std::size_t (see BinaryText::Files).
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @returns Amount of characters the encoded file will have.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_) { return Internal::CheckFileSize(size_, 1, 2) * 2; }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base16 encoded file can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept { return (size_ / 2) + (size_ % 2); }
+
+        /**
+         * Encodes a string literal into Base16 at compile time, for constants that should not cost anything at run time. The std::array has exactly
+         * EncodedSize characters and no terminating null character.
+         *
+         * @tparam string_ String literal to be encoded.
+         * @tparam case_ Case to be used (mixed case not supported). The default is uppercase.
+         * @returns Encoded characters.
+        */
+        template<Internal::ConstantString string_, Case case_ = Case::UPPERCASE>
+        consteval std::array<char, EncodedSize(string_.characters.size())> EncodeArray() noexcept
+        {
+            static_assert(case_ == Case::UPPERCASE or case_ == Case::LOWERCASE, "Base16 can only be encoded in uppercase or lowercase");
+
+            constexpr auto encode([](const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                Internal::EncodeBase16(input_, inputSize_, output_,
+                                       (case_ == Case::UPPERCASE) ? Internal::base16UppercaseEncodeTable : Internal::base16LowercaseEncodeTable,
+                                       Internal::Base16Kernels{});
+
+                return inputSize_ * 2;
+            });
+            constexpr auto encoded(Internal::EncodeConstant<EncodedSize(string_.characters.size())>(string_, encode));
+
+            return encoded.values;
+        }
+        /**
+         * Decodes a Base16 string literal at compile time, for constants that should not cost anything at run time. A string literal that is not valid
+         * Base16 does not compile. Whitespace and newline characters are ignored.
+         *
+         * @tparam encodedString_ String literal to be decoded.
+         * @tparam case_ Case to be used. The default is mixed case.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @returns Decoded bytes, in a std::array of exactly their amount.
+        */
+        template<Internal::ConstantString encodedString_, Case case_ = Case::MIXED, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            constexpr auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16(input_, inputSize_, output_,
+                                              (case_ == Case::UPPERCASE)   ? Internal::base16UppercaseDecodeTable
+                                              : (case_ == Case::LOWERCASE) ? Internal::base16LowercaseDecodeTable
+                                                                           : Internal::base16MixedDecodeTable,
+                                              Internal::Base16Kernels{});
+            });
+            constexpr auto decoded(Internal::DecodeConstant<MaximumDecodedSize(encodedString_.characters.size())>(encodedString_, decode));
+
+            static_assert(decoded.isValid, "The string literal is not valid Base16");
+
+            return Internal::MakeConstantArray<ByteType, decoded.size>(decoded);
+        }
+
+        /**
+         * @brief Encodes a not-encoded string into a Base16 encoded string.
+         * @param[in] string_ String to be encoded.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const Case case_ = Case::UPPERCASE, const std::size_t threadCount_ = 1)
+        {
+            std::string encodedString;
+
+            if(string_.empty()) {
+                return encodedString;
+            } else if(case_ != Case::UPPERCASE and case_ != Case::LOWERCASE) {
+                throw Error(Error::Type::INVALID_CASE_ERROR);
+            }
+
+            if(string_.size() > encodedString.max_size() / 2) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(string_.size() * 2);
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            Internal::EncodeBase16InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(),
+                                             (case_ == Case::UPPERCASE) ? Internal::base16UppercaseEncodeTable : Internal::base16LowercaseEncodeTable,
+                                             threadCount_);
+
+            return encodedString;
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base16 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const Case case_ = Case::UPPERCASE, const std::size_t threadCount_ = 1)
+        {
+            std::string encodedString;
+
+            if(byteBuffer_.IsEmpty()) {
+                return encodedString;
+            } else if(case_ != Case::UPPERCASE and case_ != Case::LOWERCASE) {
+                throw Error(Error::Type::INVALID_CASE_ERROR);
+            }
+
+            if(byteBuffer_.GetSize() > encodedString.max_size() / 2) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(byteBuffer_.GetSize() * 2);
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            Internal::EncodeBase16InParallel(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(), encodedString.data(),
+                                             (case_ == Case::UPPERCASE) ? Internal::base16UppercaseEncodeTable : Internal::base16LowercaseEncodeTable,
+                                             threadCount_);
+
+            return encodedString;
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base16 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const Case case_ = Case::UPPERCASE,
+                                             const std::size_t threadCount_ = 1)
+        {
+            return EncodeStringToString(Internal::ViewAsCharacters(byteBufferView_), case_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into a Base16 encoded string of the caller, like EncodeStringToString but reusing the capacity of the string, so
+         * that encoding many inputs into the same string does not allocate once it is big enough.
+         *
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const Case case_ = Case::UPPERCASE,
+                               const std::size_t threadCount_ = 1)
+        {
+            if(case_ != Case::UPPERCASE and case_ != Case::LOWERCASE) {
+                throw Error(Error::Type::INVALID_CASE_ERROR);
+            } else if(string_.size() > encodedString_.max_size() / 2) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            const std::array<char, 512>& table((case_ == Case::UPPERCASE) ? Internal::base16UppercaseEncodeTable : Internal::base16LowercaseEncodeTable);
+
+            const auto encode([string_, &table, threadCount_](char* output_) noexcept {
+                Internal::EncodeBase16InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), output_, table, threadCount_);
+
+                return string_.size() * 2;
+            });
+
+            Internal::EncodeIntoString<Error>(encodedString_, string_.size() * 2, encode);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base16 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const Case case_ = Case::UPPERCASE,
+                        const std::size_t threadCount_ = 1)
+        {
+            EncodeInto(Internal::ViewAsCharacters(byteBuffer_), encodedString_, case_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base16 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const Case case_ = Case::UPPERCASE,
+                        const std::size_t threadCount_ = 1)
+        {
+            EncodeInto(Internal::ViewAsCharacters(byteBufferView_), encodedString_, case_, threadCount_);
+        }
+        /**
+         * @brief Decodes a Base16 encoded string into a decoded string. Whitespace and newline characters are ignored.
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const Case case_ = Case::MIXED, const std::size_t threadCount_ = 1)
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        throw Error(Error::Type::INVALID_CASE_ERROR);
+                    }
+
+                    return std::string();
+                }
+            }
+
+            std::string decodedString;
+
+            try {
+                decodedString.resize((encodedString_.size() / 2) + (encodedString_.size() % 2));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            const Internal::DecodeResult result(
+                Internal::DecodeBase16InParallel(encodedString_.data(), encodedString_.size(), reinterpret_cast<unsigned char*>(decodedString.data()), *table,
+                                                 threadCount_));
+
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+
+            decodedString.resize(result.size);
+
+            return decodedString;
+        }
+        /**
+         * @brief Decodes a Base16 encoded string into a decoded ByteBuffer. Whitespace and newline characters are ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base16::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const Case case_ = Case::MIXED,
+                                                      const std::size_t threadCount_ = 1, std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        throw Error(Error::Type::INVALID_CASE_ERROR);
+                    }
+
+                    return ByteBuffer<ByteType>(0, memoryResource_);
+                }
+            }
+
+            ByteBuffer<ByteType> decodedByteBuffer((encodedString_.size() / 2) + (encodedString_.size() % 2), uninitialized, memoryResource_);
+            const Internal::DecodeResult result(Internal::DecodeBase16InParallel(encodedString_.data(), encodedString_.size(),
+                                                                                 reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), *table,
+                                                                                 threadCount_));
+
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+
+            decodedByteBuffer.Resize(result.size);
+
+            return decodedByteBuffer;
+        }
+        /**
+         * Decodes a Base16 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing.
+         * Whitespace and newline characters are ignored.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const Case case_ = Case::MIXED,
+                                                           const std::size_t threadCount_ = 1) noexcept
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        return Result<std::string>{std::string(), MakeErrorCode(Error::Type::INVALID_CASE_ERROR)};
+                    }
+
+                    return Result<std::string>{};
+                }
+            }
+
+            const auto decode([table, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16InParallel(input_, inputSize_, output_, *table, threadCount_);
+            });
+
+            return Internal::TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_.size()), MakeErrorCode, decode);
+        }
+        /**
+         * Decodes a Base16 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing. A
+         * ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace and newline characters are ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const Case case_ = Case::MIXED,
+                                                                 const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        return Result<ByteBuffer<ByteType>>{ByteBuffer<ByteType>(0, memoryResource_), MakeErrorCode(Error::Type::INVALID_CASE_ERROR)};
+                    }
+
+                    return Result<ByteBuffer<ByteType>>{ByteBuffer<ByteType>(0, memoryResource_), std::error_code()};
+                }
+            }
+
+            const auto decode([table, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16InParallel(input_, inputSize_, output_, *table, threadCount_);
+            });
+
+            return Internal::TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_.size()), memoryResource_, MakeErrorCode,
+                                                                    decode);
+        }
+        /**
+         * Decodes a Base16 encoded string into a decoded string of the caller, like DecodeStringToString but reusing the capacity of the string, so
+         * that decoding many inputs into the same string does not allocate once it is big enough. If an Error is thrown the string is left empty.
+         * Whitespace and newline characters are ignored.
+         *
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedString_.
+         * @param[out] decodedString_ String the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+        */
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const Case case_ = Case::MIXED,
+                               const std::size_t threadCount_ = 1)
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        throw Error(Error::Type::INVALID_CASE_ERROR);
+                    }
+
+                    decodedString_.clear();
+
+                    return;
+                }
+            }
+
+            const auto decode([table, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16InParallel(input_, inputSize_, output_, *table, threadCount_);
+            });
+
+            Internal::DecodeIntoString<Error>(encodedString_, decodedString_, MaximumDecodedSize(encodedString_.size()), decode);
+        }
+        /**
+         * Decodes a Base16 encoded string into a decoded ByteBuffer of the caller, like DecodeStringToByteBuffer but reusing the capacity of the
+         * ByteBuffer and without initializing its bytes first. If an Error is thrown the ByteBuffer is left empty. Whitespace and newline characters are
+         * ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedByteBuffer_.
+         * @param[out] decodedByteBuffer_ ByteBuffer the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base16::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const Case case_ = Case::MIXED,
+                        const std::size_t threadCount_ = 1)
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(encodedString_.find_first_not_of(" \n") != std::string_view::npos) {
+                        throw Error(Error::Type::INVALID_CASE_ERROR);
+                    }
+
+                    decodedByteBuffer_.Resize(0);
+
+                    return;
+                }
+            }
+
+            const auto decode([table, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16InParallel(input_, inputSize_, output_, *table, threadCount_);
+            });
+
+            Internal::DecodeIntoByteBuffer<Error>(encodedString_, decodedByteBuffer_, MaximumDecodedSize(encodedString_.size()), decode);
+        }
+
+        /**
+         * @brief Decodes Base16 encoded characters held by a ByteBuffer into a decoded ByteBuffer. Whitespace and newline characters are ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @tparam EncodedByteType Type of the encoded ByteBuffer that satisfies the ByteBufferCompatible concept.
+         * @param[in] encodedByteBuffer_ ByteBuffer to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base16::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const Case case_ = Case::MIXED,
+                                                          const std::size_t threadCount_ = 1, std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return DecodeStringToByteBuffer<ByteType>(Internal::ViewAsCharacters(encodedByteBuffer_), case_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes Base16 encoded characters held by a ByteBuffer into the ByteBuffer itself, the decoded bytes overwrite the characters and the ByteBuffer is
+         * shrunk to fit them, so no second buffer is needed. Whitespace and newline characters are ignored. If an Error is thrown the ByteBuffer is cleared.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @throws BinaryText::Base16::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_, const Case case_ = Case::MIXED)
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(Internal::ViewAsCharacters(byteBuffer_).find_first_not_of(" \n") != std::string_view::npos) {
+                        byteBuffer_.Clear();
+
+                        throw Error(Error::Type::INVALID_CASE_ERROR);
+                    }
+
+                    byteBuffer_.Clear();
+
+                    return;
+                }
+            }
+
+            const auto decode([table](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeBase16(input_, inputSize_, output_, *table);
+            });
+
+            if(not Internal::DecodeInPlace(byteBuffer_, decode)) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+        }
+
+        /**
+         * Checks whether Base16 encoded characters can be decoded, by the same rules as the decoding functions but without keeping the decoded bytes.
+         * Nothing is allocated and nothing is thrown. Whitespace and newline characters are ignored.
+         *
+         * @param[in] input_ Characters to be checked.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @returns Whether or not the input is valid, the exact decoded size and the offset of the first character that cannot be decoded.
+        */
+        inline ValidationResult Validate(const std::string_view input_, const Case case_ = Case::MIXED) noexcept
+        {
+            switch(case_) {
+                case Case::MIXED: return Internal::ValidateBase16(input_, Internal::base16MixedDecodeTable);
+                case Case::UPPERCASE: return Internal::ValidateBase16(input_, Internal::base16UppercaseDecodeTable);
+                case Case::LOWERCASE: return Internal::ValidateBase16(input_, Internal::base16LowercaseDecodeTable);
+                default: return ValidationResult{false, 0, 0};
+            }
+        }
+
+        /**
+         * @brief Encodes bytes into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for EncodedSize(input_.size()) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of characters written, 0 on error.
+        */
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const Case case_ = Case::UPPERCASE, const std::size_t threadCount_ = 1) noexcept
+        {
+            if(input_.empty()) {
+                errorCode_.clear();
+
+                return 0;
+            } else if(case_ != Case::UPPERCASE and case_ != Case::LOWERCASE) {
+                errorCode_ = MakeErrorCode(Error::Type::INVALID_CASE_ERROR);
+
+                return 0;
+            } else if(output_.size() < EncodedSize(input_.size())) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                return 0;
+            }
+
+            Internal::EncodeBase16InParallel(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(),
+                                             (case_ == Case::UPPERCASE) ? Internal::base16UppercaseEncodeTable : Internal::base16LowercaseEncodeTable,
+                                             threadCount_);
+            errorCode_.clear();
+
+            return input_.size() * 2;
+        }
+        /**
+         * @brief Decodes Base16 characters into a caller-provided buffer. Nothing is allocated and nothing is thrown. Whitespace and newline characters
+         * are ignored.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_.size()) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] case_ Case to be used. The default is mixed case.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const Case case_ = Case::MIXED, const std::size_t threadCount_ = 1) noexcept
+        {
+            const std::array<unsigned char, 256>* table(nullptr);
+
+            switch(case_) {
+                case Case::MIXED: table = &Internal::base16MixedDecodeTable; break;
+                case Case::UPPERCASE: table = &Internal::base16UppercaseDecodeTable; break;
+                case Case::LOWERCASE: table = &Internal::base16LowercaseDecodeTable; break;
+                default: {
+                    if(input_.find_first_not_of(" \n") != std::string_view::npos) {
+                        errorCode_ = MakeErrorCode(Error::Type::INVALID_CASE_ERROR);
+                    } else {
+                        errorCode_.clear();
+                    }
+
+                    return 0;
+                }
+            }
+
+            if(output_.size() < MaximumDecodedSize(input_.size())) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                return 0;
+            }
+
+            const Internal::DecodeResult result(
+                Internal::DecodeBase16InParallel(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), *table, threadCount_));
+
+            if(not result.isValid) {
+                errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
+
+                return 0;
+            }
+
+            errorCode_.clear();
+
+            return result.size;
+        }
+
+        /// @brief Encodes Base16 piece by piece. Splitting the input at any point gives the same result as encoding it at once.
+        class Encoder
+        {
+        public:
+            /**
+             * @brief Creates an Encoder.
+             * @param[in] case_ Case to be used (mixed case not supported).
+             * @throws BinaryText::Base16::Error
+            */
+            explicit Encoder(const Case case_ = Case::UPPERCASE) :
+                _table(nullptr)
+            {
+                switch(case_) {
+                    case Case::UPPERCASE: _table = &Internal::base16UppercaseEncodeTable; break;
+                    case Case::LOWERCASE: _table = &Internal::base16LowercaseEncodeTable; break;
+                    default: throw Error(Error::Type::INVALID_CASE_ERROR);
+                }
+            }
+
+            /**
+             * @brief Calculates the maximum amount of characters Update writes.
+             * @param[in] inputSize_ Amount of bytes passed to Update.
+             * @returns Maximum amount of characters written.
+            */
+            static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return inputSize_ * 2; }
+            /**
+             * @brief Calculates the maximum amount of characters Finish writes.
+             * @returns Maximum amount of characters written.
+            */
+            static constexpr std::size_t GetMaximumFinishSize() noexcept { return 0; }
+
+            /**
+             * @brief Encodes the next piece of the input.
+             * @param[in] input_ Bytes to be encoded.
+             * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumUpdateSize(input_.size()) characters.
+             * @returns Amount of characters written.
+             * @throws BinaryText::Base16::Error
+            */
+            std::size_t Update(const std::span<const std::byte> input_, const std::span<char> output_)
+            {
+                if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                }
+
+                Statistics::StageTimer timer(Statistics::Stage::ENCODE, input_.size());
+
+                Internal::EncodeBase16(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), *_table);
+
+                return timer.CountOutput(input_.size() * 2);
+            }
+            /**
+             * @brief Ends the input. Every byte is encoded by Update, so nothing is written.
+             * @param[out] output_ Where the encoded characters are written to.
+             * @returns Amount of characters written.
+            */
+            std::size_t Finish([[maybe_unused]] const std::span<char> output_) noexcept { return 0; }
+            /// @brief Does nothing, as no bytes are kept between calls.
+            void Reset() noexcept {}
+
+        private:
+            const std::array<char, 512>* _table;
+        };
+
+        /**
+         * Encodes several ByteBufferViews one after another into a Base16 encoded string, as if they were one ByteBuffer. A message made of several
+         * parts, such as a header and a Subview of a big payload, is encoded this way without concatenating the parts first.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferViews_ ByteBufferViews to be encoded, in order.
+         * @param[in] case_ Case to be used (mixed case not supported).
+         * @throws BinaryText::Base16::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const Case case_ = Case::UPPERCASE)
+        {
+            Encoder encoder(case_);
+
+            return Internal::EncodeByteBufferViews<Error>(encoder, byteBufferViews_);
+        }
+
+        /**
+         * Decodes Base16 piece by piece. Splitting the input at any point gives the same result as decoding it at once. Whitespace and newline characters
+         * are ignored.
+        */
+        class Decoder
+        {
+        public:
+            /**
+             * @brief Creates a Decoder.
+             * @param[in] case_ Case to be used. The default is mixed case.
+             * @throws BinaryText::Base16::Error
+            */
+            explicit Decoder(const Case case_ = Case::MIXED) :
+                _table(nullptr),
+                _highDigit(Internal::invalidSymbol)
+            {
+                switch(case_) {
+                    case Case::MIXED: _table = &Internal::base16MixedDecodeTable; break;
+                    case Case::UPPERCASE: _table = &Internal::base16UppercaseDecodeTable; break;
+                    case Case::LOWERCASE: _table = &Internal::base16LowercaseDecodeTable; break;
+                    default: throw Error(Error::Type::INVALID_CASE_ERROR);
+                }
+            }
+
+            /**
+             * @brief Calculates the maximum amount of bytes Update writes.
+             * @param[in] inputSize_ Amount of characters passed to Update.
+             * @returns Maximum amount of bytes written.
+            */
+            static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return (inputSize_ / 2) + (inputSize_ % 2); }
+            /**
+             * @brief Calculates the maximum amount of bytes Finish writes.
+             * @returns Maximum amount of bytes written.
+            */
+            static constexpr std::size_t GetMaximumFinishSize() noexcept { return 1; }
+
+            /**
+             * Decodes the next piece of the input. A digit that is not followed by a second one is kept until the next call. After an Error the Decoder has
+             * to be Reset before it can be used again.
+             *
+             * @param[in] input_ Characters to be decoded.
+             * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumUpdateSize(input_.size()) bytes.
+             * @returns Amount of bytes written.
+             * @throws BinaryText::Base16::Error
+            */
+            std::size_t Update(const std::string_view input_, const std::span<std::byte> output_)
+            {
+                if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                }
+
+                Statistics::StageTimer timer(Statistics::Stage::DECODE, input_.size());
+                const Internal::DecodeResult result(timer.CountOutput(
+                    Internal::DecodeBase16(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), *_table, _highDigit)));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                return result.size;
+            }
+            /**
+             * @brief Turns a kept digit into the high half of the last byte. The Decoder can be used for a new input afterwards.
+             * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumFinishSize() bytes.
+             * @returns Amount of bytes written.
+             * @throws BinaryText::Base16::Error
+            */
+            std::size_t Finish(const std::span<std::byte> output_)
+            {
+                if(output_.size() < GetMaximumFinishSize()) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                } else if(_highDigit == Internal::invalidSymbol) {
+                    return 0;
+                }
+
+                output_[0] = static_cast<std::byte>(_highDigit << 4);
+                _highDigit = Internal::invalidSymbol;
+
+                return 1;
+            }
+            /// @brief Discards the kept digit.
+            void Reset() noexcept { _highDigit = Internal::invalidSymbol; }
+
+        private:
+            const std::array<unsigned char, 256>* _table;
+            unsigned char _highDigit;
+        };
+    };
+
+    namespace Internal
+    {
+        /// @brief Base32 alphabet in accordance to RFC 4648 §6.
+        constexpr std::string_view base32Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+        /// @brief Base32Hex alphabet in accordance to RFC 4648 §7.
+        constexpr std::string_view base32HexAlphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUV";
+
+        constexpr std::array<unsigned char, 256> base32DecodeTable = MakeDecodeTable(base32Alphabet);
+        constexpr std::array<unsigned char, 256> base32HexDecodeTable = MakeDecodeTable(base32HexAlphabet);
+
+        /**
+         * @brief Group geometry of an alphabet. Each character holds log2(alphabetSize_) bits and a group is the smallest amount of whole bytes that
+         * fills whole characters.
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+        */
+        template<std::size_t alphabetSize_>
+        struct AlphabetGeometry
+        {
+            static_assert(alphabetSize_ == 16 or alphabetSize_ == 32 or alphabetSize_ == 64, "An alphabet must have 16, 32 or 64 characters");
+
+            static constexpr std::size_t bitsPerCharacter = (alphabetSize_ == 16) ? 4 : ((alphabetSize_ == 32) ? 5 : 6); ///< Bits held by a character.
+            static constexpr std::size_t bytesPerGroup = (alphabetSize_ == 16) ? 1 : ((alphabetSize_ == 32) ? 5 : 3);    ///< Bytes in a whole group.
+            static constexpr std::size_t charactersPerGroup = (bytesPerGroup * 8) / bitsPerCharacter;                     ///< Characters in a whole group.
+
+            /**
+             * @brief Calculates the amount of characters needed for some bytes, without padding.
+             * @param[in] size_ Amount of bytes.
+             * @returns Amount of characters.
+            */
+            static constexpr std::size_t GetCharacterCount(const std::size_t size_) noexcept { return ((size_ * 8) + bitsPerCharacter - 1) / bitsPerCharacter; }
+        };
+
+        /**
+         * @brief Calculates the size of an encoded string.
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @tparam SizeType std::size_t for strings, std::uint64_t for files that can be larger than memory.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        template<std::size_t alphabetSize_, std::unsigned_integral SizeType = std::size_t>
+        constexpr SizeType AlphabetEncodedSize(const SizeType size_, const bool withPadding_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            const std::size_t remainder(static_cast<std::size_t>(size_ % Geometry::bytesPerGroup));
+            const std::size_t remainderSize(withPadding_ ? Geometry::charactersPerGroup : Geometry::GetCharacterCount(remainder));
+
+            return static_cast<SizeType>(((size_ / Geometry::bytesPerGroup) * Geometry::charactersPerGroup) + ((remainder == 0) ? 0 : remainderSize));
+        }
+
+        /**
+         * @brief Calculates the maximum amount of bytes an encoded string can be decoded into.
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @tparam SizeType std::size_t for strings, std::uint64_t for files that can be larger than memory.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        template<std::size_t alphabetSize_, std::unsigned_integral SizeType = std::size_t>
+        constexpr SizeType AlphabetMaximumDecodedSize(const SizeType size_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            return static_cast<SizeType>(((size_ / Geometry::charactersPerGroup) * Geometry::bytesPerGroup)
+                                         + (((size_ % Geometry::charactersPerGroup) * Geometry::bitsPerCharacter) / 8));
+        }
+
+        /**
+         * Encodes bytes with an alphabet. An incomplete last group is filled up with zero bits and only as many characters as needed are written,
+         * followed by padding up to a whole group if requested. The output must have room for AlphabetEncodedSize characters.
+         *
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] alphabet_ The alphabetSize_ characters of the alphabet.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @returns Amount of characters written.
+        */
+        template<std::size_t alphabetSize_>
+        constexpr std::size_t EncodeAlphabet(const unsigned char* input_, const std::size_t inputSize_, char* output_, const char* alphabet_,
+                                             const bool withPadding_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            constexpr std::size_t groupBits(Geometry::bytesPerGroup * 8);
+            std::size_t written(0);
+
+            for(std::size_t i(0); i < inputSize_; i += Geometry::bytesPerGroup) {
+                const std::size_t groupSize(std::min(Geometry::bytesPerGroup, inputSize_ - i));
+                const std::size_t encodedSize(Geometry::GetCharacterCount(groupSize));
+                std::uint64_t group(0);
+
+                for(std::size_t j(0); j < Geometry::bytesPerGroup; ++j) {
+                    group = (group << 8) | ((j < groupSize) ? input_[i + j] : 0U);
+                }
+
+                for(std::size_t j(0); j < encodedSize; ++j) {
+                    const std::size_t shift(groupBits - (Geometry::bitsPerCharacter * (j + 1)));
+                    output_[written + j] = alphabet_[static_cast<std::size_t>(group >> shift) & (alphabetSize_ - 1)];
+                }
+
+                written += encodedSize;
+
+                if(encodedSize < Geometry::charactersPerGroup and withPadding_) {
+                    std::fill_n(output_ + written, Geometry::charactersPerGroup - encodedSize, '=');
+                    written += Geometry::charactersPerGroup - encodedSize;
+                }
+            }
+
+            return written;
+        }
+
+        /**
+         * Decodes characters of an alphabet into bytes. The input is processed in whole groups, a group can only be padded with '=' at its end and missing
+         * characters at the end of the input count as padding. A padded group must have exactly as many characters as its bytes need, and decoding stops
+         * after the first padded or incomplete group. The output must have room for AlphabetMaximumDecodedSize bytes.
+         *
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table that maps every character to its value, invalidSymbol for characters outside of the alphabet.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        template<std::size_t alphabetSize_>
+        constexpr DecodeResult DecodeAlphabet(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                              const std::array<unsigned char, 256>& table_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            constexpr std::size_t groupBits(Geometry::bytesPerGroup * 8);
+            std::size_t written(0);
+
+            for(std::size_t i(0); i < inputSize_; i += Geometry::charactersPerGroup) {
+                const std::size_t groupSize(std::min(Geometry::charactersPerGroup, inputSize_ - i));
+                std::uint64_t group(0);
+                std::size_t characterCounter(0);
+
+                for(std::size_t j(0); j < groupSize; ++j) {
+                    const char character(input_[i + j]);
+                    const unsigned char value(table_[static_cast<unsigned char>(character)]);
+
+                    if(character == '=') {
+                        continue;
+                    } else if(characterCounter < j or value >= alphabetSize_) {
+                        return DecodeResult{written, false};
+                    }
+
+                    group |= static_cast<std::uint64_t>(value) << (groupBits - (Geometry::bitsPerCharacter * (j + 1)));
+                    characterCounter += 1;
+                }
+
+                const std::size_t decodedSize((characterCounter * Geometry::bitsPerCharacter) / 8);
+
+                if(decodedSize == 0 or Geometry::GetCharacterCount(decodedSize) != characterCounter) {
+                    return DecodeResult{written, false};
+                }
+
+                for(std::size_t j(0); j < decodedSize; ++j) {
+                    output_[written++] = static_cast<unsigned char>(group >> (groupBits - (8 * (j + 1))));
+                }
+
+                if(characterCounter < Geometry::charactersPerGroup) {
+                    break;
+                }
+            }
+
+            return DecodeResult{written, true};
+        }
+
+        /**
+         * @brief Encodes bytes with an alphabet on several threads. The output must have room for AlphabetEncodedSize characters.
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] alphabet_ The alphabetSize_ characters of the alphabet.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of characters written.
+        */
+        template<std::size_t alphabetSize_>
+        std::size_t EncodeAlphabetInParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const char* alphabet_,
+                                             const bool withPadding_, const std::size_t threadCount_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            const auto encode([alphabet_, withPadding_](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                return EncodeAlphabet<alphabetSize_>(bytes_, size_, characters_, alphabet_, withPadding_);
+            });
+
+            return EncodeGroupsInParallel<Geometry::bytesPerGroup, Geometry::charactersPerGroup>(input_, inputSize_, output_, threadCount_, encode);
+        }
+
+        /**
+         * @brief Decodes characters of an alphabet into bytes on several threads. The output must have room for AlphabetMaximumDecodedSize bytes.
+         * @tparam alphabetSize_ Amount of characters in the alphabet, 16, 32 or 64.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table that maps every character to its value, invalidSymbol for characters outside of the alphabet.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        template<std::size_t alphabetSize_>
+        DecodeResult DecodeAlphabetInParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                              const std::array<unsigned char, 256>& table_, const std::size_t threadCount_) noexcept
+        {
+            using Geometry = AlphabetGeometry<alphabetSize_>;
+
+            const auto decode([&table_](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                return DecodeAlphabet<alphabetSize_>(characters_, size_, bytes_, table_);
+            });
+
+            return DecodeGroupsInParallel<Geometry::charactersPerGroup, Geometry::bytesPerGroup>(input_, inputSize_, output_, threadCount_, decode);
+        }
+
+        /**
+         * @brief Calculates the size of a Base32/Base32Hex encoded string.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        constexpr std::size_t Base32EncodedSize(const std::size_t size_, const bool withPadding_) noexcept
+        {
+            return AlphabetEncodedSize<32>(size_, withPadding_);
+        }
+
+        /**
+         * @brief Calculates the maximum amount of bytes a Base32/Base32Hex encoded string can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t Base32MaximumDecodedSize(const std::size_t size_) noexcept { return AlphabetMaximumDecodedSize<32>(size_); }
+
+        /**
+         * Signature of the vectorized Base32/Base32Hex encoding functions. They encode as many whole groups as they can and leave the rest for the scalar
+         * code. The output must have room for the entire encoded input.
+         *
+         * Arguments are the input bytes, the amount of input bytes, the output and the 32 characters of the alphabet.
+         * The amount of input bytes consumed (always a multiple of 5) is returned.
+        */
+        using Base32EncodeBlocksFunction = std::size_t (*)(const unsigned char*, std::size_t, char*, const char*) noexcept;
+        /**
+         * Signature of the vectorized Base32/Base32Hex decoding functions. They decode whole groups until one contains a character that is not part of
+         * the alphabet (padding included) and leave the rest for the scalar code. The output must have room for Base32MaximumDecodedSize bytes.
+         *
+         * Arguments are the input characters, the amount of input characters, the output and whether or not the Base32Hex alphabet is used.
+         * The amount of input characters consumed (always a multiple of 8) is returned.
+        */
+        using Base32DecodeBlocksFunction = std::size_t (*)(const char*, std::size_t, unsigned char*, bool) noexcept;
+
+        /// @brief Vectorized Base32/Base32Hex functions picked for an InstructionSet.
+        struct Base32Kernels
+        {
+            Base32EncodeBlocksFunction encodeBlocks; ///< Block encoder, can be nullptr.
+            Base32DecodeBlocksFunction decodeBlocks; ///< Block decoder, can be nullptr.
+        };
+
+#if defined(BINARYTEXT_X86_SIMD)
+        /**
+         * @brief Spreads the 5 byte groups at the start of both 128-bit lanes into 8 5-bit values, one per 16-bit element.
+         * @param[in] bytes_ Vector that holds a group in the first 5 bytes of each lane.
+         * @returns 16 5-bit values.
+        */
+        BINARYTEXT_TARGET("avx2") inline __m256i SplitBase32GroupsAvx2(const __m256i bytes_) noexcept
+        {
+            // Every element gets the 2 bytes its 5 bits are in, big-endian, and is then shifted right by multiplying with 2^(16 - shift)
+            const __m256i shuffle(_mm256_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, -1, 4, 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, -1, 4));
+            const __m256i multipliers(_mm256_setr_epi16(1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8, 1 << 5, 1 << 10, 1 << 7, 1 << 12,
+                                                        1 << 9, 1 << 6, 1 << 11, 1 << 8));
+
+            return _mm256_and_si256(_mm256_mulhi_epu16(_mm256_shuffle_epi8(bytes_, shuffle), multipliers), _mm256_set1_epi16(0x1F));
+        }
+
+        /// @brief Base32EncodeBlocksFunction that handles 20 bytes per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t EncodeBase32BlocksAvx2(const unsigned char* input_, const std::size_t size_, char* output_,
+                                                                            const char* alphabet_) noexcept
+        {
+            const __m256i lowTable(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet_))));
+            const __m256i highTable(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet_ + 16))));
+            std::size_t i(0);
+
+            for(; i + 32 <= size_; i += 20, output_ += 32) {
+                const __m256i first(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i))),
+                                                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i + 5)), 1));
+                const __m256i second(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i + 10))),
+                                                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i + 15)), 1));
+                // Packing works per lane, so the groups come out as 0, 2, 1, 3 and are put back in order afterwards
+                const __m256i values(
+                    _mm256_permute4x64_epi64(_mm256_packus_epi16(SplitBase32GroupsAvx2(first), SplitBase32GroupsAvx2(second)), _MM_SHUFFLE(3, 1, 2, 0)));
+                const __m256i characters(_mm256_blendv_epi8(_mm256_shuffle_epi8(lowTable, values), _mm256_shuffle_epi8(highTable, values),
+                                                            _mm256_cmpgt_epi8(values, _mm256_set1_epi8(15))));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_), characters);
+            }
+
+            return i;
+        }
+
+        /// @brief Base32DecodeBlocksFunction that handles 32 characters per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t DecodeBase32BlocksAvx2(const char* input_, const std::size_t size_, unsigned char* output_,
+                                                                            const bool hex_) noexcept
+        {
+            // Both alphabets are two ranges of characters: A-Z and 2-7 for Base32, 0-9 and A-V for Base32Hex
+            const __m256i digitFirst(_mm256_set1_epi8(hex_ ? '0' - 1 : '2' - 1));
+            const __m256i digitLast(_mm256_set1_epi8(hex_ ? '9' + 1 : '7' + 1));
+            const __m256i digitShift(_mm256_set1_epi8(static_cast<char>(hex_ ? -'0' : 26 - '2')));
+            const __m256i letterLast(_mm256_set1_epi8(hex_ ? 'V' + 1 : 'Z' + 1));
+            const __m256i letterShift(_mm256_set1_epi8(static_cast<char>(hex_ ? 10 - 'A' : -'A')));
+            const __m256i pack(
+                _mm256_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+            std::size_t i(0);
+
+            // The output is only guaranteed to hold 5/8 of the input so the 16 byte stores must stay well behind the end
+            for(; i + 48 <= size_; i += 32, output_ += 20) {
+                const __m256i characters(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input_ + i)));
+                const __m256i digit(_mm256_and_si256(_mm256_cmpgt_epi8(characters, digitFirst), _mm256_cmpgt_epi8(digitLast, characters)));
+                const __m256i letter(_mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(letterLast, characters)));
+
+                if(_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1) {
+                    break;
+                }
+
+                const __m256i values(_mm256_add_epi8(characters, _mm256_blendv_epi8(letterShift, digitShift, digit)));
+                // 8 values of 5 bits become two 20-bit halves of a group per 64-bit element, which are then joined into 40 bits
+                const __m256i halves(_mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120)), _mm256_set1_epi32(0x00010400)));
+                const __m256i groups(_mm256_or_si256(_mm256_slli_epi64(_mm256_and_si256(halves, _mm256_set1_epi64x(0xFFFFFFFF)), 20),
+                                                     _mm256_srli_epi64(halves, 32)));
+                const __m256i bytes(_mm256_shuffle_epi8(groups, pack));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_), _mm256_castsi256_si128(bytes));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_ + 10), _mm256_extracti128_si256(bytes, 1));
+            }
+
+            return i;
+        }
+#endif
+
+        /**
+         * @brief Picks the vectorized Base32/Base32Hex functions for an InstructionSet.
+         * @param[in] instructionSet_ InstructionSet to be used. It must be supported by the processor.
+         * @returns Picked functions.
+        */
+        inline Base32Kernels MakeBase32Kernels(const InstructionSet instructionSet_) noexcept
+        {
+            switch(instructionSet_) {
+#if defined(BINARYTEXT_X86_SIMD)
+                case InstructionSet::AVX2: return Base32Kernels{&EncodeBase32BlocksAvx2, &DecodeBase32BlocksAvx2};
+#endif
+                default: return Base32Kernels{nullptr, nullptr};
+            }
+        }
+
+        /**
+         * @brief Gets the vectorized Base32/Base32Hex functions for the InstructionSet in use. They are picked once and cached afterwards.
+         * @returns Picked functions.
+        */
+        inline const Base32Kernels& GetBase32Kernels() noexcept
+        {
+            static const Base32Kernels kernels(MakeBase32Kernels(GetInstructionSet()));
+
+            return kernels;
+        }
+
+        /**
+         * @brief Encodes bytes into Base32/Base32Hex. The output must have room for Base32EncodedSize characters.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] alphabet_ Alphabet to be used.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] kernels_ Vectorized functions to be used.
+         * @returns Amount of characters written.
+        */
+        constexpr std::size_t EncodeBase32(const unsigned char* input_, const std::size_t inputSize_, char* output_, const std::string_view alphabet_,
+                                           const bool withPadding_, const Base32Kernels& kernels_ = GetBase32Kernels()) noexcept
+        {
+            std::size_t i((kernels_.encodeBlocks != nullptr) ? kernels_.encodeBlocks(input_, inputSize_, output_, alphabet_.data()) : 0);
+            std::size_t written((i / 5) * 8);
+
+            for(; i + 5 <= inputSize_; i += 5, written += 8) {
+                const std::uint64_t group((static_cast<std::uint64_t>(input_[i]) << 32) | (static_cast<std::uint64_t>(input_[i + 1]) << 24)
+                                          | (static_cast<std::uint64_t>(input_[i + 2]) << 16) | (static_cast<std::uint64_t>(input_[i + 3]) << 8)
+                                          | input_[i + 4]);
+
+                for(std::size_t j(0); j < 8; ++j) {
+                    output_[written + j] = alphabet_[static_cast<std::size_t>(group >> (35 - (5 * j))) & 0x1F];
+                }
+            }
+
+            return written + EncodeAlphabet<32>(input_ + i, inputSize_ - i, output_ + written, alphabet_.data(), withPadding_);
+        }
+
+        /**
+         * Decodes Base32/Base32Hex characters into bytes. The input is processed in groups of 8 characters, a group can only be padded with '=' at its end
+         * and decoding stops after the first padded or incomplete group. The output must have room for Base32MaximumDecodedSize bytes.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table created by MakeDecodeTable.
+         * @param[in] kernels_ Vectorized functions to be used, only for base32DecodeTable and base32HexDecodeTable.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeBase32(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                            const std::array<unsigned char, 256>& table_, const Base32Kernels& kernels_ = GetBase32Kernels()) noexcept
+        {
+            const bool hex(&table_ == &base32HexDecodeTable);
+            const bool hasKernel(kernels_.decodeBlocks != nullptr and (hex or &table_ == &base32DecodeTable));
+            std::size_t i(hasKernel ? kernels_.decodeBlocks(input_, inputSize_, output_, hex) : 0);
+            std::size_t written((i / 8) * 5);
+
+            for(; i + 8 <= inputSize_; i += 8, written += 5) {
+                std::uint64_t group(0);
+                unsigned char invalid(0);
+
+                for(std::size_t j(0); j < 8; ++j) {
+                    const unsigned char value(table_[static_cast<unsigned char>(input_[i + j])]);
+
+                    group = (group << 5) | (value & 0x1F);
+                    invalid |= value;
+                }
+
+                // Padding and characters outside of the alphabet are left to DecodeAlphabet, which also reports them
+                if(invalid >= 32) {
+                    break;
+                }
+
+                for(std::size_t j(0); j < 5; ++j) {
+                    output_[written + j] = static_cast<unsigned char>(group >> (32 - (8 * j)));
+                }
+            }
+
+            const DecodeResult result(DecodeAlphabet<32>(input_ + i, inputSize_ - i, output_ + written, table_));
+
+            return DecodeResult{written + result.size, result.isValid};
+        }
+
+        /**
+         * @brief Encodes bytes into Base32/Base32Hex on several threads. The output must have room for Base32EncodedSize characters.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] alphabet_ Alphabet to be used.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of characters written.
+        */
+        inline std::size_t EncodeBase32InParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const std::string_view alphabet_,
+                                                  const bool withPadding_, const std::size_t threadCount_) noexcept
+        {
+            return EncodeGroupsInParallel<5, 8>(input_, inputSize_, output_, threadCount_,
+                                                [alphabet_, withPadding_](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                                                    return EncodeBase32(bytes_, size_, characters_, alphabet_, withPadding_);
+                                                });
+        }
+
+        /**
+         * @brief Decodes Base32/Base32Hex characters into bytes on several threads. The output must have room for Base32MaximumDecodedSize bytes.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] table_ Table created by MakeDecodeTable.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeBase32InParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_,
+                                                   const std::array<unsigned char, 256>& table_, const std::size_t threadCount_) noexcept
+        {
+            return DecodeGroupsInParallel<8, 5>(input_, inputSize_, output_, threadCount_,
+                                                [&table_](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                                                    return DecodeBase32(characters_, size_, bytes_, table_);
+                                                });
+        }
+
+        /**
+         * The functions of the Base32 and Base32Hex namespaces, which only differ in their alphabet and decode table. The namespaces forward to
+         * them and document them.
+         *
+         * @tparam isHex_ Whether the alphabet is the Base32Hex alphabet of RFC 4648 §7 instead of the Base32 alphabet of RFC 4648 §6.
+        */
+        template<bool isHex_>
+        struct Base32AlphabetFunctions
+        {
+            static constexpr std::string_view alphabet = isHex_ ? base32HexAlphabet : base32Alphabet; ///< Alphabet the bytes are encoded with.
+            static constexpr const std::array<unsigned char, 256>& decodeTable = isHex_ ? base32HexDecodeTable : base32DecodeTable; ///< Table of alphabet.
+
+            /// @brief Base32::Error and Base32Hex::Error.
+            class Error : public std::exception
+            {
+            public:
+                /// @brief The type of Error.
+                enum class Type
+                {
+                    INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
+                    STRING_PARSE_ERROR,            ///< Failed to parse string.
+                    OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
+                };
+
+                /**
+                 * @brief Creates an Error of given Type.
+                 * @param[in] type_ Type of Error.
+                 * @param[in] sourceLocation_ Source location of Error.
+                */
+                explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
+                    _type(type_),
+                    _sourceLocation(sourceLocation_)
+                {
+                    switch(_type) {
+                        case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
+                        case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                        case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
+                        default: _what = "Invalid error type"; break;
+                    }
+                }
+
+                /**
+                 * @brief Gets the Type of the Error.
+                 * @returns Type of Error.
+                */
+                Type GetType() const noexcept { return _type; }
+                /**
+                 * @brief Gets the location at which the Error was thrown.
+                 * @returns Source location of Error.
+                */
+                std::source_location GetSourceLocation() const { return _sourceLocation; }
+                /**
+                 * @brief Gets reason for the Error.
+                 * @returns Reason for the Error.
+                */
+                std::string What() const { return _what; }
+
+                // For C++ compatibility purposes
+
+                const char* what() const noexcept override { return _what.c_str(); }
+
+            private:
+                Type _type;
+                std::source_location _sourceLocation;
+                std::string _what;
+            };
+
+            static_assert(charSize == 8, "These Base32 and Base32Hex functions only work if a char is 8 bits big");
+
+            static const std::error_category& GetErrorCategory() noexcept
+            {
+                static const ErrorCategory<Error> errorCategory(isHex_ ? "BinaryText::Base32Hex" : "BinaryText::Base32");
+
+                return errorCategory;
+            }
+
+            static std::error_code MakeErrorCode(const Error::Type type_) noexcept { return std::error_code(static_cast<int>(type_) + 1, GetErrorCategory()); }
+
+            static constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+            {
+                return Base32EncodedSize(size_, withPadding_);
+            }
+
+            static constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Base32MaximumDecodedSize(size_); }
+
+            static constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+            {
+                return AlphabetEncodedSize<32>(CheckFileSize(size_, 5, 8), withPadding_);
+            }
+
+            static constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept
+            {
+                return AlphabetMaximumDecodedSize<32, std::uint64_t>(size_);
+            }
+
+            template<ConstantString string_, bool withPadding_ = true>
+            static consteval auto EncodeArray() noexcept
+            {
+                constexpr auto encode([](const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                    return EncodeBase32(input_, inputSize_, output_, alphabet, withPadding_, Base32Kernels{});
+                });
+                constexpr auto encoded(EncodeConstant<EncodedSize(string_.characters.size(), withPadding_)>(string_, encode));
+
+                return encoded.values;
+            }
+
+            template<ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+            static consteval auto DecodeArray() noexcept
+            {
+                constexpr auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32(input_, inputSize_, output_, decodeTable, Base32Kernels{});
+                });
+                constexpr auto decoded(DecodeConstant<MaximumDecodedSize(encodedString_.characters.size())>(encodedString_, decode));
+
+                static_assert(decoded.isValid, "The string literal is not valid Base32 or Base32Hex");
+
+                return MakeConstantArray<ByteType, decoded.size>(decoded);
+            }
+
+            static std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+            {
+                std::string encodedString;
+
+                if(string_.size() > (encodedString.max_size() / 8) * 5) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(Base32EncodedSize(string_.size(), withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase32InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(),
+                                       alphabet, withPadding_, threadCount_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true,
+                                                        const std::size_t threadCount_ = 1)
+            {
+                std::string encodedString;
+
+                if(byteBuffer_.IsEmpty()) {
+                    return encodedString;
+                } else if(byteBuffer_.GetSize() > (encodedString.max_size() / 8) * 5) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(Base32EncodedSize(byteBuffer_.GetSize(), withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase32InParallel(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(), encodedString.data(),
+                                       alphabet, withPadding_, threadCount_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true,
+                                                        const std::size_t threadCount_ = 1)
+            {
+                return EncodeStringToString(ViewAsCharacters(byteBufferView_), withPadding_, threadCount_);
+            }
+
+            static void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                if(string_.size() > (encodedString_.max_size() / 8) * 5) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                const auto encode([string_, withPadding_, threadCount_](char* output_) noexcept {
+                    return EncodeBase32InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), output_,
+                                                  alphabet, withPadding_, threadCount_);
+                });
+
+                EncodeIntoString<Error>(encodedString_, EncodedSize(string_.size(), withPadding_), encode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                EncodeInto(ViewAsCharacters(byteBuffer_), encodedString_, withPadding_, threadCount_);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                EncodeInto(ViewAsCharacters(byteBufferView_), encodedString_, withPadding_, threadCount_);
+            }
+
+            static std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+            {
+                std::string decodedString;
+
+                try {
+                    decodedString.resize(Base32MaximumDecodedSize(encodedString_.size()));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                const DecodeResult result(DecodeBase32InParallel(encodedString_.data(), encodedString_.size(),
+                                                                 reinterpret_cast<unsigned char*>(decodedString.data()), decodeTable, threadCount_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedString.resize(result.size);
+
+                return decodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr)
+            {
+                ByteBuffer<ByteType> decodedByteBuffer(Base32MaximumDecodedSize(encodedString_.size()), uninitialized, memoryResource_);
+                const DecodeResult result(DecodeBase32InParallel(encodedString_.data(), encodedString_.size(),
+                                                                 reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), decodeTable, threadCount_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedByteBuffer.Resize(result.size);
+
+                return decodedByteBuffer;
+            }
+
+            static Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32InParallel(input_, inputSize_, output_, decodeTable, threadCount_);
+                });
+
+                return TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_.size()), MakeErrorCode, decode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                            std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32InParallel(input_, inputSize_, output_, decodeTable, threadCount_);
+                });
+
+                return TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_.size()), memoryResource_,
+                                                              MakeErrorCode, decode);
+            }
+
+            static void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32InParallel(input_, inputSize_, output_, decodeTable, threadCount_);
+                });
+
+                DecodeIntoString<Error>(encodedString_, decodedString_, MaximumDecodedSize(encodedString_.size()), decode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32InParallel(input_, inputSize_, output_, decodeTable, threadCount_);
+                });
+
+                DecodeIntoByteBuffer<Error>(encodedString_, decodedByteBuffer_, MaximumDecodedSize(encodedString_.size()), decode);
+            }
+
+            template<typename ByteType, typename EncodedByteType>
+                requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+            static ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                                     std::pmr::memory_resource* memoryResource_ = nullptr)
+            {
+                return DecodeStringToByteBuffer<ByteType>(ViewAsCharacters(encodedByteBuffer_), threadCount_, memoryResource_);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferCompatible<ByteType>
+            static void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+            {
+                const auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase32(input_, inputSize_, output_, decodeTable);
+                });
+
+                if(not DecodeInPlace(byteBuffer_, decode)) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+            }
+
+            static ValidationResult Validate(const std::string_view input_) noexcept
+            {
+                const auto decode([](const char* characters_, const std::size_t size_, unsigned char* output_) noexcept {
+                    return DecodeBase32(characters_, size_, output_, decodeTable);
+                });
+
+                return ValidateGroups<8, 5>(input_, decode);
+            }
+
+            static std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                      const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+            {
+                if(output_.size() < EncodedSize(input_.size(), withPadding_)) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return EncodeBase32InParallel(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(),
+                                              alphabet, withPadding_, threadCount_);
+            }
+
+            static std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                      const std::size_t threadCount_ = 1) noexcept
+            {
+                if(output_.size() < MaximumDecodedSize(input_.size())) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                const DecodeResult result(
+                    DecodeBase32InParallel(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), decodeTable, threadCount_));
+
+                if(not result.isValid) {
+                    errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return result.size;
+            }
+
+            /// @brief Base32::Encoder and Base32Hex::Encoder.
+            class Encoder
+            {
+            public:
+                /**
+                 * @brief Creates an Encoder.
+                 * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+                */
+                explicit Encoder(const bool withPadding_ = true) noexcept :
+                    _state(),
+                    _withPadding(withPadding_)
+                {}
+
+                /**
+                 * @brief Calculates the maximum amount of characters Update writes.
+                 * @param[in] inputSize_ Amount of bytes passed to Update.
+                 * @returns Maximum amount of characters written.
+                */
+                static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return ((inputSize_ + 4) / 5) * 8; }
+                /**
+                 * @brief Calculates the maximum amount of characters Finish writes.
+                 * @returns Maximum amount of characters written.
+                */
+                static constexpr std::size_t GetMaximumFinishSize() noexcept { return 8; }
+
+                /**
+                 * @brief Encodes the next piece of the input. Bytes that do not fill a whole group of 5 are kept until the next call.
+                 * @param[in] input_ Bytes to be encoded.
+                 * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumUpdateSize(input_.size()) characters.
+                 * @returns Amount of characters written.
+                 * @throws Error
+                */
+                std::size_t Update(const std::span<const std::byte> input_, const std::span<char> output_)
+                {
+                    if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                        return EncodeBase32(bytes_, size_, characters_, alphabet, _withPadding);
+                    });
+
+                    return UpdateGroupEncoder(_state, reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), encode);
+                }
+                /**
+                 * @brief Encodes the kept bytes and adds the padding. The Encoder can be used for a new input afterwards.
+                 * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumFinishSize() characters.
+                 * @returns Amount of characters written.
+                 * @throws Error
+                */
+                std::size_t Finish(const std::span<char> output_)
+                {
+                    if(output_.size() < GetMaximumFinishSize()) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                        return EncodeBase32(bytes_, size_, characters_, alphabet, _withPadding);
+                    });
+
+                    return FinishGroupEncoder(_state, output_.data(), encode);
+                }
+                /// @brief Discards the kept bytes.
+                void Reset() noexcept { _state = GroupEncodeState<5>(); }
+
+            private:
+                GroupEncodeState<5> _state;
+                bool _withPadding;
+            };
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+            {
+                Encoder encoder(withPadding_);
+
+                return EncodeByteBufferViews<Error>(encoder, byteBufferViews_);
+            }
+
+            /// @brief Base32::Decoder and Base32Hex::Decoder.
+            class Decoder
+            {
+            public:
+                /// @brief Creates a Decoder.
+                Decoder() noexcept :
+                    _state()
+                {}
+
+                /**
+                 * @brief Calculates the maximum amount of bytes Update writes.
+                 * @param[in] inputSize_ Amount of characters passed to Update.
+                 * @returns Maximum amount of bytes written.
+                */
+                static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return ((inputSize_ + 7) / 8) * 5; }
+                /**
+                 * @brief Calculates the maximum amount of bytes Finish writes.
+                 * @returns Maximum amount of bytes written.
+                */
+                static constexpr std::size_t GetMaximumFinishSize() noexcept { return 4; }
+
+                /**
+                 * Decodes the next piece of the input. Characters that do not fill a whole group of 8 are kept until the next call. After an Error the Decoder
+                 * has to be Reset before it can be used again.
+                 *
+                 * @param[in] input_ Characters to be decoded.
+                 * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumUpdateSize(input_.size()) bytes.
+                 * @returns Amount of bytes written.
+                 * @throws Error
+                */
+                std::size_t Update(const std::string_view input_, const std::span<std::byte> output_)
+                {
+                    if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto decode([](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                        return DecodeBase32(characters_, size_, bytes_, decodeTable);
+                    });
+                    const DecodeResult result(UpdateGroupDecoder(_state, input_.data(), input_.size(),
+                                                                 reinterpret_cast<unsigned char*>(output_.data()), decode));
+
+                    if(not result.isValid) {
+                        throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    return result.size;
+                }
+                /**
+                 * @brief Decodes the kept characters as the last, incomplete group. The Decoder can be used for a new input afterwards.
+                 * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumFinishSize() bytes.
+                 * @returns Amount of bytes written.
+                 * @throws Error
+                */
+                std::size_t Finish(const std::span<std::byte> output_)
+                {
+                    if(output_.size() < GetMaximumFinishSize()) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto decode([](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                        return DecodeBase32(characters_, size_, bytes_, decodeTable);
+                    });
+                    const DecodeResult result(FinishGroupDecoder(_state, reinterpret_cast<unsigned char*>(output_.data()), decode));
+
+                    if(not result.isValid) {
+                        throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    return result.size;
+                }
+                /// @brief Discards the kept characters.
+                void Reset() noexcept { _state = GroupDecodeState<8, 5>(); }
+
+            private:
+                GroupDecodeState<8, 5> _state;
+            };
+        };
+
+        /// @brief The functions of the Base32 namespace.
+        using Base32Functions = Base32AlphabetFunctions<false>;
+        /// @brief The functions of the Base32Hex namespace.
+        using Base32HexFunctions = Base32AlphabetFunctions<true>;
+    }
+
+    /// @brief A namespace that has functions that implement Base32 encoding and decoding in accordance to RFC 4648 §6.
+    namespace Base32
+    {
+        /// @brief A simple error class for the Base32 namespace.
+        using Error = Internal::Base32Functions::Error;
+
+        /**
+         * @brief Gets the category of the error codes set by the non-throwing functions.
+         * @returns Error category of the Base32 namespace.
+        */
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            return Internal::Base32Functions::GetErrorCategory();
+        }
+        /**
+         * @brief Creates an error code of given Type.
+         * @param[in] type_ Type of Error.
+         * @returns Error code in the category returned by GetErrorCategory.
+        */
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return Internal::Base32Functions::MakeErrorCode(type_); }
+        /**
+         * @brief Calculates the size of a Base32 encoded string.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base32Functions::EncodedSize(size_, withPadding_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base32 encoded string can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Internal::Base32Functions::MaximumDecodedSize(size_); }
+        /**
+         * @brief Calculates the size of a Base32 encoded file, which can be larger than memory and than std::size_t (see BinaryText::Files).
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded file will have.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+        {
+            return Internal::Base32Functions::EncodedFileSize(size_, withPadding_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base32 encoded file can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept
+        {
+            return Internal::Base32Functions::MaximumDecodedFileSize(size_);
+        }
+
+        /**
+         * Encodes a string literal into Base32 at compile time, for constants that should not cost anything at run time. The std::array has exactly
+         * EncodedSize characters and no terminating null character.
+         *
+         * @tparam string_ String literal to be encoded.
+         * @tparam withPadding_ Whether or not padding (the '=' character) should be included.
+         * @returns Encoded characters.
+        */
+        template<Internal::ConstantString string_, bool withPadding_ = true>
+        consteval std::array<char, EncodedSize(string_.characters.size(), withPadding_)> EncodeArray() noexcept
+        {
+            return Internal::Base32Functions::EncodeArray<string_, withPadding_>();
+        }
+        /**
+         * @brief Decodes a Base32 string literal at compile time, a string literal that is not valid Base32 does not compile.
+         * @tparam encodedString_ String literal to be decoded.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @returns Decoded bytes, in a std::array of exactly their amount.
+        */
+        template<Internal::ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            return Internal::Base32Functions::DecodeArray<encodedString_, ByteType>();
+        }
+
+        /**
+         * @brief Encodes a not-encoded string into a Base32 encoded string.
+         * @param[in] string_ String to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32Functions::EncodeStringToString(string_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base32 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32Functions::EncodeByteBufferToString<ByteType>(byteBuffer_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base32 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32Functions::EncodeByteBufferToString<ByteType>(byteBufferView_, withPadding_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into a Base32 encoded string of the caller, like EncodeStringToString but reusing the capacity of the string, so
+         * that encoding many inputs into the same string does not allocate once it is big enough.
+         *
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32Functions::EncodeInto(string_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base32 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32Functions::EncodeInto<ByteType>(byteBuffer_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base32 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32Functions::EncodeInto<ByteType>(byteBufferView_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Decodes a Base32 encoded string into a decoded string. Whitespace and newline characters are not ignored.
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32Functions::DecodeStringToString(encodedString_, threadCount_);
+        }
+        /**
+         * @brief Decodes a Base32 encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base32::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base32Functions::DecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes a Base32 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing.
+         * Whitespace and newline characters are not ignored.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32Functions::TryDecodeStringToString(encodedString_, threadCount_);
+        }
+        /**
+         * Decodes a Base32 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing. A
+         * ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace and newline characters are not ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base32Functions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes a Base32 encoded string into a decoded string of the caller, like DecodeStringToString but reusing the capacity of the string, so
+         * that decoding many inputs into the same string does not allocate once it is big enough. If an Error is thrown the string is left empty.
+         * Whitespace and newline characters are not ignored.
+         *
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedString_.
+         * @param[out] decodedString_ String the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+        */
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32Functions::DecodeInto(encodedString_, decodedString_, threadCount_);
+        }
+        /**
+         * Decodes a Base32 encoded string into a decoded ByteBuffer of the caller, like DecodeStringToByteBuffer but reusing the capacity of the
+         * ByteBuffer and without initializing its bytes first. If an Error is thrown the ByteBuffer is left empty. Whitespace and newline characters are not
+         * ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedByteBuffer_.
+         * @param[out] decodedByteBuffer_ ByteBuffer the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base32::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32Functions::DecodeInto<ByteType>(encodedString_, decodedByteBuffer_, threadCount_);
+        }
+
+        /**
+         * @brief Decodes Base32 encoded characters held by a ByteBuffer into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @tparam EncodedByteType Type of the encoded ByteBuffer that satisfies the ByteBufferCompatible concept.
+         * @param[in] encodedByteBuffer_ ByteBuffer to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base32::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base32Functions::DecodeByteBufferToByteBuffer<ByteType, EncodedByteType>(encodedByteBuffer_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes Base32 encoded characters held by a ByteBuffer into the ByteBuffer itself, the decoded bytes overwrite the characters and the ByteBuffer is
+         * shrunk to fit them, so no second buffer is needed. Whitespace and newline characters are not ignored. If an Error is thrown the ByteBuffer is
+         * cleared.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @throws BinaryText::Base32::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+        {
+            Internal::Base32Functions::DecodeByteBufferInPlace<ByteType>(byteBuffer_);
+        }
+
+        /**
+         * Checks whether Base32 encoded characters can be decoded, by the same rules as the decoding functions but without keeping the decoded bytes.
+         * Nothing is allocated and nothing is thrown. Whitespace and newline characters are not ignored.
+         *
+         * @param[in] input_ Characters to be checked.
+         * @returns Whether or not the input is valid, the exact decoded size and the offset of the first group that cannot be decoded.
+        */
+        inline ValidationResult Validate(const std::string_view input_) noexcept
+        {
+            return Internal::Base32Functions::Validate(input_);
+        }
+
+        /**
+         * @brief Encodes bytes into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for EncodedSize(input_.size(), withPadding_) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of characters written, 0 on error.
+        */
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32Functions::Encode(input_, output_, errorCode_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Decodes Base32 characters into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_.size()) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32Functions::Decode(input_, output_, errorCode_, threadCount_);
+        }
+
+        /// @brief Encodes Base32 piece by piece. Splitting the input at any point gives the same result as encoding it at once.
+        using Encoder = Internal::Base32Functions::Encoder;
+
+        /**
+         * Encodes several ByteBufferViews one after another into a Base32 encoded string, as if they were one ByteBuffer. A message made of several
+         * parts, such as a header and a Subview of a big payload, is encoded this way without concatenating the parts first.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferViews_ ByteBufferViews to be encoded, in order.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @throws BinaryText::Base32::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+        {
+            return Internal::Base32Functions::EncodeByteBufferViewsToString<ByteType>(byteBufferViews_, withPadding_);
+        }
+
+        /**
+         * Decodes Base32 piece by piece. Splitting the input at any point gives the same result as decoding it at once, everything after the first padded
+         * group is ignored.
+        */
+        using Decoder = Internal::Base32Functions::Decoder;
+    };
+
+    /// @brief A namespace that has functions that implement Base32Hex encoding and decoding in accordance to RFC 4648 §7.
+    namespace Base32Hex
+    {
+        /// @brief Base32::Error of the Base32Hex namespace.
+        using Error = Internal::Base32HexFunctions::Error;
+
+        /// @brief Base32::GetErrorCategory with the Base32Hex alphabet.
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            return Internal::Base32HexFunctions::GetErrorCategory();
+        }
+        /// @brief Base32::MakeErrorCode with the Base32Hex alphabet.
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return Internal::Base32HexFunctions::MakeErrorCode(type_); }
+        /// @brief Base32::EncodedSize with the Base32Hex alphabet.
+        constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base32HexFunctions::EncodedSize(size_, withPadding_);
+        }
+        /// @brief Base32::MaximumDecodedSize with the Base32Hex alphabet.
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Internal::Base32HexFunctions::MaximumDecodedSize(size_); }
+        /// @brief Base32::EncodedFileSize with the Base32Hex alphabet.
+        constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+        {
+            return Internal::Base32HexFunctions::EncodedFileSize(size_, withPadding_);
+        }
+        /// @brief Base32::MaximumDecodedFileSize with the Base32Hex alphabet.
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept
+        {
+            return Internal::Base32HexFunctions::MaximumDecodedFileSize(size_);
+        }
+
+        /// @brief Base32::EncodeArray with the Base32Hex alphabet.
+        template<Internal::ConstantString string_, bool withPadding_ = true>
+        consteval std::array<char, EncodedSize(string_.characters.size(), withPadding_)> EncodeArray() noexcept
+        {
+            return Internal::Base32HexFunctions::EncodeArray<string_, withPadding_>();
+        }
+        /// @brief Base32::DecodeArray with the Base32Hex alphabet.
+        template<Internal::ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            return Internal::Base32HexFunctions::DecodeArray<encodedString_, ByteType>();
+        }
+
+        /// @brief Base32::EncodeStringToString with the Base32Hex alphabet.
+        inline std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32HexFunctions::EncodeStringToString(string_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::EncodeByteBufferToString with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32HexFunctions::EncodeByteBufferToString<ByteType>(byteBuffer_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::EncodeByteBufferToString with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32HexFunctions::EncodeByteBufferToString<ByteType>(byteBufferView_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::EncodeInto with the Base32Hex alphabet.
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32HexFunctions::EncodeInto(string_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::EncodeInto with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32HexFunctions::EncodeInto<ByteType>(byteBuffer_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::EncodeInto with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32HexFunctions::EncodeInto<ByteType>(byteBufferView_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::DecodeStringToString with the Base32Hex alphabet.
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base32HexFunctions::DecodeStringToString(encodedString_, threadCount_);
+        }
+        /// @brief Base32::DecodeStringToByteBuffer with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base32HexFunctions::DecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /// @brief Base32::TryDecodeStringToString with the Base32Hex alphabet.
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32HexFunctions::TryDecodeStringToString(encodedString_, threadCount_);
+        }
+        /// @brief Base32::TryDecodeStringToByteBuffer with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base32HexFunctions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /// @brief Base32::DecodeInto with the Base32Hex alphabet.
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32HexFunctions::DecodeInto(encodedString_, decodedString_, threadCount_);
+        }
+        /// @brief Base32::DecodeInto with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base32HexFunctions::DecodeInto<ByteType>(encodedString_, decodedByteBuffer_, threadCount_);
+        }
+
+        /// @brief Base32::DecodeByteBufferToByteBuffer with the Base32Hex alphabet.
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base32HexFunctions::DecodeByteBufferToByteBuffer<ByteType, EncodedByteType>(encodedByteBuffer_, threadCount_, memoryResource_);
+        }
+        /// @brief Base32::DecodeByteBufferInPlace with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+        {
+            Internal::Base32HexFunctions::DecodeByteBufferInPlace<ByteType>(byteBuffer_);
+        }
+
+        /// @brief Base32::Validate with the Base32Hex alphabet.
+        inline ValidationResult Validate(const std::string_view input_) noexcept
+        {
+            return Internal::Base32HexFunctions::Validate(input_);
+        }
+
+        /// @brief Base32::Encode with the Base32Hex alphabet.
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32HexFunctions::Encode(input_, output_, errorCode_, withPadding_, threadCount_);
+        }
+        /// @brief Base32::Decode with the Base32Hex alphabet.
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base32HexFunctions::Decode(input_, output_, errorCode_, threadCount_);
+        }
+
+        /// @brief Base32::Encoder of the Base32Hex namespace.
+        using Encoder = Internal::Base32HexFunctions::Encoder;
+
+        /// @brief Base32::EncodeByteBufferViewsToString with the Base32Hex alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+        {
+            return Internal::Base32HexFunctions::EncodeByteBufferViewsToString<ByteType>(byteBufferViews_, withPadding_);
+        }
+
+        /// @brief Base32::Decoder of the Base32Hex namespace.
+        using Decoder = Internal::Base32HexFunctions::Decoder;
+    };
+
+    namespace Internal
+    {
+        /// @brief Base64 alphabet in accordance to RFC 4648 §4.
+        constexpr std::string_view base64Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        /// @brief Base64Url alphabet in accordance to RFC 4648 §5.
+        constexpr std::string_view base64UrlAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+        constexpr std::array<unsigned char, 256> base64DecodeTable = MakeDecodeTable(base64Alphabet);
+        constexpr std::array<unsigned char, 256> base64UrlDecodeTable = MakeDecodeTable(base64UrlAlphabet);
+
+        /**
+         * @brief Calculates the size of a Base64/Base64Url encoded string.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        constexpr std::size_t Base64EncodedSize(const std::size_t size_, const bool withPadding_) noexcept
+        {
+            return AlphabetEncodedSize<64>(size_, withPadding_);
+        }
+
+        /**
+         * @brief Calculates the maximum amount of bytes a Base64/Base64Url encoded string can be decoded into.
+         * @tparam SizeType std::size_t for strings, std::uint64_t for files that can be larger than memory.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        template<std::unsigned_integral SizeType = std::size_t>
+        constexpr SizeType Base64MaximumDecodedSize(const SizeType size_) noexcept
+        {
+            return static_cast<SizeType>(((size_ / 4) * 3) + (size_ % 4));
+        }
+
+        /**
+         * Signature of the vectorized Base64 encoding functions. They encode as many whole blocks as they can and leave the rest for the scalar code.
+         * The output must have room for the entire encoded input.
+         *
+         * Arguments are the input bytes, the amount of input bytes, the output and whether or not the Base64Url alphabet is used.
+         * The amount of input bytes consumed (always a multiple of 3) is returned.
+        */
+        using Base64EncodeBlocksFunction = std::size_t (*)(const unsigned char*, std::size_t, char*, bool) noexcept;
+        /**
+         * Signature of the vectorized Base64 decoding functions. They decode whole blocks until one contains a character that is not part of the alphabet
+         * (padding included) and leave the rest for the scalar code. The output must have room for Base64MaximumDecodedSize bytes.
+         *
+         * Arguments are the input characters, the amount of input characters, the output and whether or not the Base64Url alphabet is used.
+         * The amount of input characters consumed (always a multiple of 4) is returned.
+        */
+        using Base64DecodeBlocksFunction = std::size_t (*)(const char*, std::size_t, unsigned char*, bool) noexcept;
+
+        /// @brief Vectorized Base64 functions picked for an InstructionSet.
+        struct Base64Kernels
+        {
+            Base64EncodeBlocksFunction encodeBlocks; ///< Block encoder, can be nullptr.
+            Base64DecodeBlocksFunction decodeBlocks; ///< Block decoder, can be nullptr.
+        };
+
+#if defined(BINARYTEXT_X86_SIMD)
+        /// @brief Translates 16 6-bit values into Base64/Base64Url characters.
+        BINARYTEXT_TARGET("sse4.1") inline __m128i TranslateBase64Sse41(const __m128i indices_, const bool url_) noexcept
+        {
+            const char shift62(static_cast<char>((url_ ? '-' : '+') - 62));
+            const char shift63(static_cast<char>((url_ ? '_' : '/') - 63));
+            const __m128i shiftTable(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, shift62, shift63, 'A', 0, 0));
+            __m128i result(_mm_subs_epu8(indices_, _mm_set1_epi8(51)));
+
+            result = _mm_or_si128(result, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices_), _mm_set1_epi8(13)));
+
+            return _mm_add_epi8(_mm_shuffle_epi8(shiftTable, result), indices_);
+        }
+
+        /// @brief Base64EncodeBlocksFunction that handles 12 bytes per iteration using SSE4.1.
+        BINARYTEXT_TARGET("sse4.1") inline std::size_t EncodeBase64BlocksSse41(const unsigned char* input_, const std::size_t size_, char* output_,
+                                                                               const bool url_) noexcept
+        {
+            const __m128i shuffle(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+            std::size_t i(0);
+
+            for(; i + 16 <= size_; i += 12, output_ += 16) {
+                const __m128i bytes(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i)), shuffle));
+                const __m128i high(_mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)));
+                const __m128i low(_mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_), TranslateBase64Sse41(_mm_or_si128(high, low), url_));
+            }
+
+            return i;
+        }
+
+        /// @brief Base64DecodeBlocksFunction that handles 16 characters per iteration using SSE4.1.
+        BINARYTEXT_TARGET("sse4.1") inline std::size_t DecodeBase64BlocksSse41(const char* input_, const std::size_t size_, unsigned char* output_,
+                                                                               const bool url_) noexcept
+        {
+            const __m128i pack(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            const __m128i character62(_mm_set1_epi8(url_ ? '-' : '+'));
+            const __m128i character63(_mm_set1_epi8(url_ ? '_' : '/'));
+            const __m128i shift62(_mm_set1_epi8(static_cast<char>(62 - (url_ ? '-' : '+'))));
+            const __m128i shift63(_mm_set1_epi8(static_cast<char>(63 - (url_ ? '_' : '/'))));
+            std::size_t i(0);
+
+            // The output is only guaranteed to hold 3/4 of the input so the 16 byte stores must stay well behind the end
+            for(; i + 32 <= size_; i += 16, output_ += 12) {
+                const __m128i characters(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i)));
+                const __m128i uppercase(_mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), characters)));
+                const __m128i lowercase(_mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), characters)));
+                const __m128i digit(_mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), characters)));
+                const __m128i is62(_mm_cmpeq_epi8(characters, character62));
+                const __m128i is63(_mm_cmpeq_epi8(characters, character63));
+                const __m128i valid(_mm_or_si128(_mm_or_si128(_mm_or_si128(uppercase, lowercase), _mm_or_si128(digit, is62)), is63));
+
+                if(_mm_movemask_epi8(valid) != 0xFFFF) {
+                    break;
+                }
+
+                __m128i shift(_mm_and_si128(uppercase, _mm_set1_epi8(-'A')));
+                shift = _mm_or_si128(shift, _mm_and_si128(lowercase, _mm_set1_epi8(26 - 'a')));
+                shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+                shift = _mm_or_si128(shift, _mm_or_si128(_mm_and_si128(is62, shift62), _mm_and_si128(is63, shift63)));
+
+                const __m128i values(_mm_add_epi8(characters, shift));
+                const __m128i merged(_mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output_), _mm_shuffle_epi8(merged, pack));
+            }
+
+            return i;
+        }
+
+        /// @brief Translates 32 6-bit values into Base64/Base64Url characters.
+        BINARYTEXT_TARGET("avx2") inline __m256i TranslateBase64Avx2(const __m256i indices_, const bool url_) noexcept
+        {
+            const char shift62(static_cast<char>((url_ ? '-' : '+') - 62));
+            const char shift63(static_cast<char>((url_ ? '_' : '/') - 63));
+            const __m256i shiftTable(_mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                      '0' - 52, shift62, shift63, 'A', 0, 0, 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, shift62, shift63, 'A', 0, 0));
+            __m256i result(_mm256_subs_epu8(indices_, _mm256_set1_epi8(51)));
+
+            result = _mm256_or_si256(result, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices_), _mm256_set1_epi8(13)));
+
+            return _mm256_add_epi8(_mm256_shuffle_epi8(shiftTable, result), indices_);
+        }
+
+        /// @brief Base64EncodeBlocksFunction that handles 24 bytes per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t EncodeBase64BlocksAvx2(const unsigned char* input_, const std::size_t size_, char* output_,
+                                                                            const bool url_) noexcept
+        {
+            const __m256i shuffle(_mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+            std::size_t i(0);
+
+            for(; i + 28 <= size_; i += 24, output_ += 32) {
+                const __m128i first(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i)));
+                const __m128i second(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input_ + i + 12)));
+                const __m256i bytes(_mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1), shuffle));
+                const __m256i high(_mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040)));
+                const __m256i low(_mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_), TranslateBase64Avx2(_mm256_or_si256(high, low), url_));
+            }
+
+            return i + EncodeBase64BlocksSse41(input_ + i, size_ - i, output_, url_);
+        }
+
+        /// @brief Base64DecodeBlocksFunction that handles 32 characters per iteration using AVX2.
+        BINARYTEXT_TARGET("avx2") inline std::size_t DecodeBase64BlocksAvx2(const char* input_, const std::size_t size_, unsigned char* output_,
+                                                                            const bool url_) noexcept
+        {
+            const __m256i pack(
+                _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            const __m256i character62(_mm256_set1_epi8(url_ ? '-' : '+'));
+            const __m256i character63(_mm256_set1_epi8(url_ ? '_' : '/'));
+            const __m256i shift62(_mm256_set1_epi8(static_cast<char>(62 - (url_ ? '-' : '+'))));
+            const __m256i shift63(_mm256_set1_epi8(static_cast<char>(63 - (url_ ? '_' : '/'))));
+            std::size_t i(0);
+
+            // The output is only guaranteed to hold 3/4 of the input so the 32 byte stores must stay well behind the end
+            for(; i + 64 <= size_; i += 32, output_ += 24) {
+                const __m256i characters(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input_ + i)));
+                const __m256i uppercase(
+                    _mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), characters)));
+                const __m256i lowercase(
+                    _mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), characters)));
+                const __m256i digit(
+                    _mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters)));
+                const __m256i is62(_mm256_cmpeq_epi8(characters, character62));
+                const __m256i is63(_mm256_cmpeq_epi8(characters, character63));
+                const __m256i valid(_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(uppercase, lowercase), _mm256_or_si256(digit, is62)), is63));
+
+                if(_mm256_movemask_epi8(valid) != -1) {
+                    break;
+                }
+
+                __m256i shift(_mm256_and_si256(uppercase, _mm256_set1_epi8(-'A')));
+                shift = _mm256_or_si256(shift, _mm256_and_si256(lowercase, _mm256_set1_epi8(26 - 'a')));
+                shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+                shift = _mm256_or_si256(shift, _mm256_or_si256(_mm256_and_si256(is62, shift62), _mm256_and_si256(is63, shift63)));
+
+                const __m256i values(_mm256_add_epi8(characters, shift));
+                const __m256i merged(_mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000)));
+                const __m256i packed(_mm256_shuffle_epi8(merged, pack));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_), _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+            }
+
+            return i + DecodeBase64BlocksSse41(input_ + i, size_ - i, output_, url_);
+        }
+#endif
+
+#if defined(BINARYTEXT_NEON_SIMD)
+        /// @brief Base64EncodeBlocksFunction that handles 48 bytes per iteration using NEON.
+        inline std::size_t EncodeBase64BlocksNeon(const unsigned char* input_, const std::size_t size_, char* output_, const bool url_) noexcept
+        {
+            const std::string_view alphabet(url_ ? base64UrlAlphabet : base64Alphabet);
+            const uint8x16x4_t table{{vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.data())),
+                                      vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.data()) + 16),
+                                      vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.data()) + 32),
+                                      vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.data()) + 48)}};
+            std::size_t i(0);
+
+            for(; i + 48 <= size_; i += 48, output_ += 64) {
+                const uint8x16x3_t bytes(vld3q_u8(input_ + i));
+                uint8x16x4_t characters;
+
+                characters.val[0] = vqtbl4q_u8(table, vshrq_n_u8(bytes.val[0], 2));
+                characters.val[1] = vqtbl4q_u8(table, vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(bytes.val[1], 4)));
+                characters.val[2] = vqtbl4q_u8(table, vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(bytes.val[2], 6)));
+                characters.val[3] = vqtbl4q_u8(table, vandq_u8(bytes.val[2], vdupq_n_u8(0x3F)));
+
+                vst4q_u8(reinterpret_cast<std::uint8_t*>(output_), characters);
+            }
+
+            return i;
+        }
+
+        /// @brief Base64DecodeBlocksFunction that handles 64 characters per iteration using NEON.
+        inline std::size_t DecodeBase64BlocksNeon(const char* input_, const std::size_t size_, unsigned char* output_, const bool url_) noexcept
+        {
+            const std::uint8_t* decodeTable(url_ ? base64UrlDecodeTable.data() : base64DecodeTable.data());
+            const uint8x16x4_t lowTable{{vld1q_u8(decodeTable), vld1q_u8(decodeTable + 16), vld1q_u8(decodeTable + 32), vld1q_u8(decodeTable + 48)}};
+            const uint8x16x4_t highTable{{vld1q_u8(decodeTable + 64), vld1q_u8(decodeTable + 80), vld1q_u8(decodeTable + 96), vld1q_u8(decodeTable + 112)}};
+            std::size_t i(0);
+
+            for(; i + 64 <= size_; i += 64, output_ += 48) {
+                const uint8x16x4_t characters(vld4q_u8(reinterpret_cast<const std::uint8_t*>(input_ + i)));
+                uint8x16x4_t values;
+                uint8x16_t invalid(vdupq_n_u8(0));
+
+                for(int j(0); j < 4; ++j) {
+                    values.val[j] = vorrq_u8(vqtbl4q_u8(lowTable, characters.val[j]), vqtbl4q_u8(highTable, vsubq_u8(characters.val[j], vdupq_n_u8(64))));
+                    invalid = vorrq_u8(invalid, vorrq_u8(vcgtq_u8(values.val[j], vdupq_n_u8(63)), vcgeq_u8(characters.val[j], vdupq_n_u8(128))));
+                }
+
+                if(vmaxvq_u8(invalid) != 0) {
+                    break;
+                }
+
+                uint8x16x3_t bytes;
+
+                bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+                bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+                bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+
+                vst3q_u8(output_, bytes);
+            }
+
+            return i;
+        }
+#endif
+
+        /**
+         * @brief Picks the vectorized Base64 functions for an InstructionSet.
+         * @param[in] instructionSet_ InstructionSet to be used. It must be supported by the processor.
+         * @returns Picked functions.
+        */
+        inline Base64Kernels MakeBase64Kernels(const InstructionSet instructionSet_) noexcept
+        {
+            switch(instructionSet_) {
+#if defined(BINARYTEXT_X86_SIMD)
+                case InstructionSet::AVX2: return Base64Kernels{&EncodeBase64BlocksAvx2, &DecodeBase64BlocksAvx2};
+                case InstructionSet::SSE4_1: return Base64Kernels{&EncodeBase64BlocksSse41, &DecodeBase64BlocksSse41};
+#endif
+#if defined(BINARYTEXT_NEON_SIMD)
+                case InstructionSet::NEON: return Base64Kernels{&EncodeBase64BlocksNeon, &DecodeBase64BlocksNeon};
+#endif
+                default: return Base64Kernels{nullptr, nullptr};
+            }
+        }
+
+        /**
+         * @brief Gets the vectorized Base64 functions for the InstructionSet in use. They are picked once and cached afterwards.
+         * @returns Picked functions.
+        */
+        inline const Base64Kernels& GetBase64Kernels() noexcept
+        {
+            static const Base64Kernels kernels(MakeBase64Kernels(GetInstructionSet()));
+
+            return kernels;
+        }
+
+        /**
+         * @brief Encodes bytes into Base64/Base64Url. The output must have room for Base64EncodedSize characters.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] kernels_ Vectorized functions to be used.
+         * @returns Amount of characters written.
+        */
+        constexpr std::size_t EncodeBase64(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool url_, const bool withPadding_,
+                                           const Base64Kernels& kernels_ = GetBase64Kernels()) noexcept
+        {
+            const char* alphabet(url_ ? base64UrlAlphabet.data() : base64Alphabet.data());
+            std::size_t i((kernels_.encodeBlocks != nullptr) ? kernels_.encodeBlocks(input_, inputSize_, output_, url_) : 0);
+            std::size_t written((i / 3) * 4);
+
+            for(; i + 3 <= inputSize_; i += 3, written += 4) {
+                const std::uint32_t group((static_cast<std::uint32_t>(input_[i]) << 16) | (static_cast<std::uint32_t>(input_[i + 1]) << 8) | input_[i + 2]);
+
+                output_[written] = alphabet[group >> 18];
+                output_[written + 1] = alphabet[(group >> 12) & 0x3F];
+                output_[written + 2] = alphabet[(group >> 6) & 0x3F];
+                output_[written + 3] = alphabet[group & 0x3F];
+            }
+
+            if(inputSize_ - i == 1) {
+                output_[written++] = alphabet[input_[i] >> 2];
+                output_[written++] = alphabet[(input_[i] & 0x03) << 4];
+
+                if(withPadding_) {
+                    output_[written++] = '=';
+                    output_[written++] = '=';
+                }
+            } else if(inputSize_ - i == 2) {
+                output_[written++] = alphabet[input_[i] >> 2];
+                output_[written++] = alphabet[((input_[i] & 0x03) << 4) | (input_[i + 1] >> 4)];
+                output_[written++] = alphabet[(input_[i + 1] & 0x0F) << 2];
+
+                if(withPadding_) {
+                    output_[written++] = '=';
+                }
+            }
+
+            return written;
+        }
+
+        /**
+         * Decodes Base64/Base64Url characters into bytes. The input is processed in groups of 4 characters, a group can only be padded with '=' at its end
+         * and decoding stops after the first padded or incomplete group. The output must have room for Base64MaximumDecodedSize bytes.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @param[in] kernels_ Vectorized functions to be used.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeBase64(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool url_,
+                                            const Base64Kernels& kernels_ = GetBase64Kernels()) noexcept
+        {
+            const std::array<unsigned char, 256>& table(url_ ? base64UrlDecodeTable : base64DecodeTable);
+            std::size_t i((kernels_.decodeBlocks != nullptr) ? kernels_.decodeBlocks(input_, inputSize_, output_, url_) : 0);
+            std::size_t written((i / 4) * 3);
+
+            while(i < inputSize_) {
+                if(i + 4 <= inputSize_) {
+                    const unsigned char a(table[static_cast<unsigned char>(input_[i])]);
+                    const unsigned char b(table[static_cast<unsigned char>(input_[i + 1])]);
+                    const unsigned char c(table[static_cast<unsigned char>(input_[i + 2])]);
+                    const unsigned char d(table[static_cast<unsigned char>(input_[i + 3])]);
+
+                    if((a | b | c | d) < 64) {
+                        const std::uint32_t group((static_cast<std::uint32_t>(a) << 18) | (static_cast<std::uint32_t>(b) << 12)
+                                                  | (static_cast<std::uint32_t>(c) << 6) | d);
+
+                        output_[written] = static_cast<unsigned char>(group >> 16);
+                        output_[written + 1] = static_cast<unsigned char>(group >> 8);
+                        output_[written + 2] = static_cast<unsigned char>(group);
+                        written += 3;
+                        i += 4;
+
+                        continue;
+                    }
+                }
+
+                const std::size_t groupSize(std::min<std::size_t>(4, inputSize_ - i));
+                std::uint32_t group(0);
+                std::size_t paddingCounter(0);
+
+                for(std::size_t j(0); j < 4; ++j) {
+                    group <<= 6;
+
+                    if(j < groupSize) {
+                        const char character(input_[i + j]);
+                        const unsigned char value(table[static_cast<unsigned char>(character)]);
+
+                        if(character == '=') {
+                            paddingCounter += 1;
+                        } else if(paddingCounter > 0 or value == invalidSymbol) {
+                            return DecodeResult{written, false};
+                        } else {
+                            group |= value;
+                        }
+                    }
+                }
+
+                // Missing characters at the end count as padding
+                paddingCounter += 4 - groupSize;
+
+                if(groupSize < 2 or paddingCounter > 2) {
+                    return DecodeResult{written, false};
+                }
+
+                for(std::size_t j(0); j < 3 - paddingCounter; ++j) {
+                    output_[written++] = static_cast<unsigned char>(group >> (16 - (8 * j)));
+                }
+
+                if(paddingCounter > 0) {
+                    break;
+                }
+
+                i += 4;
+            }
+
+            return DecodeResult{written, true};
+        }
+
+        /**
+         * @brief Encodes bytes into Base64/Base64Url on several threads. The output must have room for Base64EncodedSize characters.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of characters written.
+        */
+        inline std::size_t EncodeBase64InParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool url_,
+                                                  const bool withPadding_, const std::size_t threadCount_) noexcept
+        {
+            const Base64Kernels& kernels(GetBase64Kernels());
+
+            return EncodeGroupsInParallel<3, 4>(input_, inputSize_, output_, threadCount_,
+                                                [&](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                                                    return EncodeBase64(bytes_, size_, characters_, url_, withPadding_, kernels);
+                                                });
+        }
+
+        /**
+         * @brief Decodes Base64/Base64Url characters into bytes on several threads. The output must have room for Base64MaximumDecodedSize bytes.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeBase64InParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool url_,
+                                                   const std::size_t threadCount_) noexcept
+        {
+            const Base64Kernels& kernels(GetBase64Kernels());
+
+            return DecodeGroupsInParallel<4, 3>(input_, inputSize_, output_, threadCount_,
+                                                [&](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                                                    return DecodeBase64(characters_, size_, bytes_, url_, kernels);
+                                                });
+        }
+
+        /**
+         * Encodes bytes into Base64/Base64Url split into lines. The groups that fit into the current line are encoded by the vectorized kernels right where
+         * they end up, only a group that straddles two lines goes through a small buffer. The output must have room for WrappedSize(Base64EncodedSize)
+         * characters.
+         *
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @returns Amount of characters written.
+        */
+        inline std::size_t EncodeBase64Lines(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool url_, const bool withPadding_,
+                                             const LineWrapping& lineWrapping_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, inputSize_);
+            const Base64Kernels& kernels(GetBase64Kernels());
+
+            if(lineWrapping_.lineLength == 0) {
+                return timer.CountOutput(EncodeBase64(input_, inputSize_, output_, url_, withPadding_, kernels));
+            }
+
+            LineWriter writer(output_, lineWrapping_);
+            std::array<char, 4> group{};
+            const std::size_t wholeSize(inputSize_ - (inputSize_ % 3));
+            std::size_t i(0);
+
+            while(i < wholeSize) {
+                const std::size_t groupCount(std::min(writer.StartLine() / 4, (wholeSize - i) / 3));
+
+                if(groupCount > 0) {
+                    writer.Advance(EncodeBase64(input_ + i, groupCount * 3, writer.GetPosition(), url_, false, kernels));
+                    i += groupCount * 3;
+                } else {
+                    writer.Write(group.data(), EncodeBase64(input_ + i, 3, group.data(), url_, false, kernels));
+                    i += 3;
+                }
+            }
+
+            if(i < inputSize_) {
+                writer.Write(group.data(), EncodeBase64(input_ + i, inputSize_ - i, group.data(), url_, withPadding_, kernels));
+            }
+
+            return timer.CountOutput(writer.GetSize());
+        }
+
+        /**
+         * Decodes Base64/Base64Url characters into bytes, skipping whitespace anywhere. The runs between whitespace are decoded where they are, only a group
+         * that is split by whitespace is put together in a small buffer first. The output must have room for Base64MaximumDecodedSize bytes.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] url_ Whether or not the Base64Url alphabet is used.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeBase64IgnoringWhitespace(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool url_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            const Base64Kernels& kernels(GetBase64Kernels());
+            std::array<char, 4> group{};
+            std::size_t groupSize(0);
+            DecodeResult result{0, true};
+
+            // Decoding goes on as long as every group is valid and none of them is padded
+            const auto decodeGroups([&](const char* characters_, const std::size_t size_) noexcept {
+                const DecodeResult groupsResult(DecodeBase64(characters_, size_, output_ + result.size, url_, kernels));
+
+                result.size += groupsResult.size;
+                result.isValid = groupsResult.isValid;
+
+                return groupsResult.isValid and groupsResult.size == (size_ / 4) * 3;
+            });
+
+            ForEachRun(input_, inputSize_, [&](const char* run_, const std::size_t runSize_) noexcept {
+                std::size_t i(0);
+
+                if(groupSize > 0) {
+                    i = std::min(4 - groupSize, runSize_);
+                    std::copy_n(run_, i, group.data() + groupSize);
+                    groupSize += i;
+
+                    if(groupSize < 4) {
+                        return true;
+                    }
+
+                    groupSize = 0;
+
+                    if(not decodeGroups(group.data(), 4)) {
+                        return false;
+                    }
+                }
+
+                const std::size_t wholeSize((runSize_ - i) - ((runSize_ - i) % 4));
+
+                if(wholeSize > 0 and not decodeGroups(run_ + i, wholeSize)) {
+                    return false;
+                }
+
+                groupSize = runSize_ - i - wholeSize;
+                std::copy_n(run_ + i + wholeSize, groupSize, group.data());
+
+                return true;
+            });
+
+            if(result.isValid and groupSize > 0) {
+                const DecodeResult groupResult(DecodeBase64(group.data(), groupSize, output_ + result.size, url_, kernels));
+
+                result = DecodeResult{result.size + groupResult.size, groupResult.isValid};
+            }
+
+            return timer.CountOutput(result);
+        }
+
+        /**
+         * The functions of the Base64 and Base64Url namespaces, which only differ in their alphabet and decode table. The namespaces forward to
+         * them and document them.
+         *
+         * @tparam isUrl_ Whether the alphabet is the Base64url alphabet of RFC 4648 §5 instead of the Base64 alphabet of RFC 4648 §4.
+        */
+        template<bool isUrl_>
+        struct Base64AlphabetFunctions
+        {
+            /// @brief Base64::Error and Base64Url::Error.
+            class Error : public std::exception
+            {
+            public:
+                /// @brief The type of Error.
+                enum class Type
+                {
+                    INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
+                    STRING_PARSE_ERROR,            ///< Failed to parse string.
+                    OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
+                };
+
+                /**
+                 * @brief Creates an Error of given Type.
+                 * @param[in] type_ Type of Error.
+                 * @param[in] sourceLocation_ Source location of Error.
+                */
+                explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
+                    _type(type_),
+                    _sourceLocation(sourceLocation_)
+                {
+                    switch(_type) {
+                        case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
+                        case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                        case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
+                        default: _what = "Invalid error type"; break;
+                    }
+                }
+
+                /**
+                 * @brief Gets the Type of the Error.
+                 * @returns Type of Error.
+                */
+                Type GetType() const noexcept { return _type; }
+                /**
+                 * @brief Gets the location at which the Error was thrown.
+                 * @returns Source location of Error.
+                */
+                std::source_location GetSourceLocation() const { return _sourceLocation; }
+                /**
+                 * @brief Gets reason for the Error.
+                 * @returns Reason for the Error.
+                */
+                std::string What() const { return _what; }
+
+                // For C++ compatibility purposes
+
+                const char* what() const noexcept override { return _what.c_str(); }
+
+            private:
+                Type _type;
+                std::source_location _sourceLocation;
+                std::string _what;
+            };
+
+            static_assert(charSize == 8, "These Base64 and Base64Url functions only work if a char is 8 bits big");
+
+            static const std::error_category& GetErrorCategory() noexcept
+            {
+                static const ErrorCategory<Error> errorCategory(isUrl_ ? "BinaryText::Base64Url" : "BinaryText::Base64");
+
+                return errorCategory;
+            }
+
+            static std::error_code MakeErrorCode(const Error::Type type_) noexcept { return std::error_code(static_cast<int>(type_) + 1, GetErrorCategory()); }
+
+            static constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+            {
+                return Base64EncodedSize(size_, withPadding_);
+            }
+
+            static constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Base64MaximumDecodedSize(size_); }
+
+            static constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+            {
+                return AlphabetEncodedSize<64>(CheckFileSize(size_, 3, 4), withPadding_);
+            }
+
+            static constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept { return Base64MaximumDecodedSize<std::uint64_t>(size_); }
+
+            static constexpr std::size_t WrappedEncodedSize(const std::size_t size_, const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+            {
+                return WrappedSize(Base64EncodedSize(size_, withPadding_), lineWrapping_);
+            }
+
+            template<ConstantString string_, bool withPadding_ = true>
+            static consteval auto EncodeArray() noexcept
+            {
+                constexpr auto encode([](const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                    return EncodeBase64(input_, inputSize_, output_, isUrl_, withPadding_, Base64Kernels{});
+                });
+                constexpr auto encoded(EncodeConstant<EncodedSize(string_.characters.size(), withPadding_)>(string_, encode));
+
+                return encoded.values;
+            }
+
+            template<ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+            static consteval auto DecodeArray() noexcept
+            {
+                constexpr auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64(input_, inputSize_, output_, isUrl_, Base64Kernels{});
+                });
+                constexpr auto decoded(DecodeConstant<MaximumDecodedSize(encodedString_.characters.size())>(encodedString_, decode));
+
+                static_assert(decoded.isValid, "The string literal is not valid Base64 or Base64Url");
+
+                return MakeConstantArray<ByteType, decoded.size>(decoded);
+            }
+
+            static std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+            {
+                std::string encodedString;
+
+                if(string_.size() > (encodedString.max_size() / 4) * 3) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(Base64EncodedSize(string_.size(), withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase64InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(), isUrl_, withPadding_,
+                                       threadCount_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true,
+                                                        const std::size_t threadCount_ = 1)
+            {
+                std::string encodedString;
+
+                if(byteBuffer_.IsEmpty()) {
+                    return encodedString;
+                } else if(byteBuffer_.GetSize() > (encodedString.max_size() / 4) * 3) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(Base64EncodedSize(byteBuffer_.GetSize(), withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase64InParallel(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(), encodedString.data(),
+                                       isUrl_, withPadding_, threadCount_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true,
+                                                        const std::size_t threadCount_ = 1)
+            {
+                return EncodeStringToString(ViewAsCharacters(byteBufferView_), withPadding_, threadCount_);
+            }
+
+            static void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                if(string_.size() > (encodedString_.max_size() / 4) * 3) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                const auto encode([string_, withPadding_, threadCount_](char* output_) noexcept {
+                    return EncodeBase64InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), output_, isUrl_, withPadding_,
+                                                  threadCount_);
+                });
+
+                EncodeIntoString<Error>(encodedString_, EncodedSize(string_.size(), withPadding_), encode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                EncodeInto(ViewAsCharacters(byteBuffer_), encodedString_, withPadding_, threadCount_);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                                   const std::size_t threadCount_ = 1)
+            {
+                EncodeInto(ViewAsCharacters(byteBufferView_), encodedString_, withPadding_, threadCount_);
+            }
+
+            static std::string EncodeStringToString(const std::string_view string_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+            {
+                std::string encodedString;
+
+                if(string_.size() > (encodedString.max_size() / 4) * 3
+                   or Base64EncodedSize(string_.size(), withPadding_) > encodedString.max_size() / (lineWrapping_.separator.size() + 1)) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(WrappedEncodedSize(string_.size(), lineWrapping_, withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase64Lines(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(), isUrl_, withPadding_,
+                                  lineWrapping_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const LineWrapping& lineWrapping_,
+                                                        const bool withPadding_ = true)
+            {
+                std::string encodedString;
+
+                if(byteBuffer_.IsEmpty()) {
+                    return encodedString;
+                } else if(byteBuffer_.GetSize() > (encodedString.max_size() / 4) * 3
+                          or Base64EncodedSize(byteBuffer_.GetSize(), withPadding_) > encodedString.max_size() / (lineWrapping_.separator.size() + 1)) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                try {
+                    encodedString.resize(WrappedEncodedSize(byteBuffer_.GetSize(), lineWrapping_, withPadding_));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                EncodeBase64Lines(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(), encodedString.data(), isUrl_,
+                                  withPadding_, lineWrapping_);
+
+                return encodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const LineWrapping& lineWrapping_,
+                                                        const bool withPadding_ = true)
+            {
+                return EncodeStringToString(ViewAsCharacters(byteBufferView_), lineWrapping_, withPadding_);
+            }
+
+            static std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+            {
+                std::string decodedString;
+
+                try {
+                    decodedString.resize(Base64MaximumDecodedSize(encodedString_.size()));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                const DecodeResult result(
+                    DecodeBase64InParallel(encodedString_.data(), encodedString_.size(), reinterpret_cast<unsigned char*>(decodedString.data()), isUrl_,
+                                           threadCount_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedString.resize(result.size);
+
+                return decodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr)
+            {
+                ByteBuffer<ByteType> decodedByteBuffer(Base64MaximumDecodedSize(encodedString_.size()), uninitialized, memoryResource_);
+                const DecodeResult result(DecodeBase64InParallel(encodedString_.data(), encodedString_.size(),
+                                                                 reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), isUrl_, threadCount_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedByteBuffer.Resize(result.size);
+
+                return decodedByteBuffer;
+            }
+
+            static Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64InParallel(input_, inputSize_, output_, isUrl_, threadCount_);
+                });
+
+                return TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_.size()), MakeErrorCode, decode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                            std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64InParallel(input_, inputSize_, output_, isUrl_, threadCount_);
+                });
+
+                return TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_.size()), memoryResource_,
+                                                              MakeErrorCode, decode);
+            }
+
+            static void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64InParallel(input_, inputSize_, output_, isUrl_, threadCount_);
+                });
+
+                DecodeIntoString<Error>(encodedString_, decodedString_, MaximumDecodedSize(encodedString_.size()), decode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+            {
+                const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64InParallel(input_, inputSize_, output_, isUrl_, threadCount_);
+                });
+
+                DecodeIntoByteBuffer<Error>(encodedString_, decodedByteBuffer_, MaximumDecodedSize(encodedString_.size()), decode);
+            }
+
+            static std::string DecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace)
+            {
+                std::string decodedString;
+
+                try {
+                    decodedString.resize(Base64MaximumDecodedSize(encodedString_.size()));
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                const DecodeResult result(DecodeBase64IgnoringWhitespace(encodedString_.data(), encodedString_.size(),
+                                                                         reinterpret_cast<unsigned char*>(decodedString.data()), isUrl_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedString.resize(result.size);
+
+                return decodedString;
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr)
+            {
+                ByteBuffer<ByteType> decodedByteBuffer(Base64MaximumDecodedSize(encodedString_.size()), uninitialized, memoryResource_);
+                const DecodeResult result(DecodeBase64IgnoringWhitespace(encodedString_.data(), encodedString_.size(),
+                                                                         reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), isUrl_));
+
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+
+                decodedByteBuffer.Resize(result.size);
+
+                return decodedByteBuffer;
+            }
+
+            static Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace) noexcept
+            {
+                const auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64IgnoringWhitespace(input_, inputSize_, output_, isUrl_);
+                });
+
+                return TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_.size()), MakeErrorCode, decode);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                                            std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+            {
+                const auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64IgnoringWhitespace(input_, inputSize_, output_, isUrl_);
+                });
+
+                return TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_.size()), memoryResource_,
+                                                              MakeErrorCode, decode);
+            }
+
+            template<typename ByteType, typename EncodedByteType>
+                requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+            static ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                                     std::pmr::memory_resource* memoryResource_ = nullptr)
+            {
+                return DecodeStringToByteBuffer<ByteType>(ViewAsCharacters(encodedByteBuffer_), threadCount_, memoryResource_);
+            }
+
+            template<typename ByteType>
+                requires ByteBufferCompatible<ByteType>
+            static void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+            {
+                const auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                    return DecodeBase64(input_, inputSize_, output_, isUrl_);
+                });
+
+                if(not DecodeInPlace(byteBuffer_, decode)) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
+            }
+
+            static ValidationResult Validate(const std::string_view input_) noexcept
+            {
+                const auto decode([](const char* characters_, const std::size_t size_, unsigned char* output_) noexcept {
+                    return DecodeBase64(characters_, size_, output_, isUrl_);
+                });
+
+                return ValidateGroups<4, 3>(input_, decode);
+            }
+
+            static std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                      const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+            {
+                if(output_.size() < EncodedSize(input_.size(), withPadding_)) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return EncodeBase64InParallel(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), isUrl_, withPadding_,
+                                              threadCount_);
+            }
+
+            static std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                      const std::size_t threadCount_ = 1) noexcept
+            {
+                if(output_.size() < MaximumDecodedSize(input_.size())) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                const DecodeResult result(
+                    DecodeBase64InParallel(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), isUrl_, threadCount_));
+
+                if(not result.isValid) {
+                    errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return result.size;
+            }
+
+            static std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                      const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+            {
+                if(output_.size() < WrappedEncodedSize(input_.size(), lineWrapping_, withPadding_)) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return EncodeBase64Lines(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), isUrl_, withPadding_,
+                                         lineWrapping_);
+            }
+
+            static std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_, IgnoreWhitespace) noexcept
+            {
+                if(output_.size() < MaximumDecodedSize(input_.size())) {
+                    errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                    return 0;
+                }
+
+                const DecodeResult result(
+                    DecodeBase64IgnoringWhitespace(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), isUrl_));
+
+                if(not result.isValid) {
+                    errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
+
+                    return 0;
+                }
+
+                errorCode_.clear();
+
+                return result.size;
+            }
+
+            /// @brief Base64::Encoder and Base64Url::Encoder.
+            class Encoder
+            {
+            public:
+                /**
+                 * @brief Creates an Encoder.
+                 * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+                */
+                explicit Encoder(const bool withPadding_ = true) noexcept :
+                    _state(),
+                    _withPadding(withPadding_)
+                {}
+
+                /**
+                 * @brief Calculates the maximum amount of characters Update writes.
+                 * @param[in] inputSize_ Amount of bytes passed to Update.
+                 * @returns Maximum amount of characters written.
+                */
+                static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return ((inputSize_ + 2) / 3) * 4; }
+                /**
+                 * @brief Calculates the maximum amount of characters Finish writes.
+                 * @returns Maximum amount of characters written.
+                */
+                static constexpr std::size_t GetMaximumFinishSize() noexcept { return 4; }
+
+                /**
+                 * @brief Encodes the next piece of the input. Bytes that do not fill a whole group of 3 are kept until the next call.
+                 * @param[in] input_ Bytes to be encoded.
+                 * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumUpdateSize(input_.size()) characters.
+                 * @returns Amount of characters written.
+                 * @throws Error
+                */
+                std::size_t Update(const std::span<const std::byte> input_, const std::span<char> output_)
+                {
+                    if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                        return EncodeBase64(bytes_, size_, characters_, isUrl_, _withPadding);
+                    });
+
+                    return UpdateGroupEncoder(_state, reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), encode);
+                }
+                /**
+                 * @brief Encodes the kept bytes and adds the padding. The Encoder can be used for a new input afterwards.
+                 * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumFinishSize() characters.
+                 * @returns Amount of characters written.
+                 * @throws Error
+                */
+                std::size_t Finish(const std::span<char> output_)
+                {
+                    if(output_.size() < GetMaximumFinishSize()) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                        return EncodeBase64(bytes_, size_, characters_, isUrl_, _withPadding);
+                    });
+
+                    return FinishGroupEncoder(_state, output_.data(), encode);
+                }
+                /// @brief Discards the kept bytes.
+                void Reset() noexcept { _state = GroupEncodeState<3>(); }
+
+            private:
+                GroupEncodeState<3> _state;
+                bool _withPadding;
+            };
+
+            template<typename ByteType>
+                requires ByteBufferStringCompatible<ByteType>
+            static std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+            {
+                Encoder encoder(withPadding_);
+
+                return EncodeByteBufferViews<Error>(encoder, byteBufferViews_);
+            }
+
+            /// @brief Base64::Decoder and Base64Url::Decoder.
+            class Decoder
+            {
+            public:
+                /// @brief Creates a Decoder.
+                Decoder() noexcept :
+                    _state()
+                {}
+
+                /**
+                 * @brief Calculates the maximum amount of bytes Update writes.
+                 * @param[in] inputSize_ Amount of characters passed to Update.
+                 * @returns Maximum amount of bytes written.
+                */
+                static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return ((inputSize_ + 3) / 4) * 3; }
+                /**
+                 * @brief Calculates the maximum amount of bytes Finish writes.
+                 * @returns Maximum amount of bytes written.
+                */
+                static constexpr std::size_t GetMaximumFinishSize() noexcept { return 2; }
+
+                /**
+                 * Decodes the next piece of the input. Characters that do not fill a whole group of 4 are kept until the next call. After an Error the Decoder
+                 * has to be Reset before it can be used again.
+                 *
+                 * @param[in] input_ Characters to be decoded.
+                 * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumUpdateSize(input_.size()) bytes.
+                 * @returns Amount of bytes written.
+                 * @throws Error
+                */
+                std::size_t Update(const std::string_view input_, const std::span<std::byte> output_)
+                {
+                    if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto decode([](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                        return DecodeBase64(characters_, size_, bytes_, isUrl_);
+                    });
+                    const DecodeResult result(UpdateGroupDecoder(_state, input_.data(), input_.size(),
+                                                                 reinterpret_cast<unsigned char*>(output_.data()), decode));
+
+                    if(not result.isValid) {
+                        throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    return result.size;
+                }
+                /**
+                 * @brief Decodes the kept characters as the last, incomplete group. The Decoder can be used for a new input afterwards.
+                 * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumFinishSize() bytes.
+                 * @returns Amount of bytes written.
+                 * @throws Error
+                */
+                std::size_t Finish(const std::span<std::byte> output_)
+                {
+                    if(output_.size() < GetMaximumFinishSize()) {
+                        throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                    }
+
+                    const auto decode([](const char* characters_, const std::size_t size_, unsigned char* bytes_) noexcept {
+                        return DecodeBase64(characters_, size_, bytes_, isUrl_);
+                    });
+                    const DecodeResult result(FinishGroupDecoder(_state, reinterpret_cast<unsigned char*>(output_.data()), decode));
+
+                    if(not result.isValid) {
+                        throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    return result.size;
+                }
+                /// @brief Discards the kept characters.
+                void Reset() noexcept { _state = GroupDecodeState<4, 3>(); }
+
+            private:
+                GroupDecodeState<4, 3> _state;
+            };
+        };
+
+        /// @brief The functions of the Base64 namespace.
+        using Base64Functions = Base64AlphabetFunctions<false>;
+        /// @brief The functions of the Base64Url namespace.
+        using Base64UrlFunctions = Base64AlphabetFunctions<true>;
+    }
+
+    /// @brief A namespace that has functions that implement Base64 encoding and decoding in accordance to RFC 4648 §4.
+    namespace Base64
+    {
+        /// @brief A simple error class for the Base64 namespace.
+        using Error = Internal::Base64Functions::Error;
+
+        /**
+         * @brief Gets the category of the error codes set by the non-throwing functions.
+         * @returns Error category of the Base64 namespace.
+        */
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            return Internal::Base64Functions::GetErrorCategory();
+        }
+        /**
+         * @brief Creates an error code of given Type.
+         * @param[in] type_ Type of Error.
+         * @returns Error code in the category returned by GetErrorCategory.
+        */
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return Internal::Base64Functions::MakeErrorCode(type_); }
+        /**
+         * @brief Calculates the size of a Base64 encoded string.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64Functions::EncodedSize(size_, withPadding_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base64 encoded string can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Internal::Base64Functions::MaximumDecodedSize(size_); }
+        /**
+         * @brief Calculates the size of a Base64 encoded file, which can be larger than memory and than std::size_t (see BinaryText::Files).
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded file will have.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+        {
+            return Internal::Base64Functions::EncodedFileSize(size_, withPadding_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes a Base64 encoded file can be decoded into.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept { return Internal::Base64Functions::MaximumDecodedFileSize(size_); }
+        /**
+         * @brief Calculates the size of a Base64 encoded string that is split into lines.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded string will have, including the separators.
+        */
+        constexpr std::size_t WrappedEncodedSize(const std::size_t size_, const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64Functions::WrappedEncodedSize(size_, lineWrapping_, withPadding_);
+        }
+
+        /**
+         * Encodes a string literal into Base64 at compile time, for constants that should not cost anything at run time. The std::array has exactly
+         * EncodedSize characters and no terminating null character.
+         *
+         * @tparam string_ String literal to be encoded.
+         * @tparam withPadding_ Whether or not padding (the '=' character) should be included.
+         * @returns Encoded characters.
+        */
+        template<Internal::ConstantString string_, bool withPadding_ = true>
+        consteval std::array<char, EncodedSize(string_.characters.size(), withPadding_)> EncodeArray() noexcept
+        {
+            return Internal::Base64Functions::EncodeArray<string_, withPadding_>();
+        }
+        /**
+         * @brief Decodes a Base64 string literal at compile time, a string literal that is not valid Base64 does not compile.
+         * @tparam encodedString_ String literal to be decoded.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @returns Decoded bytes, in a std::array of exactly their amount.
+        */
+        template<Internal::ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            return Internal::Base64Functions::DecodeArray<encodedString_, ByteType>();
+        }
+
+        /**
+         * @brief Encodes a not-encoded string into a Base64 encoded string.
+         * @param[in] string_ String to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64Functions::EncodeStringToString(string_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base64 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64Functions::EncodeByteBufferToString<ByteType>(byteBuffer_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base64 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64Functions::EncodeByteBufferToString<ByteType>(byteBufferView_, withPadding_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into a Base64 encoded string of the caller, like EncodeStringToString but reusing the capacity of the string, so
+         * that encoding many inputs into the same string does not allocate once it is big enough.
+         *
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64Functions::EncodeInto(string_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base64 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64Functions::EncodeInto<ByteType>(byteBuffer_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base64 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64Functions::EncodeInto<ByteType>(byteBufferView_, encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a not-encoded string into a Base64 encoded string that is split into lines, such as a MIME or PEM body.
+         * @param[in] string_ String to be encoded.
+         * @param[in] lineWrapping_ Line length and separator, for example mimeLineWrapping or pemLineWrapping.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @throws BinaryText::Base64::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64Functions::EncodeStringToString(string_, lineWrapping_, withPadding_);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Base64 encoded string that is split into lines, such as a MIME or PEM body.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] lineWrapping_ Line length and separator, for example mimeLineWrapping or pemLineWrapping.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64Functions::EncodeByteBufferToString<ByteType>(byteBuffer_, lineWrapping_, withPadding_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Base64 encoded string that is split into lines, such as a MIME or PEM body.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] lineWrapping_ Line length and separator, for example mimeLineWrapping or pemLineWrapping.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64Functions::EncodeByteBufferToString<ByteType>(byteBufferView_, lineWrapping_, withPadding_);
+        }
+        /**
+         * @brief Decodes a Base64 encoded string into a decoded string. Whitespace and newline characters are not ignored.
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64Functions::DecodeStringToString(encodedString_, threadCount_);
+        }
+        /**
+         * @brief Decodes a Base64 encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64Functions::DecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing.
+         * Whitespace and newline characters are not ignored.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64Functions::TryDecodeStringToString(encodedString_, threadCount_);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing. A
+         * ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace and newline characters are not ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base64Functions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded string of the caller, like DecodeStringToString but reusing the capacity of the string, so
+         * that decoding many inputs into the same string does not allocate once it is big enough. If an Error is thrown the string is left empty.
+         * Whitespace and newline characters are not ignored.
+         *
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedString_.
+         * @param[out] decodedString_ String the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+        */
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64Functions::DecodeInto(encodedString_, decodedString_, threadCount_);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded ByteBuffer of the caller, like DecodeStringToByteBuffer but reusing the capacity of the
+         * ByteBuffer and without initializing its bytes first. If an Error is thrown the ByteBuffer is left empty. Whitespace and newline characters are not
+         * ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedByteBuffer_.
+         * @param[out] decodedByteBuffer_ ByteBuffer the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64Functions::DecodeInto<ByteType>(encodedString_, decodedByteBuffer_, threadCount_);
+        }
+        /**
+         * @brief Decodes a Base64 encoded string into a decoded string, skipping whitespace anywhere, such as the line breaks of a MIME or PEM body.
+         * @param[in] encodedString_ String to be decoded.
+         * @throws BinaryText::Base64::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace)
+        {
+            return Internal::Base64Functions::DecodeStringToString(encodedString_, ignoreWhitespace);
+        }
+        /**
+         * @brief Decodes a Base64 encoded string into a decoded ByteBuffer, skipping whitespace anywhere, such as the line breaks of a MIME or PEM body.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64Functions::DecodeStringToByteBuffer<ByteType>(encodedString_, ignoreWhitespace, memoryResource_);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing.
+         * Whitespace is skipped anywhere, such as the line breaks of a MIME or PEM body.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace) noexcept
+        {
+            return Internal::Base64Functions::TryDecodeStringToString(encodedString_, ignoreWhitespace);
+        }
+        /**
+         * Decodes a Base64 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing. A
+         * ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace is skipped anywhere, such as the line
+         * breaks of a MIME or PEM body.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base64Functions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, ignoreWhitespace, memoryResource_);
+        }
+
+        /**
+         * @brief Decodes Base64 encoded characters held by a ByteBuffer into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @tparam EncodedByteType Type of the encoded ByteBuffer that satisfies the ByteBufferCompatible concept.
+         * @param[in] encodedByteBuffer_ ByteBuffer to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Base64::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64Functions::DecodeByteBufferToByteBuffer<ByteType, EncodedByteType>(encodedByteBuffer_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes Base64 encoded characters held by a ByteBuffer into the ByteBuffer itself, the decoded bytes overwrite the characters and the ByteBuffer is
+         * shrunk to fit them, so no second buffer is needed. Whitespace and newline characters are not ignored. If an Error is thrown the ByteBuffer is
+         * cleared.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+        {
+            Internal::Base64Functions::DecodeByteBufferInPlace<ByteType>(byteBuffer_);
+        }
+
+        /**
+         * Checks whether Base64 encoded characters can be decoded, by the same rules as the decoding functions but without keeping the decoded bytes.
+         * Nothing is allocated and nothing is thrown. Whitespace and newline characters are not ignored.
+         *
+         * @param[in] input_ Characters to be checked.
+         * @returns Whether or not the input is valid, the exact decoded size and the offset of the first group that cannot be decoded.
+        */
+        inline ValidationResult Validate(const std::string_view input_) noexcept
+        {
+            return Internal::Base64Functions::Validate(input_);
+        }
+
+        /**
+         * @brief Encodes bytes into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for EncodedSize(input_.size(), withPadding_) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of characters written, 0 on error.
+        */
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64Functions::Encode(input_, output_, errorCode_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Decodes Base64 characters into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_.size()) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64Functions::Decode(input_, output_, errorCode_, threadCount_);
+        }
+        /**
+         * @brief Encodes bytes into a caller-provided buffer, split into lines. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for WrappedEncodedSize(input_.size(), lineWrapping_, withPadding_)
+         * characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] lineWrapping_ Line length and separator, for example mimeLineWrapping or pemLineWrapping.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @returns Amount of characters written, 0 on error.
+        */
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64Functions::Encode(input_, output_, errorCode_, lineWrapping_, withPadding_);
+        }
+        /**
+         * @brief Decodes Base64 characters into a caller-provided buffer, skipping whitespace anywhere. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_.size()) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_, IgnoreWhitespace) noexcept
+        {
+            return Internal::Base64Functions::Decode(input_, output_, errorCode_, ignoreWhitespace);
+        }
+
+        /// @brief Encodes Base64 piece by piece. Splitting the input at any point gives the same result as encoding it at once.
+        using Encoder = Internal::Base64Functions::Encoder;
+
+        /**
+         * Encodes several ByteBufferViews one after another into a Base64 encoded string, as if they were one ByteBuffer. A message made of several
+         * parts, such as a header and a Subview of a big payload, is encoded this way without concatenating the parts first.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferViews_ ByteBufferViews to be encoded, in order.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @throws BinaryText::Base64::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+        {
+            return Internal::Base64Functions::EncodeByteBufferViewsToString<ByteType>(byteBufferViews_, withPadding_);
+        }
+
+        /**
+         * Decodes Base64 piece by piece. Splitting the input at any point gives the same result as decoding it at once, everything after the first padded
+         * group is ignored.
+        */
+        using Decoder = Internal::Base64Functions::Decoder;
+    };
+
+    /// @brief A namespace that has functions that implement Base64Url encoding and decoding in accordance to RFC 4648 §5.
+    namespace Base64Url
+    {
+        /// @brief Base64::Error of the Base64Url namespace.
+        using Error = Internal::Base64UrlFunctions::Error;
+
+        /// @brief Base64::GetErrorCategory with the Base64Url alphabet.
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            return Internal::Base64UrlFunctions::GetErrorCategory();
+        }
+        /// @brief Base64::MakeErrorCode with the Base64Url alphabet.
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return Internal::Base64UrlFunctions::MakeErrorCode(type_); }
+        /// @brief Base64::EncodedSize with the Base64Url alphabet.
+        constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64UrlFunctions::EncodedSize(size_, withPadding_);
+        }
+        /// @brief Base64::MaximumDecodedSize with the Base64Url alphabet.
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return Internal::Base64UrlFunctions::MaximumDecodedSize(size_); }
+        /// @brief Base64::EncodedFileSize with the Base64Url alphabet.
+        constexpr std::uint64_t EncodedFileSize(const std::uint64_t size_, const bool withPadding_ = true)
+        {
+            return Internal::Base64UrlFunctions::EncodedFileSize(size_, withPadding_);
+        }
+        /// @brief Base64::MaximumDecodedFileSize with the Base64Url alphabet.
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) noexcept
+        {
+            return Internal::Base64UrlFunctions::MaximumDecodedFileSize(size_);
+        }
+        /// @brief Base64::WrappedEncodedSize with the Base64Url alphabet.
+        constexpr std::size_t WrappedEncodedSize(const std::size_t size_, const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64UrlFunctions::WrappedEncodedSize(size_, lineWrapping_, withPadding_);
+        }
+
+        /// @brief Base64::EncodeArray with the Base64Url alphabet.
+        template<Internal::ConstantString string_, bool withPadding_ = true>
+        consteval std::array<char, EncodedSize(string_.characters.size(), withPadding_)> EncodeArray() noexcept
+        {
+            return Internal::Base64UrlFunctions::EncodeArray<string_, withPadding_>();
+        }
+        /// @brief Base64::DecodeArray with the Base64Url alphabet.
+        template<Internal::ConstantString encodedString_, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            return Internal::Base64UrlFunctions::DecodeArray<encodedString_, ByteType>();
+        }
+
+        /// @brief Base64::EncodeStringToString with the Base64Url alphabet.
+        inline std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64UrlFunctions::EncodeStringToString(string_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeByteBufferToString with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64UrlFunctions::EncodeByteBufferToString<ByteType>(byteBuffer_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeByteBufferToString with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64UrlFunctions::EncodeByteBufferToString<ByteType>(byteBufferView_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeInto with the Base64Url alphabet.
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64UrlFunctions::EncodeInto(string_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeInto with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64UrlFunctions::EncodeInto<ByteType>(byteBuffer_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeInto with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64UrlFunctions::EncodeInto<ByteType>(byteBufferView_, encodedString_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::EncodeStringToString with the Base64Url alphabet.
+        inline std::string EncodeStringToString(const std::string_view string_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64UrlFunctions::EncodeStringToString(string_, lineWrapping_, withPadding_);
+        }
+        /// @brief Base64::EncodeByteBufferToString with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64UrlFunctions::EncodeByteBufferToString<ByteType>(byteBuffer_, lineWrapping_, withPadding_);
+        }
+        /// @brief Base64::EncodeByteBufferToString with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const LineWrapping& lineWrapping_, const bool withPadding_ = true)
+        {
+            return Internal::Base64UrlFunctions::EncodeByteBufferToString<ByteType>(byteBufferView_, lineWrapping_, withPadding_);
+        }
+        /// @brief Base64::DecodeStringToString with the Base64Url alphabet.
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
+        {
+            return Internal::Base64UrlFunctions::DecodeStringToString(encodedString_, threadCount_);
+        }
+        /// @brief Base64::DecodeStringToByteBuffer with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64UrlFunctions::DecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /// @brief Base64::TryDecodeStringToString with the Base64Url alphabet.
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64UrlFunctions::TryDecodeStringToString(encodedString_, threadCount_);
+        }
+        /// @brief Base64::TryDecodeStringToByteBuffer with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base64UrlFunctions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, threadCount_, memoryResource_);
+        }
+        /// @brief Base64::DecodeInto with the Base64Url alphabet.
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64UrlFunctions::DecodeInto(encodedString_, decodedString_, threadCount_);
+        }
+        /// @brief Base64::DecodeInto with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+        {
+            Internal::Base64UrlFunctions::DecodeInto<ByteType>(encodedString_, decodedByteBuffer_, threadCount_);
+        }
+        /// @brief Base64::DecodeStringToString with the Base64Url alphabet.
+        inline std::string DecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace)
+        {
+            return Internal::Base64UrlFunctions::DecodeStringToString(encodedString_, ignoreWhitespace);
+        }
+        /// @brief Base64::DecodeStringToByteBuffer with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64UrlFunctions::DecodeStringToByteBuffer<ByteType>(encodedString_, ignoreWhitespace, memoryResource_);
+        }
+        /// @brief Base64::TryDecodeStringToString with the Base64Url alphabet.
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace) noexcept
+        {
+            return Internal::Base64UrlFunctions::TryDecodeStringToString(encodedString_, ignoreWhitespace);
+        }
+        /// @brief Base64::TryDecodeStringToByteBuffer with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            return Internal::Base64UrlFunctions::TryDecodeStringToByteBuffer<ByteType>(encodedString_, ignoreWhitespace, memoryResource_);
+        }
+
+        /// @brief Base64::DecodeByteBufferToByteBuffer with the Base64Url alphabet.
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return Internal::Base64UrlFunctions::DecodeByteBufferToByteBuffer<ByteType, EncodedByteType>(encodedByteBuffer_, threadCount_, memoryResource_);
+        }
+        /// @brief Base64::DecodeByteBufferInPlace with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+        {
+            Internal::Base64UrlFunctions::DecodeByteBufferInPlace<ByteType>(byteBuffer_);
+        }
+
+        /// @brief Base64::Validate with the Base64Url alphabet.
+        inline ValidationResult Validate(const std::string_view input_) noexcept
+        {
+            return Internal::Base64UrlFunctions::Validate(input_);
+        }
+
+        /// @brief Base64::Encode with the Base64Url alphabet.
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const bool withPadding_ = true, const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64UrlFunctions::Encode(input_, output_, errorCode_, withPadding_, threadCount_);
+        }
+        /// @brief Base64::Decode with the Base64Url alphabet.
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const std::size_t threadCount_ = 1) noexcept
+        {
+            return Internal::Base64UrlFunctions::Decode(input_, output_, errorCode_, threadCount_);
+        }
+        /// @brief Base64::Encode with the Base64Url alphabet.
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const LineWrapping& lineWrapping_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::Base64UrlFunctions::Encode(input_, output_, errorCode_, lineWrapping_, withPadding_);
+        }
+        /// @brief Base64::Decode with the Base64Url alphabet.
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_, IgnoreWhitespace) noexcept
+        {
+            return Internal::Base64UrlFunctions::Decode(input_, output_, errorCode_, ignoreWhitespace);
+        }
+
+        /// @brief Base64::Encoder of the Base64Url namespace.
+        using Encoder = Internal::Base64UrlFunctions::Encoder;
+
+        /// @brief Base64::EncodeByteBufferViewsToString with the Base64Url alphabet.
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool withPadding_ = true)
+        {
+            return Internal::Base64UrlFunctions::EncodeByteBufferViewsToString<ByteType>(byteBufferViews_, withPadding_);
+        }
+
+        /// @brief Base64::Decoder of the Base64Url namespace.
+        using Decoder = Internal::Base64UrlFunctions::Decoder;
+    };
+
+    namespace Internal
+    {
+        /**
+         * @brief Calculates the maximum size of an Ascii85 encoded string.
+         * @tparam SizeType std::size_t for strings, std::uint64_t for files that can be larger than memory.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] adobeMode_ Whether or not the <~ and ~> delimiters are included.
+         * @returns Maximum amount of characters the encoded string will have.
+        */
+        template<std::unsigned_integral SizeType = std::size_t>
+        constexpr SizeType Ascii85MaximumEncodedSize(const SizeType size_, const bool adobeMode_) noexcept
+        {
+            const SizeType remainder(size_ % 4);
+
+            return static_cast<SizeType>(((size_ / 4) * 5) + ((remainder == 0) ? 0 : remainder + 1) + (adobeMode_ ? 4 : 0));
+        }
+
+        /**
+         * @brief Calculates the maximum amount of bytes an Ascii85 encoded string can be decoded into. Every z and y can turn into 4 bytes.
+         * @param[in] input_ Characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t Ascii85MaximumDecodedSize(const std::string_view input_) noexcept
+        {
+            const std::size_t foldedSize(static_cast<std::size_t>(std::count_if(input_.begin(), input_.end(), [](const char character_) noexcept {
+                return character_ == 'z' or character_ == 'y';
+            })));
+
+            return (((input_.size() - foldedSize) / 5) * 4) + (foldedSize * 4) + 3;
+        }
+
+        /**
+         * Writes the 5 Ascii85 digits of a group. The group is split into a high and a low part by 85^3 first, so that the digits are calculated in two
+         * short chains of divisions by constants, which the compiler turns into multiplications by their reciprocal.
+         *
+         * @param[in] group_ Group to be encoded.
+         * @param[out] output_ Where the 5 digits are written to.
+        */
+        constexpr void EncodeAscii85Group(const std::uint32_t group_, char* output_) noexcept
+        {
+            const std::uint32_t high(group_ / 614125);
+            const std::uint32_t low(group_ % 614125);
+
+            output_[0] = static_cast<char>((high / 85) + 33);
+            output_[1] = static_cast<char>((high % 85) + 33);
+            output_[2] = static_cast<char>((low / 7225) + 33);
+            output_[3] = static_cast<char>(((low / 85) % 85) + 33);
+            output_[4] = static_cast<char>((low % 85) + 33);
+        }
+
+        /**
+         * @brief Reads a group of 4 bytes in big-endian order.
+         * @param[in] input_ Bytes to be read.
+         * @returns The group.
+        */
+        constexpr std::uint32_t LoadAscii85Group(const unsigned char* input_) noexcept
+        {
+            return (static_cast<std::uint32_t>(input_[0]) << 24) | (static_cast<std::uint32_t>(input_[1]) << 16) | (static_cast<std::uint32_t>(input_[2]) << 8)
+                   | input_[3];
+        }
+
+        /**
+         * Encodes bytes into Ascii85. An incomplete last group is filled up with zeros and only as many characters as needed are written, it is never
+         * turned into z or y. The output must have room for Ascii85MaximumEncodedSize characters.
+         *
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] foldSpaces_ Whether or not 4 spaces are turned into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded characters with <~ and ~> delimiters.
+         * @returns Amount of characters written.
+        */
+        constexpr std::size_t EncodeAscii85(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool foldSpaces_,
+                                            const bool adobeMode_ = false) noexcept
+        {
+            const std::size_t remainder(inputSize_ % 4);
+            std::size_t written(0);
+
+            if(adobeMode_) {
+                output_[0] = '<';
+                output_[1] = '~';
+                written = 2;
+            }
+
+            const auto encodeGroup([output_, foldSpaces_, &written](const std::uint32_t group_) noexcept {
+                if(group_ == 0) {
+                    output_[written++] = 'z';
+                } else if(group_ == 0x20202020 and foldSpaces_) {
+                    output_[written++] = 'y';
+                } else {
+                    EncodeAscii85Group(group_, output_ + written);
+                    written += 5;
+                }
+            });
+
+            // Two independent groups per iteration let the divisions of both overlap
+            std::size_t i(0);
+
+            for(; i + 8 <= inputSize_; i += 8) {
+                encodeGroup(LoadAscii85Group(input_ + i));
+                encodeGroup(LoadAscii85Group(input_ + i + 4));
+            }
+
+            if(i + 4 <= inputSize_) {
+                encodeGroup(LoadAscii85Group(input_ + i));
+                i += 4;
+            }
+
+            if(remainder != 0) {
+                std::array<unsigned char, 4> bytes{};
+                std::array<char, 5> digits{};
+
+                std::copy_n(input_ + i, remainder, bytes.data());
+                EncodeAscii85Group(LoadAscii85Group(bytes.data()), digits.data());
+                std::copy_n(digits.data(), remainder + 1, output_ + written);
+                written += remainder + 1;
+            }
+
+            if(adobeMode_) {
+                output_[written] = '~';
+                output_[written + 1] = '>';
+                written += 2;
+            }
+
+            return written;
+        }
+
+        /// @brief State of an Ascii85 decoding that is carried from one piece of input to the next.
+        struct Ascii85DecodeState
+        {
+            /// @brief What is expected next.
+            enum class Stage
+            {
+                OPENING,         ///< Whitespace or the < of the <~ delimiter.
+                OPENING_TILDE,   ///< The ~ of the <~ delimiter.
+                DATA,            ///< Encoded characters, or the ~ of the ~> delimiter in adobe mode.
+                CLOSING_GREATER, ///< The > of the ~> delimiter.
+                CLOSED           ///< Only whitespace.
+            };
+
+            /**
+             * @brief Creates the state at the beginning of an input.
+             * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+            */
+            constexpr explicit Ascii85DecodeState(const bool adobeMode_) noexcept :
+                group(0),
+                groupSize(0),
+                stage(adobeMode_ ? Stage::OPENING : Stage::DATA),
+                isAdobeMode(adobeMode_),
+                isEmpty(true)
+            {}
+
+            std::uint64_t group;   ///< Value of the current group.
+            std::size_t groupSize; ///< Amount of characters in the current group.
+            Stage stage;           ///< What is expected next.
+            bool isAdobeMode;      ///< Whether or not the input is surrounded by <~ and ~> delimiters.
+            bool isEmpty;          ///< Whether or not no character has been seen yet.
+        };
+
+        /**
+         * @brief Decodes the incomplete group of an Ascii85 decoding by filling it up with u characters.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for 3 bytes.
+         * @param[in,out] state_ State of the decoding.
+         * @returns Amount of bytes written.
+        */
+        constexpr std::size_t FlushAscii85Group(unsigned char* output_, Ascii85DecodeState& state_) noexcept
+        {
+            const std::size_t written((state_.groupSize > 0) ? state_.groupSize - 1 : 0);
+
+            if(state_.groupSize > 0) {
+                for(std::size_t i(state_.groupSize); i < 5; ++i) {
+                    state_.group = (state_.group * 85) + 84;
+                }
+
+                const std::uint32_t group(static_cast<std::uint32_t>(state_.group));
+
+                for(std::size_t i(0); i < written; ++i) {
+                    output_[i] = static_cast<unsigned char>(group >> (24 - (8 * i)));
+                }
+            }
+
+            state_.group = 0;
+            state_.groupSize = 0;
+
+            return written;
+        }
+
+        /**
+         * Decodes Ascii85 characters into bytes. Whitespace and newline characters are ignored. The state is carried between calls, so that the input can
+         * be split at any point. The output must have room for 4 bytes per input character.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] foldSpaces_ Whether or not y is turned into 4 spaces.
+         * @param[in,out] state_ State of the decoding.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeAscii85(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool foldSpaces_,
+                                             Ascii85DecodeState& state_) noexcept
+        {
+            using Stage = Ascii85DecodeState::Stage;
+
+            std::size_t written(0);
+
+            if(inputSize_ > 0) {
+                state_.isEmpty = false;
+            }
+
+            for(std::size_t i(0); i < inputSize_; ++i) {
+                const char character(input_[i]);
+                const bool isWhitespace(character == ' ' or character == '\n');
+
+                switch(state_.stage) {
+                    case Stage::OPENING: {
+                        if(character == '<') {
+                            state_.stage = Stage::OPENING_TILDE;
+                        } else if(not isWhitespace) {
+                            return DecodeResult{written, false};
+                        }
+
+                        continue;
+                    }
+                    case Stage::OPENING_TILDE: {
+                        if(character != '~') {
+                            return DecodeResult{written, false};
+                        }
+
+                        state_.stage = Stage::DATA;
+
+                        continue;
+                    }
+                    case Stage::CLOSING_GREATER: {
+                        if(character != '>') {
+                            return DecodeResult{written, false};
+                        }
+
+                        state_.stage = Stage::CLOSED;
+
+                        continue;
+                    }
+                    case Stage::CLOSED: {
+                        if(not isWhitespace) {
+                            return DecodeResult{written, false};
+                        }
+
+                        continue;
+                    }
+                    case Stage::DATA: break;
+                }
+
+                if(isWhitespace) {
+                    continue;
+                } else if(character == '~' and state_.isAdobeMode) {
+                    written += FlushAscii85Group(output_ + written, state_);
+                    state_.stage = Stage::CLOSING_GREATER;
+
+                    continue;
+                } else if(state_.groupSize == 0 and (character == 'z' or (character == 'y' and foldSpaces_))) {
+                    std::fill_n(output_ + written, 4, static_cast<unsigned char>((character == 'z') ? 0 : ' '));
+                    written += 4;
+
+                    continue;
+                }
+
+                const unsigned char value(static_cast<unsigned char>(character));
+
+                if(value < 33 or value > 117) {
+                    return DecodeResult{written, false};
+                }
+
+                state_.group = (state_.group * 85) + (value - 33U);
+                state_.groupSize += 1;
+
+                if(state_.groupSize == 5) {
+                    const std::uint32_t group(static_cast<std::uint32_t>(state_.group));
+
+                    output_[written] = static_cast<unsigned char>(group >> 24);
+                    output_[written + 1] = static_cast<unsigned char>(group >> 16);
+                    output_[written + 2] = static_cast<unsigned char>(group >> 8);
+                    output_[written + 3] = static_cast<unsigned char>(group);
+                    written += 4;
+                    state_.group = 0;
+                    state_.groupSize = 0;
+                }
+            }
+
+            return DecodeResult{written, true};
+        }
+
+        /**
+         * @brief Ends an Ascii85 decoding. The incomplete group is decoded and in adobe mode the ~> delimiter has to have been seen (or no input at all).
+         * @param[out] output_ Where the decoded bytes are written to, must have room for 3 bytes.
+         * @param[in,out] state_ State of the decoding.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult FinishAscii85(unsigned char* output_, Ascii85DecodeState& state_) noexcept
+        {
+            if(state_.isAdobeMode) {
+                return DecodeResult{0, state_.stage == Ascii85DecodeState::Stage::CLOSED or state_.isEmpty};
+            }
+
+            return DecodeResult{FlushAscii85Group(output_, state_), true};
+        }
+
+        /**
+         * @brief Decodes an entire Ascii85 input. The output must have room for Ascii85MaximumDecodedSize bytes.
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] foldSpaces_ Whether or not y is turned into 4 spaces.
+         * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        constexpr DecodeResult DecodeAscii85(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool foldSpaces_,
+                                             const bool adobeMode_) noexcept
+        {
+            Ascii85DecodeState state(adobeMode_);
+            const DecodeResult result(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, state));
+
+            if(not result.isValid) {
+                return result;
+            }
+
+            const DecodeResult finishResult(FinishAscii85(output_ + result.size, state));
+
+            return DecodeResult{result.size + finishResult.size, finishResult.isValid};
+        }
+
+        /**
+         * Validates Ascii85 characters by decoding them chunk by chunk into a small buffer on the stack, carrying the state from one chunk to the
+         * next. The chunk that fails is decoded again one character at a time from its initial state to find the character that failed. An input that
+         * ends too early (without the ~> delimiter in adobe mode) has the input size as its error offset.
+         *
+         * @param[in] input_ Characters to be validated.
+         * @param[in] foldSpaces_ Whether or not y is turned into 4 spaces.
+         * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+         * @returns Whether or not the input is valid, its decoded size and the offset of the first invalid character.
+        */
+        inline ValidationResult ValidateAscii85(const std::string_view input_, const bool foldSpaces_, const bool adobeMode_) noexcept
+        {
+            constexpr std::size_t chunkSize(1024);
+            std::array<unsigned char, chunkSize * 4> output;
+            Ascii85DecodeState state(adobeMode_);
+            std::size_t decodedSize(0);
+
+            for(std::size_t i(0); i < input_.size(); i += chunkSize) {
+                const std::size_t size(std::min(chunkSize, input_.size() - i));
+                const Ascii85DecodeState chunkState(state);
+                const DecodeResult result(DecodeAscii85(input_.data() + i, size, output.data(), foldSpaces_, state));
+
+                if(not result.isValid) {
+                    state = chunkState;
+
+                    for(std::size_t j(0); j < size; ++j) {
+                        const DecodeResult characterResult(DecodeAscii85(input_.data() + i + j, 1, output.data(), foldSpaces_, state));
+
+                        if(not characterResult.isValid) {
+                            return ValidationResult{false, decodedSize, i + j};
+                        }
+
+                        decodedSize += characterResult.size;
+                    }
+                }
+
+                decodedSize += result.size;
+            }
+
+            const DecodeResult finishResult(FinishAscii85(output.data(), state));
+
+            return ValidationResult{finishResult.isValid, decodedSize + finishResult.size, input_.size()};
+        }
+
+        /**
+         * @brief Calculates the exact amount of characters whole Ascii85 groups are encoded into.
+         * @param[in] input_ Bytes to be encoded, only whole groups of 4 bytes are counted.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[in] foldSpaces_ Whether or not 4 spaces are turned into y.
+         * @returns Amount of characters EncodeAscii85 writes for the whole groups.
+        */
+        inline std::size_t Ascii85EncodedGroupsSize(const unsigned char* input_, const std::size_t inputSize_, const bool foldSpaces_) noexcept
+        {
+            std::size_t size(0);
+
+            for(std::size_t i(0); i + 4 <= inputSize_; i += 4) {
+                const std::uint32_t group(LoadAscii85Group(input_ + i));
+
+                size += (group == 0 or (group == 0x20202020 and foldSpaces_)) ? 1 : 5;
+            }
+
+            return size;
+        }
+
+        /**
+         * Encodes bytes into Ascii85 on several threads. Groups turned into z or y make the output position of a chunk depend on everything before it, so
+         * the size of every chunk is calculated first and the chunks are encoded afterwards. The output must have room for Ascii85MaximumEncodedSize
+         * characters.
+         *
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] foldSpaces_ Whether or not 4 spaces are turned into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded characters with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of characters written.
+        */
+        inline std::size_t EncodeAscii85InParallel(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool foldSpaces_,
+                                                   const bool adobeMode_, const std::size_t threadCount_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, inputSize_);
+            const std::size_t chunkCount(GetChunkCount(threadCount_, inputSize_));
+
+            if(chunkCount == 1) {
+                return timer.CountOutput(EncodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            const std::size_t chunkSize(((inputSize_ / chunkCount) / 4) * 4);
+            std::vector<std::size_t> offsets;
+
+            try {
+                offsets.resize(chunkCount);
+            } catch(const std::exception&) {
+                return timer.CountOutput(EncodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            RunChunksInParallel(chunkCount - 1, [&](const std::size_t chunk_) noexcept {
+                offsets[chunk_ + 1] = Ascii85EncodedGroupsSize(input_ + (chunk_ * chunkSize), chunkSize, foldSpaces_);
+            });
+
+            offsets[0] = adobeMode_ ? 2 : 0;
+
+            for(std::size_t i(1); i < chunkCount; ++i) {
+                offsets[i] += offsets[i - 1];
+            }
+
+            const std::size_t lastOffset(chunkSize * (chunkCount - 1));
+            std::size_t lastWritten(0);
+
+            RunChunksInParallel(chunkCount, [&](const std::size_t chunk_) noexcept {
+                const std::size_t offset(chunk_ * chunkSize);
+
+                if(offset == lastOffset) {
+                    lastWritten = EncodeAscii85(input_ + offset, inputSize_ - offset, output_ + offsets[chunk_], foldSpaces_);
+                } else {
+                    EncodeAscii85(input_ + offset, chunkSize, output_ + offsets[chunk_], foldSpaces_);
+                }
+            });
+
+            std::size_t written(offsets[chunkCount - 1] + lastWritten);
+
+            if(adobeMode_) {
+                std::memcpy(output_, "<~", 2);
+                std::memcpy(output_ + written, "~>", 2);
+                written += 2;
+            }
+
+            return timer.CountOutput(written);
+        }
+
+        /**
+         * Decodes Ascii85 characters into bytes on several threads. The encoded characters, z and y of every chunk are counted first and each boundary is
+         * moved forward to the start of the next group, which gives the output position of every chunk. If a chunk turns out not to end where it was
+         * expected to (an invalid character, a misplaced z or y, or an early ~> delimiter) the input is decoded again on the calling thread. The output
+         * must have room for Ascii85MaximumDecodedSize bytes.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] foldSpaces_ Whether or not y is turned into 4 spaces.
+         * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads to use, 0 for one per hardware thread.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeAscii85InParallel(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool foldSpaces_,
+                                                    const bool adobeMode_, const std::size_t threadCount_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            const std::size_t chunkCount(GetChunkCount(threadCount_, inputSize_));
+
+            if(chunkCount == 1) {
+                return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            const std::size_t chunkSize(inputSize_ / chunkCount);
+            std::size_t dataBegin(0);
+
+            if(adobeMode_) {
+                dataBegin = std::string_view(input_, inputSize_).find_first_not_of(" \n");
+
+                if(dataBegin == std::string_view::npos or dataBegin + 2 > chunkSize or std::string_view(input_ + dataBegin, 2) != "<~") {
+                    return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+                }
+
+                dataBegin += 2;
+            }
+
+            std::vector<std::size_t> boundaries;
+            std::vector<std::size_t> offsets;
+            std::vector<std::size_t> characterCounts;
+            std::vector<std::size_t> foldedCounts;
+
+            try {
+                boundaries.resize(chunkCount + 1);
+                offsets.resize(chunkCount);
+                characterCounts.resize(chunkCount);
+                foldedCounts.resize(chunkCount);
+            } catch(const std::exception&) {
+                return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            RunChunksInParallel(chunkCount - 1, [&](const std::size_t chunk_) noexcept {
+                const std::size_t end((chunk_ + 1) * chunkSize);
+                std::size_t characterCount(0);
+                std::size_t foldedCount(0);
+
+                for(std::size_t i(std::max(chunk_ * chunkSize, dataBegin)); i < end; ++i) {
+                    const unsigned char value(static_cast<unsigned char>(input_[i]));
+
+                    characterCount += (value >= 33 and value <= 117) ? 1 : 0;
+                    foldedCount += (value == 'z' or (value == 'y' and foldSpaces_)) ? 1 : 0;
+                }
+
+                characterCounts[chunk_ + 1] = characterCount;
+                foldedCounts[chunk_ + 1] = foldedCount;
+            });
+
+            std::size_t characterCount(0);
+            std::size_t foldedCount(0);
+
+            boundaries[chunkCount] = inputSize_;
+
+            for(std::size_t i(1); i < chunkCount; ++i) {
+                characterCount += characterCounts[i];
+                foldedCount += foldedCounts[i];
+
+                std::size_t boundary(i * chunkSize);
+                std::size_t adjustedCharacterCount(characterCount);
+
+                while(adjustedCharacterCount % 5 != 0) {
+                    if(boundary >= (i + 1) * chunkSize) {
+                        return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+                    }
+
+                    const unsigned char value(static_cast<unsigned char>(input_[boundary++]));
+
+                    if(value >= 33 and value <= 117) {
+                        ++adjustedCharacterCount;
+                    } else if(value != ' ' and value != '\n') {
+                        return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+                    }
+                }
+
+                boundaries[i] = boundary;
+                offsets[i] = ((adjustedCharacterCount / 5) * 4) + (foldedCount * 4);
+            }
+
+            DecodeResult lastResult{0, true};
+            std::atomic<bool> isComplete(true);
+
+            RunChunksInParallel(chunkCount, [&](const std::size_t chunk_) noexcept {
+                const bool isLast(chunk_ + 1 == chunkCount);
+                const std::size_t begin(boundaries[chunk_]);
+                unsigned char* const output(output_ + offsets[chunk_]);
+                // Only the first chunk has the <~ delimiter and only the last one can have the ~> delimiter
+                Ascii85DecodeState state(adobeMode_ and chunk_ == 0);
+
+                state.isAdobeMode = adobeMode_ and (chunk_ == 0 or isLast);
+
+                DecodeResult result(DecodeAscii85(input_ + begin, boundaries[chunk_ + 1] - begin, output, foldSpaces_, state));
+
+                if(isLast) {
+                    if(result.isValid) {
+                        const DecodeResult finishResult(FinishAscii85(output + result.size, state));
+
+                        result = DecodeResult{result.size + finishResult.size, finishResult.isValid};
+                    }
+
+                    lastResult = result;
+                } else if(not result.isValid or state.stage != Ascii85DecodeState::Stage::DATA or state.groupSize != 0
+                          or result.size != offsets[chunk_ + 1] - offsets[chunk_]) {
+                    isComplete.store(false, std::memory_order_relaxed);
+                }
+            });
+
+            if(not isComplete.load(std::memory_order_relaxed)) {
+                return timer.CountOutput(DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            return timer.CountOutput(DecodeResult{offsets[chunkCount - 1] + lastResult.size, lastResult.isValid});
+        }
+
+        /**
+         * Encodes bytes into Ascii85 split into lines. As many groups as surely fit into the current line are encoded right where they end up, a group
+         * that straddles two lines goes through a small buffer. The output must have room for WrappedSize(Ascii85MaximumEncodedSize) characters.
+         *
+         * @param[in] input_ Bytes to be encoded.
+         * @param[in] inputSize_ Amount of bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to.
+         * @param[in] foldSpaces_ Whether or not 4 spaces are turned into y.
+         * @param[in] adobeMode_ Whether or not the <~ and ~> delimiters are included.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @returns Amount of characters written.
+        */
+        inline std::size_t EncodeAscii85Lines(const unsigned char* input_, const std::size_t inputSize_, char* output_, const bool foldSpaces_,
+                                              const bool adobeMode_, const LineWrapping& lineWrapping_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, inputSize_);
+
+            if(lineWrapping_.lineLength == 0) {
+                return timer.CountOutput(EncodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_));
+            }
+
+            LineWriter writer(output_, lineWrapping_);
+            std::array<char, 5> group{};
+            const std::size_t wholeSize(inputSize_ - (inputSize_ % 4));
+            std::size_t i(0);
+
+            if(adobeMode_) {
+                writer.Write("<~", 2);
+            }
+
+            while(i < wholeSize) {
+                const std::size_t groupCount(std::min(writer.StartLine() / 5, (wholeSize - i) / 4));
+
+                if(groupCount > 0) {
+                    writer.Advance(EncodeAscii85(input_ + i, groupCount * 4, writer.GetPosition(), foldSpaces_));
+                    i += groupCount * 4;
+                } else {
+                    writer.Write(group.data(), EncodeAscii85(input_ + i, 4, group.data(), foldSpaces_));
+                    i += 4;
+                }
+            }
+
+            if(i < inputSize_) {
+                writer.Write(group.data(), EncodeAscii85(input_ + i, inputSize_ - i, group.data(), foldSpaces_));
+            }
+
+            if(adobeMode_) {
+                writer.Write("~>", 2);
+            }
+
+            return timer.CountOutput(writer.GetSize());
+        }
+
+        /**
+         * Decodes Ascii85 characters into bytes, skipping every kind of whitespace anywhere, even inside the delimiters. The runs between whitespace are
+         * decoded where they are, carrying the state from one run to the next. The output must have room for Ascii85MaximumDecodedSize bytes.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[in] inputSize_ Amount of characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to.
+         * @param[in] foldSpaces_ Whether or not y is turned into 4 spaces.
+         * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+         * @returns Amount of bytes written and whether or not the input was valid.
+        */
+        inline DecodeResult DecodeAscii85IgnoringWhitespace(const char* input_, const std::size_t inputSize_, unsigned char* output_, const bool foldSpaces_,
+                                                            const bool adobeMode_) noexcept
+        {
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
+            Ascii85DecodeState state(adobeMode_);
+            DecodeResult result{0, true};
+
+            ForEachRun(input_, inputSize_, [&](const char* run_, const std::size_t runSize_) noexcept {
+                const DecodeResult runResult(DecodeAscii85(run_, runSize_, output_ + result.size, foldSpaces_, state));
+
+                result = DecodeResult{result.size + runResult.size, runResult.isValid};
+
+                return runResult.isValid;
+            });
+
+            if(not result.isValid) {
+                return timer.CountOutput(result);
+            }
+
+            const DecodeResult finishResult(FinishAscii85(output_ + result.size, state));
+
+            return timer.CountOutput(DecodeResult{result.size + finishResult.size, finishResult.isValid});
+        }
+    }
+
+    /// @brief A namespace that has functions that implement Ascii85 encoding and decoding.
+    namespace Ascii85
+    {
+        /// @brief A simple error class for the Ascii85 namespace.
+        class Error : public std::exception
+        {
+        public:
+            /// @brief The type of Error.
+            enum class Type
+            {
+                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
+                STRING_PARSE_ERROR,            ///< Failed to parse string.
+                OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
+            };
+
+            /**
+             * @brief Creates an Error of given Type.
+             * @param[in] type_ Type of Error.
+             * @param[in] sourceLocation_ Source location of Error.
+            */
+            explicit Error(const Type type_, const std::source_location sourceLocation_ = std::source_location::current()) :
+                _type(type_),
+                _sourceLocation(sourceLocation_)
+            {
+                switch(_type) {
+                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
+                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                    case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
+                    default: _what = "Invalid error type"; break;
+                }
+            }
+
+            /**
+             * @brief Gets the Type of the Error.
+             * @returns Type of Error.
+            */
+            Type GetType() const noexcept { return _type; }
+            /**
+             * @brief Gets the location at which the Error was thrown.
+             * @returns Source location of Error.
+            */
+            std::source_location GetSourceLocation() const { return _sourceLocation; }
+            /**
+             * @brief Gets reason for the Error.
+             * @returns Reason for the Error.
+            */
+            std::string What() const { return _what; }
+
+            // For C++ compatibility purposes
+
+            const char* what() const noexcept override { return _what.c_str(); }
+
+        private:
+            Type _type;
+            std::source_location _sourceLocation;
+            std::string _what;
+        };
+
+        static_assert(Internal::charSize == 8, "These Ascii85 functions only works if a char is 8 bits big");
+
+        /**
+         * @brief Gets the category of the error codes set by the non-throwing functions.
+         * @returns Error category of the Ascii85 namespace.
+        */
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            static const Internal::ErrorCategory<Error> errorCategory("BinaryText::Ascii85");
+
+            return errorCategory;
+        }
+        /**
+         * @brief Creates an error code of given Type.
+         * @param[in] type_ Type of Error.
+         * @returns Error code in the category returned by GetErrorCategory.
+        */
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return std::error_code(static_cast<int>(type_) + 1, GetErrorCategory()); }
+        /**
+         * @brief Calculates the maximum size of an Ascii85 encoded string. Groups turned into z or y make the encoded string shorter.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] adobeMode_ Whether or not the <~ and ~> delimiters are included.
+         * @returns Maximum amount of characters the encoded string will have.
+        */
+        constexpr std::size_t MaximumEncodedSize(const std::size_t size_, const bool adobeMode_ = false) noexcept
+        {
+            return Internal::Ascii85MaximumEncodedSize(size_, adobeMode_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes an Ascii85 encoded string of given size can be decoded into, assuming every character is z or y.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept { return size_ * 4; }
+        /**
+         * @brief Calculates the maximum size of an Ascii85 encoded file, which can be larger than memory and than std::size_t (see BinaryText::Files).
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] adobeMode_ Whether or not the <~ and ~> delimiters are included.
+         * @returns Maximum amount of characters the encoded file will have.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t MaximumEncodedFileSize(const std::uint64_t size_, const bool adobeMode_ = false)
+        {
+            return Internal::Ascii85MaximumEncodedSize(Internal::CheckFileSize(size_, 4, 5, 4), adobeMode_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes an Ascii85 encoded file can be decoded into, every character can be a z or a y of 4 bytes.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+         * @throws std::length_error
+        */
+        constexpr std::uint64_t MaximumDecodedFileSize(const std::uint64_t size_) { return Internal::CheckFileSize(size_, 1, 4) * 4; }
+        /**
+         * @brief Calculates the maximum amount of bytes an Ascii85 encoded string can be decoded into, taking its z and y characters into account.
+         * @param[in] input_ Characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        constexpr std::size_t MaximumDecodedSize(const std::string_view input_) noexcept { return Internal::Ascii85MaximumDecodedSize(input_); }
+        /**
+         * @brief Calculates the maximum size of an Ascii85 encoded string that is split into lines.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] adobeMode_ Whether or not the <~ and ~> delimiters are included.
+         * @returns Maximum amount of characters the encoded string will have, including the separators.
+        */
+        constexpr std::size_t MaximumWrappedEncodedSize(const std::size_t size_, const LineWrapping& lineWrapping_, const bool adobeMode_ = false) noexcept
+        {
+            return Internal::WrappedSize(Internal::Ascii85MaximumEncodedSize(size_, adobeMode_), lineWrapping_);
+        }
+
+        /**
+         * Encodes a string literal into Ascii85 at compile time, for constants that should not cost anything at run time. The std::array has exactly as
+         * many characters as were written, which groups turned into z or y make fewer than MaximumEncodedSize, and no terminating null character.
+         *
+         * @tparam string_ String literal to be encoded.
+         * @tparam foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @tparam adobeMode_ Whether or not to surround the encoded characters with <~ and ~> delimiters.
+         * @returns Encoded characters.
+        */
+        template<Internal::ConstantString string_, bool foldSpaces_ = false, bool adobeMode_ = false>
+        consteval auto EncodeArray() noexcept
+        {
+            constexpr auto encode([](const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                return Internal::EncodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_);
+            });
+            constexpr auto encoded(Internal::EncodeConstant<MaximumEncodedSize(string_.characters.size(), adobeMode_)>(string_, encode));
+
+            return Internal::MakeConstantArray<char, encoded.size>(encoded);
+        }
+        /**
+         * @brief Decodes an Ascii85 string literal at compile time, a string literal that is not valid Ascii85 does not compile.
+         * @tparam encodedString_ String literal to be decoded.
+         * @tparam foldSpaces_ Whether or not to fold spaces. That is, to turn y into 4 spaces (00100000001000000010000000100000).
+         * @tparam adobeMode_ Whether or not the string literal is surrounded by <~ and ~> delimiters.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @returns Decoded bytes, in a std::array of exactly their amount.
+        */
+        template<Internal::ConstantString encodedString_, bool foldSpaces_ = false, bool adobeMode_ = false, ByteBufferCompatible ByteType = unsigned char>
+        consteval auto DecodeArray() noexcept
+        {
+            constexpr auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_);
+            });
+            constexpr std::string_view characters(encodedString_.characters.data(), encodedString_.characters.size());
+            constexpr auto decoded(Internal::DecodeConstant<MaximumDecodedSize(characters)>(encodedString_, decode));
+
+            static_assert(decoded.isValid, "The string literal is not valid Ascii85");
+
+            return Internal::MakeConstantArray<ByteType, decoded.size>(decoded);
+        }
+
+        /**
+         * @brief Encodes a not-encoded string into an Ascii85 encoded string.
+         * @param[in] string_ String to be encoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                                const std::size_t threadCount_ = 1)
+        {
+            std::string encodedString;
+
+            if(string_.size() > ((encodedString.max_size() - 4) / 5) * 4) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(Internal::Ascii85MaximumEncodedSize(string_.size(), adobeMode_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            encodedString.resize(Internal::EncodeAscii85InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(),
+                                                                   foldSpaces_, adobeMode_, threadCount_));
+
+            return encodedString;
+        }
+        /**
+         * @brief Encodes a ByteBuffer into a Ascii85 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                             const std::size_t threadCount_ = 1)
+        {
+            std::string encodedString;
+
+            if(byteBuffer_.GetSize() > ((encodedString.max_size() - 4) / 5) * 4) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(Internal::Ascii85MaximumEncodedSize(byteBuffer_.GetSize(), adobeMode_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            encodedString.resize(Internal::EncodeAscii85InParallel(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(),
+                                                                   encodedString.data(), foldSpaces_, adobeMode_, threadCount_));
+
+            return encodedString;
+        }
+        /**
+         * @brief Encodes a ByteBufferView into a Ascii85 encoded string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                             const std::size_t threadCount_ = 1)
+        {
+            return EncodeStringToString(Internal::ViewAsCharacters(byteBufferView_), foldSpaces_, adobeMode_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into an Ascii85 encoded string of the caller, like EncodeStringToString but reusing the capacity of the string, so
+         * that encoding many inputs into the same string does not allocate once it is big enough.
+         *
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                               const std::size_t threadCount_ = 1)
+        {
+            if(string_.size() > ((encodedString_.max_size() - 4) / 5) * 4) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            const auto encode([string_, foldSpaces_, adobeMode_, threadCount_](char* output_) noexcept {
+                return Internal::EncodeAscii85InParallel(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), output_, foldSpaces_,
+                                                         adobeMode_, threadCount_);
+            });
+
+            Internal::EncodeIntoString<Error>(encodedString_, Internal::Ascii85MaximumEncodedSize(string_.size(), adobeMode_), encode);
+        }
+        /**
+         * @brief Encodes a ByteBuffer into an Ascii85 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                        const std::size_t threadCount_ = 1)
+        {
+            EncodeInto(Internal::ViewAsCharacters(byteBuffer_), encodedString_, foldSpaces_, adobeMode_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into an Ascii85 encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool foldSpaces_ = false,
+                        const bool adobeMode_ = false, const std::size_t threadCount_ = 1)
+        {
+            EncodeInto(Internal::ViewAsCharacters(byteBufferView_), encodedString_, foldSpaces_, adobeMode_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into an Ascii85 encoded string that is split into lines. The delimiters can be split as well, so such a string is
+         * decoded by the functions that take IgnoreWhitespace.
+         *
+         * @param[in] string_ String to be encoded.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline std::string EncodeStringToString(const std::string_view string_, const LineWrapping& lineWrapping_, const bool foldSpaces_ = false,
+                                                const bool adobeMode_ = false)
+        {
+            std::string encodedString;
+
+            if(string_.size() > ((encodedString.max_size() - 4) / 5) * 4
+               or Internal::Ascii85MaximumEncodedSize(string_.size(), adobeMode_) > encodedString.max_size() / (lineWrapping_.separator.size() + 1)) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(MaximumWrappedEncodedSize(string_.size(), lineWrapping_, adobeMode_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            encodedString.resize(Internal::EncodeAscii85Lines(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), encodedString.data(),
+                                                              foldSpaces_, adobeMode_, lineWrapping_));
+
+            return encodedString;
+        }
+        /**
+         * Encodes a ByteBuffer into an Ascii85 encoded string that is split into lines. The delimiters can be split as well, so such a string is decoded by
+         * the functions that take IgnoreWhitespace.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const LineWrapping& lineWrapping_, const bool foldSpaces_ = false,
+                                             const bool adobeMode_ = false)
+        {
+            std::string encodedString;
+
+            if(byteBuffer_.GetSize() > ((encodedString.max_size() - 4) / 5) * 4
+               or Internal::Ascii85MaximumEncodedSize(byteBuffer_.GetSize(), adobeMode_) > encodedString.max_size() / (lineWrapping_.separator.size() + 1)) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            try {
+                encodedString.resize(MaximumWrappedEncodedSize(byteBuffer_.GetSize(), lineWrapping_, adobeMode_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            encodedString.resize(Internal::EncodeAscii85Lines(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize(),
+                                                              encodedString.data(), foldSpaces_, adobeMode_, lineWrapping_));
+
+            return encodedString;
+        }
+        /**
+         * Encodes a ByteBufferView into an Ascii85 encoded string that is split into lines. The delimiters can be split as well, so such a string is decoded by
+         * the functions that take IgnoreWhitespace.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const LineWrapping& lineWrapping_, const bool foldSpaces_ = false,
+                                             const bool adobeMode_ = false)
+        {
+            return EncodeStringToString(Internal::ViewAsCharacters(byteBufferView_), lineWrapping_, foldSpaces_, adobeMode_);
+        }
+        /**
+         * @brief Decodes a Ascii85 encoded string into a decoded string. Whitespace and newline characters are ignored.
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                                const std::size_t threadCount_ = 1)
+        {
+            std::string decodedString;
+
+            try {
+                decodedString.resize(Internal::Ascii85MaximumDecodedSize(encodedString_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+
+            const Internal::DecodeResult result(Internal::DecodeAscii85InParallel(encodedString_.data(), encodedString_.size(),
+                                                                                  reinterpret_cast<unsigned char*>(decodedString.data()), foldSpaces_,
+                                                                                  adobeMode_, threadCount_));
+
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+
+            decodedString.resize(result.size);
+
+            return decodedString;
+        }
+        /**
+         * @brief Decodes a Ascii85 encoded string into a decoded ByteBuffer. Whitespace and newline characters are ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Ascii85::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                                      const std::size_t threadCount_ = 1, std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            ByteBuffer<ByteType> decodedByteBuffer(Internal::Ascii85MaximumDecodedSize(encodedString_), uninitialized, memoryResource_);
+            const Internal::DecodeResult result(Internal::DecodeAscii85InParallel(encodedString_.data(), encodedString_.size(),
+                                                                                  reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), foldSpaces_,
+                                                                                  adobeMode_, threadCount_));
+
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+
+            decodedByteBuffer.Resize(result.size);
+
+            return decodedByteBuffer;
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing.
+         * Whitespace and newline characters are ignored.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false,
+                                                           const std::size_t threadCount_ = 1) noexcept
+        {
+            const auto decode([foldSpaces_, adobeMode_, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85InParallel(input_, inputSize_, output_, foldSpaces_, adobeMode_, threadCount_);
+            });
+
+            return Internal::TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_), MakeErrorCode, decode);
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing.
+         * A ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace and newline characters are ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const bool foldSpaces_ = false,
+                                                                 const bool adobeMode_ = false, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            const auto decode([foldSpaces_, adobeMode_, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85InParallel(input_, inputSize_, output_, foldSpaces_, adobeMode_, threadCount_);
+            });
+
+            return Internal::TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_), memoryResource_, MakeErrorCode, decode);
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded string of the caller, like DecodeStringToString but reusing the capacity of the string, so
+         * that decoding many inputs into the same string does not allocate once it is big enough. If an Error is thrown the string is left empty.
+         * Whitespace and newline characters are ignored.
+         *
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedString_.
+         * @param[out] decodedString_ String the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const bool foldSpaces_ = false,
+                               const bool adobeMode_ = false, const std::size_t threadCount_ = 1)
+        {
+            const auto decode([foldSpaces_, adobeMode_, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85InParallel(input_, inputSize_, output_, foldSpaces_, adobeMode_, threadCount_);
+            });
+
+            Internal::DecodeIntoString<Error>(encodedString_, decodedString_, MaximumDecodedSize(encodedString_), decode);
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded ByteBuffer of the caller, like DecodeStringToByteBuffer but reusing the capacity of the
+         * ByteBuffer and without initializing its bytes first. If an Error is thrown the ByteBuffer is left empty. Whitespace and newline characters are
+         * ignored.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedByteBuffer_.
+         * @param[out] decodedByteBuffer_ ByteBuffer the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::Ascii85::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const bool foldSpaces_ = false,
+                        const bool adobeMode_ = false,
+                                const std::size_t threadCount_ = 1)
+        {
+            const auto decode([foldSpaces_, adobeMode_, threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85InParallel(input_, inputSize_, output_, foldSpaces_, adobeMode_, threadCount_);
+            });
+
+            Internal::DecodeIntoByteBuffer<Error>(encodedString_, decodedByteBuffer_, MaximumDecodedSize(encodedString_), decode);
+        }
+        /**
+         * Decodes a Ascii85 encoded string into a decoded string. Not only spaces and newlines but also tabs, vertical tabs, form feeds and carriage returns
+         * are skipped, anywhere in the input including the delimiters.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
+        */
+        inline std::string DecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace, const bool foldSpaces_ = false,
+                                                const bool adobeMode_ = false)
+        {
+            std::string decodedString;
 
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 4);
-                        counter = 2U;
+            try {
+                decodedString.resize(Internal::Ascii85MaximumDecodedSize(encodedString_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
 
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
-                }
+            const Internal::DecodeResult result(Internal::DecodeAscii85IgnoringWhitespace(encodedString_.data(), encodedString_.size(),
+                                                                                          reinterpret_cast<unsigned char*>(decodedString.data()), foldSpaces_,
+                                                                                          adobeMode_));
 
-                for(unsigned int i(1U); i < 9U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 5) / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B00000ULL: encodedString.append(1, '0'); break;
-                            case 0B00001ULL: encodedString.append(1, '1'); break;
-                            case 0B00010ULL: encodedString.append(1, '2'); break;
-                            case 0B00011ULL: encodedString.append(1, '3'); break;
-                            case 0B00100ULL: encodedString.append(1, '4'); break;
-                            case 0B00101ULL: encodedString.append(1, '5'); break;
-                            case 0B00110ULL: encodedString.append(1, '6'); break;
-                            case 0B00111ULL: encodedString.append(1, '7'); break;
-                            case 0B01000ULL: encodedString.append(1, '8'); break;
-                            case 0B01001ULL: encodedString.append(1, '9'); break;
-                            case 0B01010ULL: encodedString.append(1, 'A'); break;
-                            case 0B01011ULL: encodedString.append(1, 'B'); break;
-                            case 0B01100ULL: encodedString.append(1, 'C'); break;
-                            case 0B01101ULL: encodedString.append(1, 'D'); break;
-                            case 0B01110ULL: encodedString.append(1, 'E'); break;
-                            case 0B01111ULL: encodedString.append(1, 'F'); break;
-                            case 0B10000ULL: encodedString.append(1, 'G'); break;
-                            case 0B10001ULL: encodedString.append(1, 'H'); break;
-                            case 0B10010ULL: encodedString.append(1, 'I'); break;
-                            case 0B10011ULL: encodedString.append(1, 'J'); break;
-                            case 0B10100ULL: encodedString.append(1, 'K'); break;
-                            case 0B10101ULL: encodedString.append(1, 'L'); break;
-                            case 0B10110ULL: encodedString.append(1, 'M'); break;
-                            case 0B10111ULL: encodedString.append(1, 'N'); break;
-                            case 0B11000ULL: encodedString.append(1, 'O'); break;
-                            case 0B11001ULL: encodedString.append(1, 'P'); break;
-                            case 0B11010ULL: encodedString.append(1, 'Q'); break;
-                            case 0B11011ULL: encodedString.append(1, 'R'); break;
-                            case 0B11100ULL: encodedString.append(1, 'S'); break;
-                            case 0B11101ULL: encodedString.append(1, 'T'); break;
-                            case 0B11110ULL: encodedString.append(1, 'U'); break;
-                            case 0B11111ULL: encodedString.append(1, 'V'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
             }
 
-            return encodedString;
+            decodedString.resize(result.size);
+
+            return decodedString;
         }
         /**
-         * @brief Encodes a ByteBuffer into a Base32Hex encoded string.
+         * Decodes a Ascii85 encoded string into a decoded ByteBuffer. Not only spaces and newlines but also tabs, vertical tabs, form feeds and carriage
+         * returns are skipped, anywhere in the input including the delimiters.
+         *
          * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base32Hex::Error
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Ascii85::Error
          * @throws BinaryText::ByteBuffer::Error
         */
         template<typename ByteType>
             requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true)
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace, const bool foldSpaces_ = false,
+                                                      const bool adobeMode_ = false, std::pmr::memory_resource* memoryResource_ = nullptr)
         {
-            using Internal::charSize;
-
-            std::string encodedString;
+            ByteBuffer<ByteType> decodedByteBuffer(Internal::Ascii85MaximumDecodedSize(encodedString_), uninitialized, memoryResource_);
+            const Internal::DecodeResult result(Internal::DecodeAscii85IgnoringWhitespace(encodedString_.data(), encodedString_.size(),
+                                                                                          reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()),
+                                                                                          foldSpaces_, adobeMode_));
 
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(byteBuffer_.GetSize()) / 5.0) * 8.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
             }
 
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int counter(0U);
+            decodedByteBuffer.Resize(result.size);
 
-                for(typename ByteBuffer<ByteType>::ConstantIterator jter(iter); jter != byteBuffer_.ConstantEnd(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == byteBuffer_.ConstantEnd() or std::next(jter, 1) == std::next(iter, 5)) {
-                        iter = jter;
+            return decodedByteBuffer;
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing. Every
+         * kind of whitespace is skipped, anywhere in the input including the delimiters.
+         *
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        inline Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, IgnoreWhitespace, const bool foldSpaces_ = false,
+                                                           const bool adobeMode_ = false) noexcept
+        {
+            const auto decode([foldSpaces_, adobeMode_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85IgnoringWhitespace(input_, inputSize_, output_, foldSpaces_, adobeMode_);
+            });
 
-                        break;
-                    }
-                }
+            return Internal::TryDecodeToString<Error>(encodedString_, MaximumDecodedSize(encodedString_), MakeErrorCode, decode);
+        }
+        /**
+         * Decodes an Ascii85 encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing.
+         * A ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Every kind of whitespace is skipped, anywhere in the
+         * input including the delimiters.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, IgnoreWhitespace, const bool foldSpaces_ = false,
+                                                                 const bool adobeMode_ = false, std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            const auto decode([foldSpaces_, adobeMode_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85IgnoringWhitespace(input_, inputSize_, output_, foldSpaces_, adobeMode_);
+            });
 
-                switch(counter) {
-                    case 5U: counter = 8U; break;
-                    case 4U: {
-                        bitset <<= charSize;
-                        counter = 7U;
+            return Internal::TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize(encodedString_), memoryResource_, MakeErrorCode, decode);
+        }
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= (charSize * 2);
-                        counter = 5U;
+        /**
+         * @brief Decodes Ascii85 encoded characters held by a ByteBuffer into a decoded ByteBuffer. Whitespace and newline characters are ignored.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @tparam EncodedByteType Type of the encoded ByteBuffer that satisfies the ByteBufferCompatible concept.
+         * @param[in] encodedByteBuffer_ ByteBuffer to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::Ascii85::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const bool foldSpaces_ = false,
+                                                          const bool adobeMode_ = false, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return DecodeStringToByteBuffer<ByteType>(Internal::ViewAsCharacters(encodedByteBuffer_), foldSpaces_, adobeMode_, threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes Ascii85 encoded characters held by a ByteBuffer into the ByteBuffer itself, the decoded bytes overwrite the characters and the ByteBuffer is
+         * shrunk to fit them, so no second buffer is needed. Whitespace and newline characters are ignored. If an Error is thrown the ByteBuffer is cleared.
+         *
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
+        */
+        template<typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+        {
+            const std::string_view characters(Internal::ViewAsCharacters(byteBuffer_));
+            const auto decode([foldSpaces_, adobeMode_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAscii85(input_, inputSize_, output_, foldSpaces_, adobeMode_);
+            });
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (charSize * 3);
-                        counter = 4U;
+            // z and y are decoded into 4 bytes each, so the decoded bytes could overwrite characters that have not been read yet
+            if(characters.find('z') != std::string_view::npos or (foldSpaces_ and characters.find('y') != std::string_view::npos)) {
+                Statistics::StageTimer timer(Statistics::Stage::DECODE, characters.size());
+                ByteBuffer<ByteType> decodedByteBuffer(Internal::Ascii85MaximumDecodedSize(characters), uninitialized, byteBuffer_.GetMemoryResource());
+                const Internal::DecodeResult result(timer.CountOutput(decode(characters.data(), characters.size(),
+                                                                             reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()))));
 
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 4);
-                        counter = 2U;
+                byteBuffer_.Clear();
 
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
                 }
 
-                for(unsigned int i(1U); i < 9U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 5) / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B00000ULL: encodedString.append(1, '0'); break;
-                            case 0B00001ULL: encodedString.append(1, '1'); break;
-                            case 0B00010ULL: encodedString.append(1, '2'); break;
-                            case 0B00011ULL: encodedString.append(1, '3'); break;
-                            case 0B00100ULL: encodedString.append(1, '4'); break;
-                            case 0B00101ULL: encodedString.append(1, '5'); break;
-                            case 0B00110ULL: encodedString.append(1, '6'); break;
-                            case 0B00111ULL: encodedString.append(1, '7'); break;
-                            case 0B01000ULL: encodedString.append(1, '8'); break;
-                            case 0B01001ULL: encodedString.append(1, '9'); break;
-                            case 0B01010ULL: encodedString.append(1, 'A'); break;
-                            case 0B01011ULL: encodedString.append(1, 'B'); break;
-                            case 0B01100ULL: encodedString.append(1, 'C'); break;
-                            case 0B01101ULL: encodedString.append(1, 'D'); break;
-                            case 0B01110ULL: encodedString.append(1, 'E'); break;
-                            case 0B01111ULL: encodedString.append(1, 'F'); break;
-                            case 0B10000ULL: encodedString.append(1, 'G'); break;
-                            case 0B10001ULL: encodedString.append(1, 'H'); break;
-                            case 0B10010ULL: encodedString.append(1, 'I'); break;
-                            case 0B10011ULL: encodedString.append(1, 'J'); break;
-                            case 0B10100ULL: encodedString.append(1, 'K'); break;
-                            case 0B10101ULL: encodedString.append(1, 'L'); break;
-                            case 0B10110ULL: encodedString.append(1, 'M'); break;
-                            case 0B10111ULL: encodedString.append(1, 'N'); break;
-                            case 0B11000ULL: encodedString.append(1, 'O'); break;
-                            case 0B11001ULL: encodedString.append(1, 'P'); break;
-                            case 0B11010ULL: encodedString.append(1, 'Q'); break;
-                            case 0B11011ULL: encodedString.append(1, 'R'); break;
-                            case 0B11100ULL: encodedString.append(1, 'S'); break;
-                            case 0B11101ULL: encodedString.append(1, 'T'); break;
-                            case 0B11110ULL: encodedString.append(1, 'U'); break;
-                            case 0B11111ULL: encodedString.append(1, 'V'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
+                decodedByteBuffer.Resize(result.size);
+                byteBuffer_ = std::move(decodedByteBuffer);
+            } else if(not Internal::DecodeInPlace(byteBuffer_, decode)) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
             }
+        }
 
-            return encodedString;
+        /**
+         * Checks whether Ascii85 encoded characters can be decoded, by the same rules as the decoding functions but without keeping the decoded bytes.
+         * Nothing is allocated and nothing is thrown. Whitespace and newline characters are ignored.
+         *
+         * @param[in] input_ Characters to be checked.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not the input is surrounded by <~ and ~> delimiters.
+         * @returns Whether or not the input is valid, the exact decoded size and the offset of the first character that cannot be decoded.
+        */
+        inline ValidationResult Validate(const std::string_view input_, const bool foldSpaces_ = false, const bool adobeMode_ = false) noexcept
+        {
+            return Internal::ValidateAscii85(input_, foldSpaces_, adobeMode_);
         }
+
         /**
-         * @brief Decodes a Base32Hex encoded string into a decoded string. Whitespace and newline characters are not ignored.
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base32Hex::Error
+         * @brief Encodes bytes into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for MaximumEncodedSize(input_.size(), adobeMode_) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded characters with <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of characters written, 0 on error.
         */
-        std::string DecodeStringToString(const std::string& encodedString_)
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const bool foldSpaces_ = false, const bool adobeMode_ = false, const std::size_t threadCount_ = 1) noexcept
         {
-            using Internal::charSize;
-            using Internal::UnreachableTerminate;
+            if(output_.size() < MaximumEncodedSize(input_.size(), adobeMode_)) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
 
-            std::string decodedString;
+                return 0;
+            }
 
-            try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 8.0) * 5.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            errorCode_.clear();
+
+            return Internal::EncodeAscii85InParallel(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), foldSpaces_,
+                                                     adobeMode_, threadCount_);
+        }
+        /**
+         * @brief Decodes Ascii85 characters into a caller-provided buffer. Nothing is allocated and nothing is thrown. Whitespace and newline characters
+         * are ignored.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not the encoded characters are surrounded by <~ and ~> delimiters.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                                  const bool foldSpaces_ = false, const bool adobeMode_ = false, const std::size_t threadCount_ = 1) noexcept
+        {
+            if(output_.size() < MaximumDecodedSize(input_)) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+
+                return 0;
             }
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
+            const Internal::DecodeResult result(
+                Internal::DecodeAscii85InParallel(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), foldSpaces_, adobeMode_,
+                                                  threadCount_));
 
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 5) / 8;
+            if(not result.isValid) {
+                errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
 
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case '0': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
-                            case 'A': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
+                return 0;
+            }
 
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
-                        iter = jter;
+            errorCode_.clear();
 
-                        break;
-                    }
-                }
+            return result.size;
+        }
+        /**
+         * @brief Encodes bytes into a caller-provided buffer, split into lines. Nothing is allocated and nothing is thrown.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for MaximumWrappedEncodedSize(input_.size(), lineWrapping_,
+         * adobeMode_) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] lineWrapping_ Line length and separator.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded characters with <~ and ~> delimiters.
+         * @returns Amount of characters written, 0 on error.
+        */
+        inline std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_,
+                                  const LineWrapping& lineWrapping_, const bool foldSpaces_ = false, const bool adobeMode_ = false) noexcept
+        {
+            if(output_.size() < MaximumWrappedEncodedSize(input_.size(), lineWrapping_, adobeMode_)) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
 
-                switch(loopCounter) {
-                    case 8U: break;
-                    case 7U: {
-                        bitset <<= (charSize * 5) / 8;
+                return 0;
+            }
 
-                        switch(paddingCounter) {
-                            case 5U: paddingCounter = 6U; break;
-                            case 3U: paddingCounter = 4U; break;
-                            case 2U: paddingCounter = 3U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            errorCode_.clear();
 
-                        break;
-                    }
-                    case 6U: {
-                        bitset <<= ((charSize * 5) / 8) * 2;
-
-                        switch(paddingCounter) {
-                            case 4U: paddingCounter = 6U; break;
-                            case 2U: paddingCounter = 4U; break;
-                            case 1U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            return Internal::EncodeAscii85Lines(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data(), foldSpaces_, adobeMode_,
+                                                lineWrapping_);
+        }
+        /**
+         * @brief Decodes Ascii85 characters into a caller-provided buffer, skipping every kind of whitespace anywhere. Nothing is allocated and nothing is
+         * thrown.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not the encoded characters are surrounded by <~ and ~> delimiters.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        inline std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_, IgnoreWhitespace,
+                                  const bool foldSpaces_ = false, const bool adobeMode_ = false) noexcept
+        {
+            if(output_.size() < MaximumDecodedSize(input_)) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
 
-                        break;
-                    }
-                    case 5U: {
-                        bitset <<= ((charSize * 5) / 8) * 3;
-
-                        switch(paddingCounter) {
-                            case 3U: paddingCounter = 6U; break;
-                            case 1U: paddingCounter = 4U; break;
-                            case 0U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                return 0;
+            }
 
-                        break;
-                    }
-                    case 4U: {
-                        bitset <<= ((charSize * 5) / 8) * 4;
+            const Internal::DecodeResult result(Internal::DecodeAscii85IgnoringWhitespace(input_.data(), input_.size(),
+                                                                                          reinterpret_cast<unsigned char*>(output_.data()), foldSpaces_,
+                                                                                          adobeMode_));
 
-                        switch(paddingCounter) {
-                            case 2U: paddingCounter = 6U; break;
-                            case 0U: paddingCounter = 4U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            if(not result.isValid) {
+                errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= ((charSize * 5) / 8) * 5;
+                return 0;
+            }
 
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            errorCode_.clear();
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 5) / 8) * 6;
+            return result.size;
+        }
 
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        /// @brief Encodes Ascii85 piece by piece. Splitting the input at any point gives the same result as encoding it at once.
+        class Encoder
+        {
+        public:
+            /**
+             * @brief Creates an Encoder.
+             * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+             * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+            */
+            explicit Encoder(const bool foldSpaces_ = false, const bool adobeMode_ = false) noexcept :
+                _state(),
+                _foldSpaces(foldSpaces_),
+                _adobeMode(adobeMode_),
+                _isStarted(false)
+            {}
 
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
+            /**
+             * @brief Calculates the maximum amount of characters Update writes.
+             * @param[in] inputSize_ Amount of bytes passed to Update.
+             * @returns Maximum amount of characters written.
+            */
+            static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return (((inputSize_ + 3) / 4) * 5) + 2; }
+            /**
+             * @brief Calculates the maximum amount of characters Finish writes.
+             * @returns Maximum amount of characters written.
+            */
+            static constexpr std::size_t GetMaximumFinishSize() noexcept { return 6; }
+
+            /**
+             * @brief Encodes the next piece of the input. Bytes that do not fill a whole group of 4 are kept until the next call.
+             * @param[in] input_ Bytes to be encoded.
+             * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumUpdateSize(input_.size()) characters.
+             * @returns Amount of characters written.
+             * @throws BinaryText::Ascii85::Error
+            */
+            std::size_t Update(const std::span<const std::byte> input_, const std::span<char> output_)
+            {
+                if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
                 }
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+                const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                    return Internal::EncodeAscii85(bytes_, size_, characters_, _foldSpaces);
+                });
+                const std::size_t written(Start(output_.data()));
 
-                        break;
-                    }
-                    case 1U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                return written + Internal::UpdateGroupEncoder(_state, reinterpret_cast<const unsigned char*>(input_.data()), input_.size(),
+                                                              output_.data() + written, encode);
+            }
+            /**
+             * @brief Encodes the kept bytes and adds the ~> delimiter in adobe mode. The Encoder can be used for a new input afterwards.
+             * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumFinishSize() characters.
+             * @returns Amount of characters written.
+             * @throws BinaryText::Ascii85::Error
+            */
+            std::size_t Finish(const std::span<char> output_)
+            {
+                if(output_.size() < GetMaximumFinishSize()) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                }
 
-                        break;
-                    }
-                    case 3U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                const auto encode([this](const unsigned char* bytes_, const std::size_t size_, char* characters_) noexcept {
+                    return Internal::EncodeAscii85(bytes_, size_, characters_, _foldSpaces);
+                });
+                std::size_t written(Start(output_.data()));
 
-                        break;
-                    }
-                    case 4U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                written += Internal::FinishGroupEncoder(_state, output_.data() + written, encode);
 
-                        break;
-                    }
-                    case 6U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()))); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                if(_adobeMode) {
+                    std::memcpy(output_.data() + written, "~>", 2);
+                    written += 2;
                 }
 
-                if(paddingCounter > 0U) {
-                    break;
+                _isStarted = false;
+
+                return written;
+            }
+            /// @brief Discards the kept bytes.
+            void Reset() noexcept
+            {
+                _state = Internal::GroupEncodeState<4>();
+                _isStarted = false;
+            }
+
+        private:
+            Internal::GroupEncodeState<4> _state;
+            bool _foldSpaces;
+            bool _adobeMode;
+            bool _isStarted;
+
+            /**
+             * @brief Writes the <~ delimiter in adobe mode, if it has not been written yet.
+             * @param[out] output_ Where the delimiter is written to.
+             * @returns Amount of characters written.
+            */
+            std::size_t Start(char* output_) noexcept
+            {
+                if(_isStarted or not _adobeMode) {
+                    _isStarted = true;
+
+                    return 0;
                 }
+
+                std::memcpy(output_, "<~", 2);
+                _isStarted = true;
+
+                return 2;
             }
+        };
 
-            return decodedString;
-        }
         /**
-         * @brief Decodes a Base32Hex encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * Encodes several ByteBufferViews one after another into an Ascii85 encoded string, as if they were one ByteBuffer. A message made of several
+         * parts, such as a header and a Subview of a big payload, is encoded this way without concatenating the parts first.
+         *
          * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base32Hex::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @param[in] byteBufferViews_ ByteBufferViews to be encoded, in order.
+         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+         * @throws BinaryText::Ascii85::Error
         */
         template<typename ByteType>
             requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_)
+        std::string EncodeByteBufferViewsToString(const std::span<const ByteBufferView<ByteType>> byteBufferViews_, const bool foldSpaces_ = false,
+                                                  const bool adobeMode_ = false)
         {
-            using Internal::charSize;
+            Encoder encoder(foldSpaces_, adobeMode_);
 
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
-            auto addToByteBuffer = [&decodedByteBuffer, &byteBuffer, &bufferIterator](const unsigned char byte_) -> void {
-                if(bufferIterator < 8192) {
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
+            return Internal::EncodeByteBufferViews<Error>(encoder, byteBufferViews_);
+        }
 
-                    bufferIterator += 1;
-                } else {
-                    decodedByteBuffer += byteBuffer;
-                    bufferIterator = 0;
+        /**
+         * Decodes Ascii85 piece by piece. Splitting the input at any point gives the same result as decoding it at once. Whitespace and newline characters
+         * are ignored.
+        */
+        class Decoder
+        {
+        public:
+            /**
+             * @brief Creates a Decoder.
+             * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+             * @param[in] adobeMode_ Whether or not the encoded input is surrounded by <~ and ~> delimiters.
+            */
+            explicit Decoder(const bool foldSpaces_ = false, const bool adobeMode_ = false) noexcept :
+                _state(adobeMode_),
+                _foldSpaces(foldSpaces_)
+            {}
 
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
+            /**
+             * @brief Calculates the maximum amount of bytes Update writes. Every z and y can turn into 4 bytes.
+             * @param[in] inputSize_ Amount of characters passed to Update.
+             * @returns Maximum amount of bytes written.
+            */
+            static constexpr std::size_t GetMaximumUpdateSize(const std::size_t inputSize_) noexcept { return inputSize_ * 4; }
+            /**
+             * @brief Calculates the maximum amount of bytes Finish writes.
+             * @returns Maximum amount of bytes written.
+            */
+            static constexpr std::size_t GetMaximumFinishSize() noexcept { return 3; }
 
-                    bufferIterator += 1;
+            /**
+             * Decodes the next piece of the input. Characters that do not fill a whole group of 5 are kept until the next call. After an Error the Decoder
+             * has to be Reset before it can be used again.
+             *
+             * @param[in] input_ Characters to be decoded.
+             * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumUpdateSize(input_.size()) bytes.
+             * @returns Amount of bytes written.
+             * @throws BinaryText::Ascii85::Error
+            */
+            std::size_t Update(const std::string_view input_, const std::span<std::byte> output_)
+            {
+                if(output_.size() < GetMaximumUpdateSize(input_.size())) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
                 }
-            };
-
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 5> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 5) / 8;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case '0': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
-                            case 'A': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
 
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
-                        iter = jter;
+                Statistics::StageTimer timer(Statistics::Stage::DECODE, input_.size());
+                const Internal::DecodeResult result(timer.CountOutput(
+                    Internal::DecodeAscii85(input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), _foldSpaces, _state)));
 
-                        break;
-                    }
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
                 }
 
-                switch(loopCounter) {
-                    case 8U: break;
-                    case 7U: {
-                        bitset <<= (charSize * 5) / 8;
-
-                        switch(paddingCounter) {
-                            case 5U: paddingCounter = 6U; break;
-                            case 3U: paddingCounter = 4U; break;
-                            case 2U: paddingCounter = 3U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 6U: {
-                        bitset <<= ((charSize * 5) / 8) * 2;
-
-                        switch(paddingCounter) {
-                            case 4U: paddingCounter = 6U; break;
-                            case 2U: paddingCounter = 4U; break;
-                            case 1U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                return result.size;
+            }
+            /**
+             * Decodes the kept characters as the last, incomplete group. In adobe mode the ~> delimiter has to have been seen. The Decoder can be used for a
+             * new input afterwards.
+             *
+             * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumFinishSize() bytes.
+             * @returns Amount of bytes written.
+             * @throws BinaryText::Ascii85::Error
+            */
+            std::size_t Finish(const std::span<std::byte> output_)
+            {
+                if(output_.size() < GetMaximumFinishSize()) {
+                    throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+                }
 
-                        break;
-                    }
-                    case 5U: {
-                        bitset <<= ((charSize * 5) / 8) * 3;
-
-                        switch(paddingCounter) {
-                            case 3U: paddingCounter = 6U; break;
-                            case 1U: paddingCounter = 4U; break;
-                            case 0U: paddingCounter = 3U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                Statistics::StageTimer timer(Statistics::Stage::DECODE);
+                const Internal::DecodeResult result(timer.CountOutput(Internal::FinishAscii85(reinterpret_cast<unsigned char*>(output_.data()), _state)));
 
-                        break;
-                    }
-                    case 4U: {
-                        bitset <<= ((charSize * 5) / 8) * 4;
+                Reset();
 
-                        switch(paddingCounter) {
-                            case 2U: paddingCounter = 6U; break;
-                            case 0U: paddingCounter = 4U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                if(not result.isValid) {
+                    throw Error(Error::Type::STRING_PARSE_ERROR);
+                }
 
-                        break;
-                    }
-                    case 3U: {
-                        bitset <<= ((charSize * 5) / 8) * 5;
+                return result.size;
+            }
+            /// @brief Discards the kept characters.
+            void Reset() noexcept { _state = Internal::Ascii85DecodeState(_state.isAdobeMode); }
 
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+        private:
+            Internal::Ascii85DecodeState _state;
+            bool _foldSpaces;
+        };
+    };
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 5) / 8) * 6;
+    /**
+     * @brief A concept that only accepts the Decoder classes of the codec namespaces, or classes that decode piece by piece the same way.
+     * @tparam DecoderType Class such as BinaryText::Base64::Decoder.
+    */
+    template<typename DecoderType>
+    concept PieceDecoder = requires(DecoderType decoder_, const std::string_view input_, const std::span<std::byte> output_) {
+        { DecoderType::GetMaximumUpdateSize(input_.size()) } -> std::same_as<std::size_t>;
+        { DecoderType::GetMaximumFinishSize() } -> std::same_as<std::size_t>;
+        { decoder_.Update(input_, output_) } -> std::same_as<std::size_t>;
+        { decoder_.Finish(output_) } -> std::same_as<std::size_t>;
+        decoder_.Reset();
+    };
 
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 6U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+    /**
+     * @brief A concept that only accepts the Encoder classes of the codec namespaces, or classes that encode piece by piece the same way.
+     * @tparam EncoderType Class such as BinaryText::Ascii85::Encoder.
+    */
+    template<typename EncoderType>
+    concept PieceEncoder = requires(EncoderType encoder_, const std::span<const std::byte> input_, const std::span<char> output_) {
+        { EncoderType::GetMaximumUpdateSize(input_.size()) } -> std::same_as<std::size_t>;
+        { EncoderType::GetMaximumFinishSize() } -> std::same_as<std::size_t>;
+        { encoder_.Update(input_, output_) } -> std::same_as<std::size_t>;
+        { encoder_.Finish(output_) } -> std::same_as<std::size_t>;
+        encoder_.Reset();
+    };
 
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
-                }
+    namespace Internal
+    {
+        /// @brief Amount of decoded bytes a Transcoder holds between its Decoder and its Encoder, small enough to stay in the L1 cache.
+        constexpr std::size_t transcodeBlockSize = 4096;
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>(bitset.to_ullong()));
+        /**
+         * @brief Calculates the largest amount of characters a Decoder can be given at once so that its bytes fit into a block of transcodeBlockSize.
+         * @tparam DecoderType Type that satisfies the PieceDecoder concept.
+         * @returns Amount of characters.
+        */
+        template<typename DecoderType>
+        consteval std::size_t GetTranscodeInputSize()
+        {
+            std::size_t size(transcodeBlockSize);
 
-                        break;
-                    }
-                    case 1U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
+            while(std::max(DecoderType::GetMaximumUpdateSize(size), DecoderType::GetMaximumFinishSize()) > transcodeBlockSize) {
+                size -= 1;
+            }
 
-                        break;
-                    }
-                    case 3U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
+            return size;
+        }
+    }
 
-                        break;
-                    }
-                    case 4U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
+    /**
+     * Converts characters of one encoding directly into characters of another encoding, piece by piece, without holding all of the decoded bytes. The
+     * input is decoded a few kilobytes at a time into a block that stays in the L1 cache and every block is encoded right away. Groups that are cut at
+     * the end of a block or a piece are kept by the Decoder and the Encoder, so splitting the input at any point gives the same result.
+     *
+     * @tparam DecoderType Type that satisfies the PieceDecoder concept, it decodes the input.
+     * @tparam EncoderType Type that satisfies the PieceEncoder concept, it encodes the output.
+    */
+    template<PieceDecoder DecoderType, PieceEncoder EncoderType>
+    class Transcoder
+    {
+    public:
+        /**
+         * @brief Creates a Transcoder.
+         * @param[in] decoder_ Decoder that decodes the input, with the options of the input encoding.
+         * @param[in] encoder_ Encoder that encodes the output, with the options of the output encoding.
+        */
+        explicit Transcoder(const DecoderType& decoder_ = DecoderType(), const EncoderType& encoder_ = EncoderType()) :
+            _decoder(decoder_),
+            _encoder(encoder_),
+            _block()
+        {}
 
-                        break;
-                    }
-                    case 6U: addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
+        /**
+         * Converts the next piece of the input and appends the result to a string. After an Error the Transcoder has to be Reset before it can be used
+         * again.
+         *
+         * @param[in] input_ Characters to be converted, they must not be part of output_.
+         * @param[in,out] output_ String the converted characters are appended to.
+         * @throws The Error classes of the codec namespaces of DecoderType and EncoderType
+         * @throws std::length_error
+        */
+        void Update(const std::string_view input_, std::string& output_)
+        {
+            constexpr std::size_t inputSize(Internal::GetTranscodeInputSize<DecoderType>());
 
-                if(paddingCounter > 0U) {
-                    break;
-                }
+            for(std::size_t i(0); i < input_.size(); i += inputSize) {
+                Encode(_decoder.Update(input_.substr(i, inputSize), _block), output_);
             }
+        }
+        /**
+         * @brief Converts what the Decoder and the Encoder kept and appends it to a string. The Transcoder can be used for a new input afterwards.
+         * @param[in,out] output_ String the converted characters are appended to.
+         * @throws The Error classes of the codec namespaces of DecoderType and EncoderType
+         * @throws std::length_error
+        */
+        void Finish(std::string& output_)
+        {
+            Encode(_decoder.Finish(_block), output_);
 
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+            const std::size_t size(output_.size());
 
-                decodedByteBuffer += byteBuffer;
-            }
+            output_.resize(size + EncoderType::GetMaximumFinishSize());
+            output_.resize(size + _encoder.Finish(std::span<char>(output_).subspan(size)));
+        }
+        /// @brief Discards what the Decoder and the Encoder kept.
+        void Reset() noexcept
+        {
+            _decoder.Reset();
+            _encoder.Reset();
+        }
 
-            return decodedByteBuffer;
+    private:
+        /**
+         * @brief Encodes the first bytes of the block and appends the characters to a string.
+         * @param[in] blockSize_ Amount of bytes in the block.
+         * @param[in,out] output_ String the encoded characters are appended to.
+        */
+        void Encode(const std::size_t blockSize_, std::string& output_)
+        {
+            const std::size_t size(output_.size());
+
+            output_.resize(size + EncoderType::GetMaximumUpdateSize(blockSize_));
+            output_.resize(size + _encoder.Update(std::span<const std::byte>(_block).first(blockSize_), std::span<char>(output_).subspan(size)));
         }
+
+        DecoderType _decoder;
+        EncoderType _encoder;
+        std::array<std::byte, Internal::transcodeBlockSize> _block;
     };
 
-    /// @brief A namespace that has functions that implement Base64 encoding and decoding in accordance to RFC 4648 §4.
-    namespace Base64
+    /**
+     * Converts characters of one encoding into characters of another encoding, for example Ascii85 into Base64, without decoding the whole input into
+     * a ByteBuffer first. See Transcoder for how the work is split up.
+     *
+     * @tparam DecoderType Type that satisfies the PieceDecoder concept, it decodes the input.
+     * @tparam EncoderType Type that satisfies the PieceEncoder concept, it encodes the output.
+     * @param[in] encodedString_ String to be converted.
+     * @param[in] decoder_ Decoder that decodes the input, with the options of the input encoding.
+     * @param[in] encoder_ Encoder that encodes the output, with the options of the output encoding.
+     * @returns Converted string.
+     * @throws The Error classes of the codec namespaces of DecoderType and EncoderType
+     * @throws std::length_error
+    */
+    template<PieceDecoder DecoderType, PieceEncoder EncoderType>
+    std::string Transcode(const std::string_view encodedString_, const DecoderType& decoder_ = DecoderType(), const EncoderType& encoder_ = EncoderType())
     {
-        /// @brief A simple error class for the Base64 namespace.
+        Transcoder<DecoderType, EncoderType> transcoder(decoder_, encoder_);
+        std::string transcodedString;
+
+        transcoder.Update(encodedString_, transcodedString);
+        transcoder.Finish(transcodedString);
+
+        return transcodedString;
+    }
+
+    /**
+     * A namespace that has functions that encode and decode files block by block with the Encoder and Decoder classes, so that files of any size (larger
+     * than memory, a std::string or a ByteBuffer can hold) are processed in constant memory. The sizes are counted in std::uint64_t and can be checked
+     * against the EncodedFileSize functions of the codec namespaces.
+    */
+    namespace Files
+    {
+        /// @brief A simple error class for the Files namespace.
         class Error : public std::exception
         {
         public:
             /// @brief The type of Error.
             enum class Type
             {
-                INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
+                INVALID_ARGUMENTS_ERROR, ///< Invalid arguments.
+                OPEN_FILE_ERROR,         ///< Failed to open the file.
+                READ_FROM_FILE_ERROR,    ///< Failed to read from file.
+                WRITE_TO_FILE_ERROR      ///< Failed to write to file.
             };
 
             /**
@@ -3350,8 +9689,10 @@ namespace BinaryText
                 _sourceLocation(sourceLocation_)
             {
                 switch(_type) {
-                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
-                    case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                    case Type::INVALID_ARGUMENTS_ERROR: _what = "Invalid arguments"; break;
+                    case Type::OPEN_FILE_ERROR: _what = "Failed to open file"; break;
+                    case Type::READ_FROM_FILE_ERROR: _what = "Failed to read from file"; break;
+                    case Type::WRITE_TO_FILE_ERROR: _what = "Failed to write to file"; break;
                     default: _what = "Invalid error type"; break;
                 }
             }
@@ -3382,644 +9723,193 @@ namespace BinaryText
             std::string _what;
         };
 
-        static_assert(Internal::charSize == 8, "These Base64 functions only works if a char is 8 bits big");
-
-        /**
-         * @brief Encodes a not-encoded string into a Base64 encoded string.
-         * @param[in] string_ String to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base64::Error
-        */
-        std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+        /// @brief Amount of bytes or characters that went into and came out of EncodeFile or DecodeFile.
+        struct Sizes
         {
-            using Internal::charSize;
-
-            std::string encodedString;
-
-            try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(string_.size())) / 3.0) * 4.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
-
-            for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int counter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 3)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(counter) {
-                    case 3U: counter = 4U; break;
-                    case 2U: {
-                        bitset <<= charSize;
-                        counter = 3U;
-
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= charSize * 2;
-                        counter = 2U;
-
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
-                }
+            std::uint64_t inputSize = 0;  ///< Bytes or characters read from the input file.
+            std::uint64_t outputSize = 0; ///< Characters or bytes written to the output file.
+        };
 
-                for(unsigned int i(1U); i < 5U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B000000ULL: encodedString.append(1, 'A'); break;
-                            case 0B000001ULL: encodedString.append(1, 'B'); break;
-                            case 0B000010ULL: encodedString.append(1, 'C'); break;
-                            case 0B000011ULL: encodedString.append(1, 'D'); break;
-                            case 0B000100ULL: encodedString.append(1, 'E'); break;
-                            case 0B000101ULL: encodedString.append(1, 'F'); break;
-                            case 0B000110ULL: encodedString.append(1, 'G'); break;
-                            case 0B000111ULL: encodedString.append(1, 'H'); break;
-                            case 0B001000ULL: encodedString.append(1, 'I'); break;
-                            case 0B001001ULL: encodedString.append(1, 'J'); break;
-                            case 0B001010ULL: encodedString.append(1, 'K'); break;
-                            case 0B001011ULL: encodedString.append(1, 'L'); break;
-                            case 0B001100ULL: encodedString.append(1, 'M'); break;
-                            case 0B001101ULL: encodedString.append(1, 'N'); break;
-                            case 0B001110ULL: encodedString.append(1, 'O'); break;
-                            case 0B001111ULL: encodedString.append(1, 'P'); break;
-                            case 0B010000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B010001ULL: encodedString.append(1, 'R'); break;
-                            case 0B010010ULL: encodedString.append(1, 'S'); break;
-                            case 0B010011ULL: encodedString.append(1, 'T'); break;
-                            case 0B010100ULL: encodedString.append(1, 'U'); break;
-                            case 0B010101ULL: encodedString.append(1, 'V'); break;
-                            case 0B010110ULL: encodedString.append(1, 'W'); break;
-                            case 0B010111ULL: encodedString.append(1, 'X'); break;
-                            case 0B011000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B011001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B011010ULL: encodedString.append(1, 'a'); break;
-                            case 0B011011ULL: encodedString.append(1, 'b'); break;
-                            case 0B011100ULL: encodedString.append(1, 'c'); break;
-                            case 0B011101ULL: encodedString.append(1, 'd'); break;
-                            case 0B011110ULL: encodedString.append(1, 'e'); break;
-                            case 0B011111ULL: encodedString.append(1, 'f'); break;
-                            case 0B100000ULL: encodedString.append(1, 'g'); break;
-                            case 0B100001ULL: encodedString.append(1, 'h'); break;
-                            case 0B100010ULL: encodedString.append(1, 'i'); break;
-                            case 0B100011ULL: encodedString.append(1, 'j'); break;
-                            case 0B100100ULL: encodedString.append(1, 'k'); break;
-                            case 0B100101ULL: encodedString.append(1, 'l'); break;
-                            case 0B100110ULL: encodedString.append(1, 'm'); break;
-                            case 0B100111ULL: encodedString.append(1, 'n'); break;
-                            case 0B101000ULL: encodedString.append(1, 'o'); break;
-                            case 0B101001ULL: encodedString.append(1, 'p'); break;
-                            case 0B101010ULL: encodedString.append(1, 'q'); break;
-                            case 0B101011ULL: encodedString.append(1, 'r'); break;
-                            case 0B101100ULL: encodedString.append(1, 's'); break;
-                            case 0B101101ULL: encodedString.append(1, 't'); break;
-                            case 0B101110ULL: encodedString.append(1, 'u'); break;
-                            case 0B101111ULL: encodedString.append(1, 'v'); break;
-                            case 0B110000ULL: encodedString.append(1, 'w'); break;
-                            case 0B110001ULL: encodedString.append(1, 'x'); break;
-                            case 0B110010ULL: encodedString.append(1, 'y'); break;
-                            case 0B110011ULL: encodedString.append(1, 'z'); break;
-                            case 0B110100ULL: encodedString.append(1, '0'); break;
-                            case 0B110101ULL: encodedString.append(1, '1'); break;
-                            case 0B110110ULL: encodedString.append(1, '2'); break;
-                            case 0B110111ULL: encodedString.append(1, '3'); break;
-                            case 0B111000ULL: encodedString.append(1, '4'); break;
-                            case 0B111001ULL: encodedString.append(1, '5'); break;
-                            case 0B111010ULL: encodedString.append(1, '6'); break;
-                            case 0B111011ULL: encodedString.append(1, '7'); break;
-                            case 0B111100ULL: encodedString.append(1, '8'); break;
-                            case 0B111101ULL: encodedString.append(1, '9'); break;
-                            case 0B111110ULL: encodedString.append(1, '+'); break;
-                            case 0B111111ULL: encodedString.append(1, '/'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
-            }
+        /// @brief Amount of bytes or characters read from the input file at a time by default, 1 MiB.
+        constexpr std::size_t defaultBlockSize = 1048576;
+    }
 
-            return encodedString;
-        }
+    namespace Internal
+    {
         /**
-         * @brief Encodes a ByteBuffer into a Base64 encoded string.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base64::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * Reads a file block by block, passes every block to a function that converts it into a buffer of its own and writes the buffer into
+         * another file. Only the two buffers are held in memory, so the size of the files does not matter.
+         *
+         * @param[in] inputFilePath_ Path to the file to be read.
+         * @param[in] outputFilePath_ Path to the file to be written, it is replaced.
+         * @param[in] blockSize_ Amount of bytes read at a time.
+         * @param[in] outputBlockSize_ Amount of bytes update_ and finish_ can write at most.
+         * @param[in] update_ Function that converts a block (std::string_view) into an std::span<char> and returns the amount written.
+         * @param[in] finish_ Function that writes what is left into an std::span<char> and returns the amount written.
+         * @returns Amount of bytes read and written.
+         * @throws BinaryText::Files::Error
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true)
+        template<typename UpdateType, typename FinishType>
+        Files::Sizes ProcessFile(const std::filesystem::path& inputFilePath_, const std::filesystem::path& outputFilePath_, const std::size_t blockSize_,
+                                 const std::size_t outputBlockSize_, UpdateType&& update_, FinishType&& finish_)
         {
-            using Internal::charSize;
-
-            std::string encodedString;
-
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(byteBuffer_.GetSize())) / 3.0) * 4.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            if(blockSize_ == 0 or blockSize_ > static_cast<std::size_t>(std::numeric_limits<std::streamsize>::max())) {
+                throw Files::Error(Files::Error::Type::INVALID_ARGUMENTS_ERROR);
             }
 
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int counter(0U);
-
-                for(typename ByteBuffer<ByteType>::ConstantIterator jter(iter); jter != byteBuffer_.ConstantEnd(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == byteBuffer_.ConstantEnd() or std::next(jter, 1) == std::next(iter, 3)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(counter) {
-                    case 3U: counter = 4U; break;
-                    case 2U: {
-                        bitset <<= charSize;
-                        counter = 3U;
-
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= charSize * 2;
-                        counter = 2U;
-
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
-                }
+            std::ifstream inputStream(inputFilePath_, std::ifstream::in | std::ifstream::binary);
 
-                for(unsigned int i(1U); i < 5U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B000000ULL: encodedString.append(1, 'A'); break;
-                            case 0B000001ULL: encodedString.append(1, 'B'); break;
-                            case 0B000010ULL: encodedString.append(1, 'C'); break;
-                            case 0B000011ULL: encodedString.append(1, 'D'); break;
-                            case 0B000100ULL: encodedString.append(1, 'E'); break;
-                            case 0B000101ULL: encodedString.append(1, 'F'); break;
-                            case 0B000110ULL: encodedString.append(1, 'G'); break;
-                            case 0B000111ULL: encodedString.append(1, 'H'); break;
-                            case 0B001000ULL: encodedString.append(1, 'I'); break;
-                            case 0B001001ULL: encodedString.append(1, 'J'); break;
-                            case 0B001010ULL: encodedString.append(1, 'K'); break;
-                            case 0B001011ULL: encodedString.append(1, 'L'); break;
-                            case 0B001100ULL: encodedString.append(1, 'M'); break;
-                            case 0B001101ULL: encodedString.append(1, 'N'); break;
-                            case 0B001110ULL: encodedString.append(1, 'O'); break;
-                            case 0B001111ULL: encodedString.append(1, 'P'); break;
-                            case 0B010000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B010001ULL: encodedString.append(1, 'R'); break;
-                            case 0B010010ULL: encodedString.append(1, 'S'); break;
-                            case 0B010011ULL: encodedString.append(1, 'T'); break;
-                            case 0B010100ULL: encodedString.append(1, 'U'); break;
-                            case 0B010101ULL: encodedString.append(1, 'V'); break;
-                            case 0B010110ULL: encodedString.append(1, 'W'); break;
-                            case 0B010111ULL: encodedString.append(1, 'X'); break;
-                            case 0B011000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B011001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B011010ULL: encodedString.append(1, 'a'); break;
-                            case 0B011011ULL: encodedString.append(1, 'b'); break;
-                            case 0B011100ULL: encodedString.append(1, 'c'); break;
-                            case 0B011101ULL: encodedString.append(1, 'd'); break;
-                            case 0B011110ULL: encodedString.append(1, 'e'); break;
-                            case 0B011111ULL: encodedString.append(1, 'f'); break;
-                            case 0B100000ULL: encodedString.append(1, 'g'); break;
-                            case 0B100001ULL: encodedString.append(1, 'h'); break;
-                            case 0B100010ULL: encodedString.append(1, 'i'); break;
-                            case 0B100011ULL: encodedString.append(1, 'j'); break;
-                            case 0B100100ULL: encodedString.append(1, 'k'); break;
-                            case 0B100101ULL: encodedString.append(1, 'l'); break;
-                            case 0B100110ULL: encodedString.append(1, 'm'); break;
-                            case 0B100111ULL: encodedString.append(1, 'n'); break;
-                            case 0B101000ULL: encodedString.append(1, 'o'); break;
-                            case 0B101001ULL: encodedString.append(1, 'p'); break;
-                            case 0B101010ULL: encodedString.append(1, 'q'); break;
-                            case 0B101011ULL: encodedString.append(1, 'r'); break;
-                            case 0B101100ULL: encodedString.append(1, 's'); break;
-                            case 0B101101ULL: encodedString.append(1, 't'); break;
-                            case 0B101110ULL: encodedString.append(1, 'u'); break;
-                            case 0B101111ULL: encodedString.append(1, 'v'); break;
-                            case 0B110000ULL: encodedString.append(1, 'w'); break;
-                            case 0B110001ULL: encodedString.append(1, 'x'); break;
-                            case 0B110010ULL: encodedString.append(1, 'y'); break;
-                            case 0B110011ULL: encodedString.append(1, 'z'); break;
-                            case 0B110100ULL: encodedString.append(1, '0'); break;
-                            case 0B110101ULL: encodedString.append(1, '1'); break;
-                            case 0B110110ULL: encodedString.append(1, '2'); break;
-                            case 0B110111ULL: encodedString.append(1, '3'); break;
-                            case 0B111000ULL: encodedString.append(1, '4'); break;
-                            case 0B111001ULL: encodedString.append(1, '5'); break;
-                            case 0B111010ULL: encodedString.append(1, '6'); break;
-                            case 0B111011ULL: encodedString.append(1, '7'); break;
-                            case 0B111100ULL: encodedString.append(1, '8'); break;
-                            case 0B111101ULL: encodedString.append(1, '9'); break;
-                            case 0B111110ULL: encodedString.append(1, '+'); break;
-                            case 0B111111ULL: encodedString.append(1, '/'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
+            if(not inputStream.is_open()) {
+                throw Files::Error(Files::Error::Type::OPEN_FILE_ERROR);
             }
 
-            return encodedString;
-        }
-        /**
-         * @brief Decodes a Base64 encoded string into a decoded string. Whitespace and newline characters are not ignored.
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base64::Error
-        */
-        std::string DecodeStringToString(const std::string& encodedString_)
-        {
-            using Internal::charSize;
-
-            std::string decodedString;
+            std::ofstream outputStream(outputFilePath_, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
 
-            try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(encodedString_.size())) / 4.0) * 3.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            if(not outputStream.is_open()) {
+                throw Files::Error(Files::Error::Type::OPEN_FILE_ERROR);
             }
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 3) / 4;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
-                            case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
-                            case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
-                            case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
-                            case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
-                            case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
-                            case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
-                            case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
-                            case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
-                            case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
-                            case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
-                            case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
-                            case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
-                            case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
-                            case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
-                            case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
-                            case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
-                            case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
-                            case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
-                            case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
-                            case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
-                            case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
-                            case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
-                            case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
-                            case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
-                            case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
-                            case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
-                            case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
-                            case '+': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
-                            case '/': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
+            std::vector<char> inputBlock(blockSize_);
+            std::vector<char> outputBlock(outputBlockSize_);
+            Files::Sizes sizes;
+            const auto write([&outputStream, &outputBlock, &sizes](const std::size_t size_) {
+                Statistics::StageTimer timer(Statistics::Stage::WRITE, size_);
 
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
-                        iter = jter;
+                outputStream.write(outputBlock.data(), static_cast<std::streamsize>(size_));
 
-                        break;
-                    }
+                if(outputStream.fail()) {
+                    throw Files::Error(Files::Error::Type::WRITE_TO_FILE_ERROR);
                 }
 
-                switch(loopCounter) {
-                    case 4U: break;
-                    case 3U: {
-                        bitset <<= (charSize * 3) / 4;
+                sizes.outputSize += size_;
+            });
 
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 2U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            while(inputStream) {
+                std::size_t size(0);
 
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 3) / 4) * 2;
+                {
+                    Statistics::StageTimer timer(Statistics::Stage::READ);
 
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 2U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+                    inputStream.read(inputBlock.data(), static_cast<std::streamsize>(blockSize_));
 
-                        break;
+                    if(inputStream.fail() and not inputStream.eof()) {
+                        throw Files::Error(Files::Error::Type::READ_FROM_FILE_ERROR);
                     }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
-                }
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+                    size = static_cast<std::size_t>(inputStream.gcount());
+                    timer.AddInputSize(size);
+                }
 
-                        break;
-                    }
-                    case 1U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                sizes.inputSize += size;
+                write(update_(std::string_view(inputBlock.data(), size), std::span<char>(outputBlock)));
+            }
 
-                        break;
-                    }
-                    case 2U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()))); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
+            write(finish_(std::span<char>(outputBlock)));
+            outputStream.flush();
 
-                if(paddingCounter > 0U) {
-                    break;
-                }
+            if(outputStream.fail()) {
+                throw Files::Error(Files::Error::Type::WRITE_TO_FILE_ERROR);
             }
 
-            return decodedString;
+            return sizes;
+        }
+    }
+
+    namespace Files
+    {
+        /**
+         * Encodes a file into another file with an Encoder, one block at a time, in constant memory. For a file that fits into an std::uint64_t the
+         * returned outputSize equals the EncodedFileSize of its inputSize (Ascii85: at most MaximumEncodedFileSize).
+         *
+         * @tparam EncoderType Type that satisfies the PieceEncoder concept, such as BinaryText::Base64::Encoder.
+         * @param[in] inputFilePath_ Path to the file to be encoded.
+         * @param[in] outputFilePath_ Path to the file the encoded characters are written to, it is replaced.
+         * @param[in] encoder_ Encoder with the options of the encoding.
+         * @param[in] blockSize_ Amount of bytes encoded at a time.
+         * @returns Amount of bytes read and characters written.
+         * @throws BinaryText::Files::Error
+         * @throws The Error class of the codec namespace of EncoderType
+        */
+        template<PieceEncoder EncoderType>
+        Sizes EncodeFile(const std::filesystem::path& inputFilePath_, const std::filesystem::path& outputFilePath_, EncoderType encoder_ = EncoderType(),
+                         const std::size_t blockSize_ = defaultBlockSize)
+        {
+            const std::size_t outputBlockSize(std::max(EncoderType::GetMaximumUpdateSize(blockSize_), EncoderType::GetMaximumFinishSize()));
+
+            return Internal::ProcessFile(
+                inputFilePath_, outputFilePath_, blockSize_, outputBlockSize,
+                [&encoder_](const std::string_view block_, const std::span<char> output_) {
+                    return encoder_.Update(std::as_bytes(std::span(block_)), output_);
+                },
+                [&encoder_](const std::span<char> output_) { return encoder_.Finish(output_); });
         }
         /**
-         * @brief Decodes a Base64 encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base64::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * Decodes a file into another file with a Decoder, one block at a time, in constant memory. The returned outputSize is at most the
+         * MaximumDecodedFileSize of its inputSize. If an Error is thrown the output file holds what was decoded until then.
+         *
+         * @tparam DecoderType Type that satisfies the PieceDecoder concept, such as BinaryText::Base64::Decoder.
+         * @param[in] inputFilePath_ Path to the file to be decoded.
+         * @param[in] outputFilePath_ Path to the file the decoded bytes are written to, it is replaced.
+         * @param[in] decoder_ Decoder with the options of the encoding.
+         * @param[in] blockSize_ Amount of characters decoded at a time.
+         * @returns Amount of characters read and bytes written.
+         * @throws BinaryText::Files::Error
+         * @throws The Error class of the codec namespace of DecoderType
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_)
+        template<PieceDecoder DecoderType>
+        Sizes DecodeFile(const std::filesystem::path& inputFilePath_, const std::filesystem::path& outputFilePath_, DecoderType decoder_ = DecoderType(),
+                         const std::size_t blockSize_ = defaultBlockSize)
         {
-            using Internal::charSize;
-
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
-            auto addToByteBuffer = [&decodedByteBuffer, &byteBuffer, &bufferIterator](const unsigned char byte_) -> void {
-                if(bufferIterator < 8192) {
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
-
-                    bufferIterator += 1;
-                } else {
-                    decodedByteBuffer += byteBuffer;
-                    bufferIterator = 0;
-
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
-
-                    bufferIterator += 1;
-                }
-            };
-
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 3) / 4;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
-                            case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
-                            case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
-                            case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
-                            case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
-                            case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
-                            case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
-                            case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
-                            case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
-                            case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
-                            case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
-                            case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
-                            case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
-                            case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
-                            case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
-                            case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
-                            case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
-                            case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
-                            case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
-                            case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
-                            case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
-                            case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
-                            case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
-                            case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
-                            case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
-                            case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
-                            case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
-                            case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
-                            case '+': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
-                            case '/': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
-
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(loopCounter) {
-                    case 4U: break;
-                    case 3U: {
-                        bitset <<= (charSize * 3) / 4;
-
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 2U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= ((charSize * 3) / 4) * 2;
-
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 2U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
-                }
-
-                switch(paddingCounter) {
-                    case 0U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>(bitset.to_ullong()));
+            const std::size_t outputBlockSize(std::max(DecoderType::GetMaximumUpdateSize(blockSize_), DecoderType::GetMaximumFinishSize()));
 
-                        break;
-                    }
-                    case 1U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-
-                        break;
-                    }
-                    case 2U: addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
-
-                if(paddingCounter > 0U) {
-                    break;
-                }
-            }
-
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+            return Internal::ProcessFile(
+                inputFilePath_, outputFilePath_, blockSize_, outputBlockSize,
+                [&decoder_](const std::string_view block_, const std::span<char> output_) { return decoder_.Update(block_, std::as_writable_bytes(output_)); },
+                [&decoder_](const std::span<char> output_) { return decoder_.Finish(std::as_writable_bytes(output_)); });
+        }
+    }
 
-                decodedByteBuffer += byteBuffer;
-            }
+    /// @brief Algorithms a Codec can be configured with.
+    enum class Algorithm
+    {
+        BASE_16,     ///< Base16, see the Base16 namespace.
+        BASE_32,     ///< Base32, see the Base32 namespace.
+        BASE_32_HEX, ///< Base32Hex, see the Base32Hex namespace.
+        BASE_64,     ///< Base64, see the Base64 namespace.
+        BASE_64_URL, ///< Base64Url, see the Base64Url namespace.
+        ASCII_85     ///< Ascii85, see the Ascii85 namespace.
+    };
 
-            return decodedByteBuffer;
-        }
+    /// @brief Options of a Codec. Every Algorithm only looks at the options that it has.
+    struct CodecOptions
+    {
+        Base16::Case encodeCase = Base16::Case::UPPERCASE; ///< Case Base16 is encoded in (mixed case not supported).
+        Base16::Case decodeCase = Base16::Case::MIXED;     ///< Case Base16 is decoded in.
+        bool withPadding = true;                           ///< Whether or not Base32, Base32Hex, Base64 and Base64Url are encoded with padding.
+        bool foldSpaces = false;                           ///< Whether or not Ascii85 folds 4 spaces into y.
+        bool adobeMode = false;                            ///< Whether or not Ascii85 is surrounded with <~ and ~> delimiters.
     };
 
-    /// @brief A namespace that has functions that implement Base64Url encoding and decoding in accordance to RFC 4648 §5.
-    namespace Base64Url
+    /**
+     * An algorithm and its options that are resolved once, for calling the same codec very often on short inputs. The tables, the vectorized functions
+     * of the processor and the options are looked up when the Codec is created, so a call only does the encoding or decoding itself. The functions that
+     * return a std::string_view reuse memory of the Codec, so they do not allocate once it is big enough. A Codec is not safe to be used by several
+     * threads at once, every thread should have its own, for example a thread_local one.
+    */
+    class Codec
     {
-        /// @brief A simple error class for the Base64Url namespace.
+    public:
+        /// @brief A simple error class for the Codec class.
         class Error : public std::exception
         {
         public:
             /// @brief The type of Error.
             enum class Type
             {
+                INVALID_OPTIONS_ERROR,         ///< Invalid algorithm or options.
                 INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
+                STRING_PARSE_ERROR,            ///< Failed to parse string.
+                OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
             };
 
             /**
@@ -4032,8 +9922,10 @@ namespace BinaryText
                 _sourceLocation(sourceLocation_)
             {
                 switch(_type) {
-                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
+                    case Type::INVALID_OPTIONS_ERROR: _what = "Invalid algorithm or options"; break;
+                    case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Failed to reserve size to internal string"; break;
                     case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                    case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
                     default: _what = "Invalid error type"; break;
                 }
             }
@@ -4064,636 +9956,285 @@ namespace BinaryText
             std::string _what;
         };
 
-        static_assert(std::numeric_limits<unsigned char>::digits == 8, "These Base64Url functions only works if a char is 8 bits big");
-
         /**
-         * @brief Encodes a not-encoded string into a Base64Url encoded string.
-         * @param[in] string_ String to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base64Url::Error
+         * @brief Creates a Codec and resolves everything the algorithm needs for the given options.
+         * @param[in] algorithm_ Algorithm to be used.
+         * @param[in] options_ Options of the algorithm.
+         * @throws BinaryText::Codec::Error
         */
-        std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+        explicit Codec(const Algorithm algorithm_, const CodecOptions& options_ = CodecOptions()) :
+            _algorithm(algorithm_),
+            _options(options_),
+            _encode(nullptr),
+            _decode(nullptr),
+            _maximumEncodedSize(nullptr),
+            _maximumDecodedSize(nullptr),
+            _maximumInputSize(0),
+            _base16EncodeTable(nullptr),
+            _decodeTable(nullptr),
+            _base16Kernels(Internal::GetBase16Kernels()),
+            _base32Kernels(Internal::GetBase32Kernels()),
+            _base64Kernels(Internal::GetBase64Kernels()),
+            _encodedString(),
+            _decodedString()
         {
-            using Internal::charSize;
-
-            std::string encodedString;
-
-            try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(string_.size())) / 3.0) * 4.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
-            }
-
-            for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int counter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if((std::next(jter, 1) == string_.cend()) or (std::next(jter, 1) == std::next(iter, 3))) {
-                        iter = jter;
-
-                        break;
-                    }
+            const std::size_t maximumSize(std::string().max_size());
+
+            switch(_algorithm) {
+                case Algorithm::BASE_16: {
+                    switch(_options.encodeCase) {
+                        case Base16::Case::UPPERCASE: _base16EncodeTable = &Internal::base16UppercaseEncodeTable; break;
+                        case Base16::Case::LOWERCASE: _base16EncodeTable = &Internal::base16LowercaseEncodeTable; break;
+                        default: throw Error(Error::Type::INVALID_OPTIONS_ERROR);
+                    }
+
+                    switch(_options.decodeCase) {
+                        case Base16::Case::MIXED: _decodeTable = &Internal::base16MixedDecodeTable; break;
+                        case Base16::Case::UPPERCASE: _decodeTable = &Internal::base16UppercaseDecodeTable; break;
+                        case Base16::Case::LOWERCASE: _decodeTable = &Internal::base16LowercaseDecodeTable; break;
+                        default: throw Error(Error::Type::INVALID_OPTIONS_ERROR);
+                    }
+
+                    _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                        Internal::EncodeBase16(input_, inputSize_, output_, *codec_._base16EncodeTable, codec_._base16Kernels);
+
+                        return inputSize_ * 2;
+                    };
+                    _decode = [](const Codec& codec_, const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                        return Internal::DecodeBase16(input_, inputSize_, output_, *codec_._decodeTable, codec_._base16Kernels);
+                    };
+                    _maximumEncodedSize = [](const Codec&, const std::size_t size_) noexcept { return Base16::EncodedSize(size_); };
+                    _maximumDecodedSize = [](const std::string_view input_) noexcept { return Base16::MaximumDecodedSize(input_.size()); };
+                    _maximumInputSize = maximumSize / 2;
+                    break;
                 }
+                case Algorithm::BASE_32:
+                case Algorithm::BASE_32_HEX: {
+                    const bool hex(_algorithm == Algorithm::BASE_32_HEX);
 
-                switch(counter) {
-                    case 3U: counter = 4U; break;
-                    case 2U: {
-                        bitset <<= charSize;
-                        counter = 3U;
-
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 2);
-                        counter = 2U;
-
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
+                    _decodeTable = hex ? &Internal::base32HexDecodeTable : &Internal::base32DecodeTable;
+                    if(hex) {
+                        _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                            return Internal::EncodeBase32(input_, inputSize_, output_, Internal::base32HexAlphabet, codec_._options.withPadding,
+                                                          codec_._base32Kernels);
+                        };
+                    } else {
+                        _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                            return Internal::EncodeBase32(input_, inputSize_, output_, Internal::base32Alphabet, codec_._options.withPadding,
+                                                          codec_._base32Kernels);
+                        };
+                    }
+
+                    _decode = [](const Codec& codec_, const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                        return Internal::DecodeBase32(input_, inputSize_, output_, *codec_._decodeTable, codec_._base32Kernels);
+                    };
+                    _maximumEncodedSize = [](const Codec& codec_, const std::size_t size_) noexcept {
+                        return Internal::Base32EncodedSize(size_, codec_._options.withPadding);
+                    };
+                    _maximumDecodedSize = [](const std::string_view input_) noexcept { return Internal::Base32MaximumDecodedSize(input_.size()); };
+                    _maximumInputSize = (maximumSize / 8) * 5;
+                    break;
                 }
-
-                for(unsigned int i(1U); i < 5U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
+                case Algorithm::BASE_64:
+                case Algorithm::BASE_64_URL: {
+                    const bool url(_algorithm == Algorithm::BASE_64_URL);
+
+                    if(url) {
+                        _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                            return Internal::EncodeBase64(input_, inputSize_, output_, true, codec_._options.withPadding, codec_._base64Kernels);
+                        };
+                        _decode = [](const Codec& codec_, const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                            return Internal::DecodeBase64(input_, inputSize_, output_, true, codec_._base64Kernels);
+                        };
                     } else {
-                        std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B000000ULL: encodedString.append(1, 'A'); break;
-                            case 0B000001ULL: encodedString.append(1, 'B'); break;
-                            case 0B000010ULL: encodedString.append(1, 'C'); break;
-                            case 0B000011ULL: encodedString.append(1, 'D'); break;
-                            case 0B000100ULL: encodedString.append(1, 'E'); break;
-                            case 0B000101ULL: encodedString.append(1, 'F'); break;
-                            case 0B000110ULL: encodedString.append(1, 'G'); break;
-                            case 0B000111ULL: encodedString.append(1, 'H'); break;
-                            case 0B001000ULL: encodedString.append(1, 'I'); break;
-                            case 0B001001ULL: encodedString.append(1, 'J'); break;
-                            case 0B001010ULL: encodedString.append(1, 'K'); break;
-                            case 0B001011ULL: encodedString.append(1, 'L'); break;
-                            case 0B001100ULL: encodedString.append(1, 'M'); break;
-                            case 0B001101ULL: encodedString.append(1, 'N'); break;
-                            case 0B001110ULL: encodedString.append(1, 'O'); break;
-                            case 0B001111ULL: encodedString.append(1, 'P'); break;
-                            case 0B010000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B010001ULL: encodedString.append(1, 'R'); break;
-                            case 0B010010ULL: encodedString.append(1, 'S'); break;
-                            case 0B010011ULL: encodedString.append(1, 'T'); break;
-                            case 0B010100ULL: encodedString.append(1, 'U'); break;
-                            case 0B010101ULL: encodedString.append(1, 'V'); break;
-                            case 0B010110ULL: encodedString.append(1, 'W'); break;
-                            case 0B010111ULL: encodedString.append(1, 'X'); break;
-                            case 0B011000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B011001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B011010ULL: encodedString.append(1, 'a'); break;
-                            case 0B011011ULL: encodedString.append(1, 'b'); break;
-                            case 0B011100ULL: encodedString.append(1, 'c'); break;
-                            case 0B011101ULL: encodedString.append(1, 'd'); break;
-                            case 0B011110ULL: encodedString.append(1, 'e'); break;
-                            case 0B011111ULL: encodedString.append(1, 'f'); break;
-                            case 0B100000ULL: encodedString.append(1, 'g'); break;
-                            case 0B100001ULL: encodedString.append(1, 'h'); break;
-                            case 0B100010ULL: encodedString.append(1, 'i'); break;
-                            case 0B100011ULL: encodedString.append(1, 'j'); break;
-                            case 0B100100ULL: encodedString.append(1, 'k'); break;
-                            case 0B100101ULL: encodedString.append(1, 'l'); break;
-                            case 0B100110ULL: encodedString.append(1, 'm'); break;
-                            case 0B100111ULL: encodedString.append(1, 'n'); break;
-                            case 0B101000ULL: encodedString.append(1, 'o'); break;
-                            case 0B101001ULL: encodedString.append(1, 'p'); break;
-                            case 0B101010ULL: encodedString.append(1, 'q'); break;
-                            case 0B101011ULL: encodedString.append(1, 'r'); break;
-                            case 0B101100ULL: encodedString.append(1, 's'); break;
-                            case 0B101101ULL: encodedString.append(1, 't'); break;
-                            case 0B101110ULL: encodedString.append(1, 'u'); break;
-                            case 0B101111ULL: encodedString.append(1, 'v'); break;
-                            case 0B110000ULL: encodedString.append(1, 'w'); break;
-                            case 0B110001ULL: encodedString.append(1, 'x'); break;
-                            case 0B110010ULL: encodedString.append(1, 'y'); break;
-                            case 0B110011ULL: encodedString.append(1, 'z'); break;
-                            case 0B110100ULL: encodedString.append(1, '0'); break;
-                            case 0B110101ULL: encodedString.append(1, '1'); break;
-                            case 0B110110ULL: encodedString.append(1, '2'); break;
-                            case 0B110111ULL: encodedString.append(1, '3'); break;
-                            case 0B111000ULL: encodedString.append(1, '4'); break;
-                            case 0B111001ULL: encodedString.append(1, '5'); break;
-                            case 0B111010ULL: encodedString.append(1, '6'); break;
-                            case 0B111011ULL: encodedString.append(1, '7'); break;
-                            case 0B111100ULL: encodedString.append(1, '8'); break;
-                            case 0B111101ULL: encodedString.append(1, '9'); break;
-                            case 0B111110ULL: encodedString.append(1, '-'); break;
-                            case 0B111111ULL: encodedString.append(1, '_'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
+                        _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                            return Internal::EncodeBase64(input_, inputSize_, output_, false, codec_._options.withPadding, codec_._base64Kernels);
+                        };
+                        _decode = [](const Codec& codec_, const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                            return Internal::DecodeBase64(input_, inputSize_, output_, false, codec_._base64Kernels);
+                        };
+                    }
+
+                    _maximumEncodedSize = [](const Codec& codec_, const std::size_t size_) noexcept {
+                        return Internal::Base64EncodedSize(size_, codec_._options.withPadding);
+                    };
+                    _maximumDecodedSize = [](const std::string_view input_) noexcept { return Internal::Base64MaximumDecodedSize(input_.size()); };
+                    _maximumInputSize = (maximumSize / 4) * 3;
+                    break;
+                }
+                case Algorithm::ASCII_85: {
+                    _encode = [](const Codec& codec_, const unsigned char* input_, const std::size_t inputSize_, char* output_) noexcept {
+                        return Internal::EncodeAscii85(input_, inputSize_, output_, codec_._options.foldSpaces, codec_._options.adobeMode);
+                    };
+                    _decode = [](const Codec& codec_, const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                        return Internal::DecodeAscii85(input_, inputSize_, output_, codec_._options.foldSpaces, codec_._options.adobeMode);
+                    };
+                    _maximumEncodedSize = [](const Codec& codec_, const std::size_t size_) noexcept {
+                        return Internal::Ascii85MaximumEncodedSize(size_, codec_._options.adobeMode);
+                    };
+                    _maximumDecodedSize = [](const std::string_view input_) noexcept { return Internal::Ascii85MaximumDecodedSize(input_); };
+                    _maximumInputSize = ((maximumSize - 4) / 5) * 4;
+                    break;
                 }
+                default: throw Error(Error::Type::INVALID_OPTIONS_ERROR);
             }
-
-            return encodedString;
         }
+
         /**
-         * @brief Encodes a ByteBuffer into a Base64Url encoded string.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
-         * @throws BinaryText::Base64Url::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * @brief Gets the algorithm of the Codec.
+         * @returns Algorithm of the Codec.
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true)
-        {
-            using Internal::charSize;
-
-            std::string encodedString;
+        Algorithm GetAlgorithm() const noexcept { return _algorithm; }
+        /**
+         * @brief Gets the options of the Codec.
+         * @returns Constant reference to the options of the Codec.
+        */
+        const CodecOptions& GetOptions() const noexcept { return _options; }
+        /**
+         * @brief Calculates the maximum amount of characters an input of given size is encoded into.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @returns Maximum amount of encoded characters.
+        */
+        std::size_t GetMaximumEncodedSize(const std::size_t size_) const noexcept { return _maximumEncodedSize(*this, size_); }
+        /**
+         * @brief Calculates the maximum amount of bytes an input is decoded into.
+         * @param[in] input_ Characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        std::size_t GetMaximumDecodedSize(const std::string_view input_) const noexcept { return _maximumDecodedSize(input_); }
 
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(byteBuffer_.GetSize())) / 3.0) * 4.0));
-                }
-            } catch(const std::length_error&) {
-                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+        /**
+         * @brief Encodes bytes into a buffer of the caller, which never allocates.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for GetMaximumEncodedSize(input_.size()) characters.
+         * @returns Amount of characters written.
+         * @throws BinaryText::Codec::Error
+        */
+        std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_) const
+        {
+            if(input_.size() > _maximumInputSize or output_.size() < GetMaximumEncodedSize(input_.size())) {
+                throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
             }
 
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int counter(0U);
-
-                for(typename ByteBuffer<ByteType>::ConstantIterator jter(iter); jter != byteBuffer_.ConstantEnd(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == byteBuffer_.ConstantEnd() or std::next(jter, 1) == std::next(iter, 3)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(counter) {
-                    case 3U: counter = 4U; break;
-                    case 2U: {
-                        bitset <<= charSize;
-                        counter = 3U;
-
-                        break;
-                    }
-                    case 1U: {
-                        bitset <<= (charSize * 2);
-                        counter = 2U;
-
-                        break;
-                    }
-                    default: Internal::UnreachableTerminate();
-                }
-
-                for(unsigned int i(1U); i < 5U; ++i) {
-                    if(i > counter) {
-                        if(withPadding_) {
-                            encodedString.append(1, '=');
-                        } else {
-                            break;
-                        }
-                    } else {
-                        std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
-
-                        switch(partialBitset.to_ullong()) {
-                            case 0B000000ULL: encodedString.append(1, 'A'); break;
-                            case 0B000001ULL: encodedString.append(1, 'B'); break;
-                            case 0B000010ULL: encodedString.append(1, 'C'); break;
-                            case 0B000011ULL: encodedString.append(1, 'D'); break;
-                            case 0B000100ULL: encodedString.append(1, 'E'); break;
-                            case 0B000101ULL: encodedString.append(1, 'F'); break;
-                            case 0B000110ULL: encodedString.append(1, 'G'); break;
-                            case 0B000111ULL: encodedString.append(1, 'H'); break;
-                            case 0B001000ULL: encodedString.append(1, 'I'); break;
-                            case 0B001001ULL: encodedString.append(1, 'J'); break;
-                            case 0B001010ULL: encodedString.append(1, 'K'); break;
-                            case 0B001011ULL: encodedString.append(1, 'L'); break;
-                            case 0B001100ULL: encodedString.append(1, 'M'); break;
-                            case 0B001101ULL: encodedString.append(1, 'N'); break;
-                            case 0B001110ULL: encodedString.append(1, 'O'); break;
-                            case 0B001111ULL: encodedString.append(1, 'P'); break;
-                            case 0B010000ULL: encodedString.append(1, 'Q'); break;
-                            case 0B010001ULL: encodedString.append(1, 'R'); break;
-                            case 0B010010ULL: encodedString.append(1, 'S'); break;
-                            case 0B010011ULL: encodedString.append(1, 'T'); break;
-                            case 0B010100ULL: encodedString.append(1, 'U'); break;
-                            case 0B010101ULL: encodedString.append(1, 'V'); break;
-                            case 0B010110ULL: encodedString.append(1, 'W'); break;
-                            case 0B010111ULL: encodedString.append(1, 'X'); break;
-                            case 0B011000ULL: encodedString.append(1, 'Y'); break;
-                            case 0B011001ULL: encodedString.append(1, 'Z'); break;
-                            case 0B011010ULL: encodedString.append(1, 'a'); break;
-                            case 0B011011ULL: encodedString.append(1, 'b'); break;
-                            case 0B011100ULL: encodedString.append(1, 'c'); break;
-                            case 0B011101ULL: encodedString.append(1, 'd'); break;
-                            case 0B011110ULL: encodedString.append(1, 'e'); break;
-                            case 0B011111ULL: encodedString.append(1, 'f'); break;
-                            case 0B100000ULL: encodedString.append(1, 'g'); break;
-                            case 0B100001ULL: encodedString.append(1, 'h'); break;
-                            case 0B100010ULL: encodedString.append(1, 'i'); break;
-                            case 0B100011ULL: encodedString.append(1, 'j'); break;
-                            case 0B100100ULL: encodedString.append(1, 'k'); break;
-                            case 0B100101ULL: encodedString.append(1, 'l'); break;
-                            case 0B100110ULL: encodedString.append(1, 'm'); break;
-                            case 0B100111ULL: encodedString.append(1, 'n'); break;
-                            case 0B101000ULL: encodedString.append(1, 'o'); break;
-                            case 0B101001ULL: encodedString.append(1, 'p'); break;
-                            case 0B101010ULL: encodedString.append(1, 'q'); break;
-                            case 0B101011ULL: encodedString.append(1, 'r'); break;
-                            case 0B101100ULL: encodedString.append(1, 's'); break;
-                            case 0B101101ULL: encodedString.append(1, 't'); break;
-                            case 0B101110ULL: encodedString.append(1, 'u'); break;
-                            case 0B101111ULL: encodedString.append(1, 'v'); break;
-                            case 0B110000ULL: encodedString.append(1, 'w'); break;
-                            case 0B110001ULL: encodedString.append(1, 'x'); break;
-                            case 0B110010ULL: encodedString.append(1, 'y'); break;
-                            case 0B110011ULL: encodedString.append(1, 'z'); break;
-                            case 0B110100ULL: encodedString.append(1, '0'); break;
-                            case 0B110101ULL: encodedString.append(1, '1'); break;
-                            case 0B110110ULL: encodedString.append(1, '2'); break;
-                            case 0B110111ULL: encodedString.append(1, '3'); break;
-                            case 0B111000ULL: encodedString.append(1, '4'); break;
-                            case 0B111001ULL: encodedString.append(1, '5'); break;
-                            case 0B111010ULL: encodedString.append(1, '6'); break;
-                            case 0B111011ULL: encodedString.append(1, '7'); break;
-                            case 0B111100ULL: encodedString.append(1, '8'); break;
-                            case 0B111101ULL: encodedString.append(1, '9'); break;
-                            case 0B111110ULL: encodedString.append(1, '-'); break;
-                            case 0B111111ULL: encodedString.append(1, '_'); break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-                }
-            }
+            Statistics::StageTimer timer(Statistics::Stage::ENCODE, input_.size());
 
-            return encodedString;
+            return timer.CountOutput(_encode(*this, reinterpret_cast<const unsigned char*>(input_.data()), input_.size(), output_.data()));
         }
         /**
-         * @brief Decodes a Base64Url encoded string into a decoded string. Whitespace and newline characters are not ignored.
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base64Url::Error
+         * @brief Encodes a not-encoded string into an encoded string of the caller, its capacity is reused and its previous contents are discarded.
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to.
+         * @throws BinaryText::Codec::Error
         */
-        std::string DecodeStringToString(const std::string& encodedString_)
+        void Encode(const std::string_view string_, std::string& encodedString_) const
         {
-            using Internal::charSize;
-
-            std::string decodedString;
-
-            try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(encodedString_.size())) / 4.0) * 3.0));
-                }
-            } catch(const std::length_error&) {
+            if(string_.size() > _maximumInputSize) {
                 throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 3) / 4;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
-                            case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
-                            case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
-                            case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
-                            case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
-                            case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
-                            case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
-                            case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
-                            case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
-                            case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
-                            case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
-                            case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
-                            case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
-                            case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
-                            case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
-                            case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
-                            case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
-                            case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
-                            case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
-                            case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
-                            case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
-                            case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
-                            case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
-                            case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
-                            case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
-                            case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
-                            case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
-                            case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
-                            case '-': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
-                            case '_': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
-
-                    if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(loopCounter) {
-                    case 4U: break;
-                    case 3U: {
-                        bitset <<= ((charSize * 3) / 4);
-
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 2U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (((charSize * 3) / 4) * 2);
-
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 2U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
+            const auto encode([this, string_](char* output_) noexcept {
+                Statistics::StageTimer timer(Statistics::Stage::ENCODE, string_.size());
 
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
-                }
+                return timer.CountOutput(_encode(*this, reinterpret_cast<const unsigned char*>(string_.data()), string_.size(), output_));
+            });
 
-                switch(paddingCounter) {
-                    case 0U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+            Internal::EncodeIntoString<Error>(encodedString_, GetMaximumEncodedSize(string_.size()), encode);
+        }
+        /**
+         * @brief Encodes a not-encoded string into memory of the Codec, which is reused by the next call.
+         * @param[in] string_ String to be encoded.
+         * @returns View of the encoded characters, valid until the Codec encodes again or is destroyed.
+         * @throws BinaryText::Codec::Error
+        */
+        std::string_view Encode(const std::string_view string_)
+        {
+            Encode(string_, _encodedString);
 
-                        break;
-                    }
-                    case 1U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+            return _encodedString;
+        }
+        /**
+         * Decodes characters into a buffer of the caller, which never allocates. Whitespace and newline characters are only ignored by Base16 and
+         * Ascii85, like in their namespaces.
+         *
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for GetMaximumDecodedSize(input_) bytes.
+         * @returns Amount of bytes written.
+         * @throws BinaryText::Codec::Error
+        */
+        std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_) const
+        {
+            if(output_.size() < GetMaximumDecodedSize(input_)) {
+                throw Error(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
+            }
 
-                        break;
-                    }
-                    case 2U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()))); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
+            Statistics::StageTimer timer(Statistics::Stage::DECODE, input_.size());
+            const Internal::DecodeResult result(timer.CountOutput(_decode(*this, input_.data(), input_.size(),
+                                                                          reinterpret_cast<unsigned char*>(output_.data()))));
 
-                if(paddingCounter > 0U) {
-                    break;
-                }
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
             }
 
-            return decodedString;
+            return result.size;
         }
         /**
-         * @brief Decodes a Base64Url encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
-         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
-         * @param[in] encodedString_ String to be decoded.
-         * @throws BinaryText::Base64Url::Error
-         * @throws BinaryText::ByteBuffer::Error
+         * Decodes an encoded string into a decoded string of the caller, its capacity is reused and its previous contents are discarded. If the input is
+         * invalid the string is left empty.
+         *
+         * @param[in] encodedString_ String to be decoded, it must not be decodedString_ itself.
+         * @param[out] decodedString_ String the decoded bytes are written to.
+         * @throws BinaryText::Codec::Error
         */
-        template<typename ByteType>
-            requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_)
+        void Decode(const std::string_view encodedString_, std::string& decodedString_) const
         {
-            using Internal::charSize;
-
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
-            auto addToByteBuffer = [&decodedByteBuffer, &byteBuffer, &bufferIterator](const unsigned char byte_) -> void {
-                if(bufferIterator < 8192) {
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
-
-                    bufferIterator += 1;
-                } else {
-                    decodedByteBuffer += byteBuffer;
-                    bufferIterator = 0;
-
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
-
-                    bufferIterator += 1;
-                }
-            };
-
-            for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                std::bitset<charSize * 3> bitset;
-                unsigned int paddingCounter(0U);
-                unsigned int loopCounter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
-                    loopCounter += 1U;
-                    bitset <<= (charSize * 3) / 4;
-
-                    if(paddingCounter > 0U and *jter != '=') {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    } else {
-                        switch(*jter) {
-                            case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
-                            case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
-                            case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
-                            case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
-                            case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
-                            case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
-                            case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
-                            case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
-                            case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
-                            case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
-                            case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
-                            case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
-                            case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
-                            case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
-                            case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
-                            case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
-                            case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
-                            case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
-                            case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
-                            case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
-                            case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
-                            case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
-                            case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
-                            case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
-                            case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
-                            case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
-                            case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
-                            case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
-                            case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
-                            case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
-                            case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
-                            case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
-                            case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
-                            case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
-                            case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
-                            case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
-                            case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
-                            case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
-                            case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
-                            case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
-                            case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
-                            case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
-                            case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
-                            case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
-                            case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
-                            case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
-                            case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
-                            case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
-                            case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
-                            case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
-                            case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
-                            case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
-                            case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
-                            case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
-                            case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
-                            case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
-                            case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
-                            case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
-                            case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
-                            case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
-                            case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
-                            case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
-                            case '-': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
-                            case '_': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
-                            case '=': paddingCounter += 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
-
-                    if((std::next(jter, 1) == encodedString_.cend()) or (std::next(jter, 1) == std::next(iter, 4))) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(loopCounter) {
-                    case 4U: break;
-                    case 3U: {
-                        bitset <<= ((charSize * 3) / 4);
-
-                        switch(paddingCounter) {
-                            case 1U: paddingCounter = 2U; break;
-                            case 0U: paddingCounter = 1U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 2U: {
-                        bitset <<= (((charSize * 3) / 4) * 2);
-
-                        switch(paddingCounter) {
-                            case 0U: paddingCounter = 2U; break;
-                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-
-                        break;
-                    }
-                    case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
-                    default: Internal::UnreachableTerminate();
-                }
-
-                switch(paddingCounter) {
-                    case 0U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>(bitset.to_ullong()));
-
-                        break;
-                    }
-                    case 1U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-
-                        break;
-                    }
-                    case 2U: addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())); break;
-                    default: throw Error(Error::Type::STRING_PARSE_ERROR);
-                }
-
-                if(paddingCounter > 0U) {
-                    break;
-                }
-            }
+            const auto decode([this](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                Statistics::StageTimer timer(Statistics::Stage::DECODE, inputSize_);
 
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+                return timer.CountOutput(_decode(*this, input_, inputSize_, output_));
+            });
 
-                decodedByteBuffer += byteBuffer;
-            }
+            Internal::DecodeIntoString<Error>(encodedString_, decodedString_, GetMaximumDecodedSize(encodedString_), decode);
+        }
+        /**
+         * @brief Decodes an encoded string into memory of the Codec, which is reused by the next call.
+         * @param[in] encodedString_ String to be decoded.
+         * @returns View of the decoded bytes, valid until the Codec decodes again or is destroyed.
+         * @throws BinaryText::Codec::Error
+        */
+        std::string_view Decode(const std::string_view encodedString_)
+        {
+            Decode(encodedString_, _decodedString);
 
-            return decodedByteBuffer;
+            return _decodedString;
         }
+
+    private:
+        using EncodeFunction = std::size_t (*)(const Codec&, const unsigned char*, std::size_t, char*) noexcept;
+        using DecodeFunction = Internal::DecodeResult (*)(const Codec&, const char*, std::size_t, unsigned char*) noexcept;
+
+        Algorithm _algorithm;
+        CodecOptions _options;
+        EncodeFunction _encode;
+        DecodeFunction _decode;
+        std::size_t (*_maximumEncodedSize)(const Codec&, std::size_t) noexcept;
+        std::size_t (*_maximumDecodedSize)(std::string_view) noexcept;
+        std::size_t _maximumInputSize; ///< Largest input whose encoded size fits into a std::string.
+        const std::array<char, 512>* _base16EncodeTable;
+        const std::array<unsigned char, 256>* _decodeTable; ///< Decoding table of Base16 or Base32.
+        Internal::Base16Kernels _base16Kernels;
+        Internal::Base32Kernels _base32Kernels;
+        Internal::Base64Kernels _base64Kernels;
+        std::string _encodedString;
+        std::string _decodedString;
     };
 
-    /// @brief A namespace that has functions that implement Ascii85 encoding and decoding.
-    namespace Ascii85
+    /**
+     * A namespace that has functions that implement Base16, Base32 and Base64 style encoding and decoding with any alphabet. The alphabet is a template
+     * argument, so its tables are created at compile time and custom alphabets cost as much as the standard ones.
+    */
+    namespace BaseN
     {
-        /// @brief A simple error class for the Ascii85 namespace.
+        /// @brief A simple error class for the BaseN namespace.
         class Error : public std::exception
         {
         public:
@@ -4701,7 +10242,8 @@ namespace BinaryText
             enum class Type
             {
                 INTERNAL_STRING_RESERVE_ERROR, ///< Failed to reserve size to internal string.
-                STRING_PARSE_ERROR             ///< Failed to parse string.
+                STRING_PARSE_ERROR,            ///< Failed to parse string.
+                OUTPUT_BUFFER_TOO_SMALL_ERROR  ///< Output buffer is too small.
             };
 
             /**
@@ -4716,6 +10258,7 @@ namespace BinaryText
                 switch(_type) {
                     case Type::INTERNAL_STRING_RESERVE_ERROR: _what = "Faild to reserve size to internal string"; break;
                     case Type::STRING_PARSE_ERROR: _what = "Failed to parse string"; break;
+                    case Type::OUTPUT_BUFFER_TOO_SMALL_ERROR: _what = "Output buffer is too small"; break;
                     default: _what = "Invalid error type"; break;
                 }
             }
@@ -4746,528 +10289,573 @@ namespace BinaryText
             std::string _what;
         };
 
-        static_assert(Internal::charSize == 8, "These Ascii85 functions only works if a char is 8 bits big");
+        static_assert(Internal::charSize == 8, "These BaseN functions only works if a char is 8 bits big");
+
+        /**
+         * An alphabet of 16, 32 or 64 characters that can be used as a template argument. The characters and the decode table are created at compile time,
+         * an alphabet with repeated characters or with the padding character '=' does not compile.
+         *
+         * @tparam size_ Amount of characters in the alphabet, 16, 32 or 64.
+        */
+        template<std::size_t size_>
+        struct Alphabet
+        {
+            using Geometry = Internal::AlphabetGeometry<size_>;
+
+            std::array<char, size_> characters;             ///< Character of each value.
+            std::array<unsigned char, 256> decodeTable;     ///< Value of each character, Internal::invalidSymbol for characters outside of the alphabet.
+
+            /**
+             * @brief Creates an Alphabet.
+             * @param[in] characters_ The characters of the alphabet, ordered by value.
+             * @param[in] caseInsensitive_ Whether or not letters are also decoded in the other case.
+             * @param[in] aliases_ Pairs of an extra character and the character of the alphabet it is decoded as, for example "O0I1" decodes O as 0 and I as 1.
+            */
+            consteval Alphabet(const char (&characters_)[size_ + 1], const bool caseInsensitive_ = false, const std::string_view aliases_ = {}) :
+                characters(),
+                decodeTable()
+            {
+                const auto otherCase([](const char character_) {
+                    if(character_ >= 'A' and character_ <= 'Z') {
+                        return static_cast<char>(character_ - 'A' + 'a');
+                    } else if(character_ >= 'a' and character_ <= 'z') {
+                        return static_cast<char>(character_ - 'a' + 'A');
+                    }
+
+                    return character_;
+                });
+                const auto add([this](const char character_, const unsigned char value_) {
+                    unsigned char& entry(decodeTable[static_cast<unsigned char>(character_)]);
+
+                    if(character_ == '=' or (entry != Internal::invalidSymbol and entry != value_)) {
+                        throw std::invalid_argument("Alphabet characters must be unique and must not be the padding character");
+                    }
+
+                    entry = value_;
+                });
+
+                decodeTable.fill(Internal::invalidSymbol);
+
+                for(std::size_t i(0); i < size_; ++i) {
+                    if(decodeTable[static_cast<unsigned char>(characters_[i])] != Internal::invalidSymbol) {
+                        throw std::invalid_argument("Alphabet characters must be unique and must not be the padding character");
+                    }
+
+                    characters[i] = characters_[i];
+                    add(characters_[i], static_cast<unsigned char>(i));
+                }
+
+                if(aliases_.size() % 2 != 0) {
+                    throw std::invalid_argument("Alphabet aliases must come in pairs");
+                }
+
+                for(std::size_t i(0); i < aliases_.size(); i += 2) {
+                    const unsigned char value(decodeTable[static_cast<unsigned char>(aliases_[i + 1])]);
+
+                    if(value == Internal::invalidSymbol) {
+                        throw std::invalid_argument("Alphabet aliases must map to a character of the alphabet");
+                    }
+
+                    add(aliases_[i], value);
+                }
+
+                if(caseInsensitive_) {
+                    for(std::size_t i(0); i < 256; ++i) {
+                        const char character(static_cast<char>(i));
+
+                        if(decodeTable[i] != Internal::invalidSymbol and otherCase(character) != character) {
+                            add(otherCase(character), decodeTable[i]);
+                        }
+                    }
+                }
+            }
+        };
+
+        template<std::size_t size_, typename... Options>
+        Alphabet(const char (&)[size_], Options...) -> Alphabet<size_ - 1>;
+
+        /// @brief Base16 alphabet in accordance to RFC 4648 §8, lowercase digits are also decoded.
+        constexpr Alphabet base16Alphabet("0123456789ABCDEF", true);
+        /// @brief Base32 alphabet in accordance to RFC 4648 §6.
+        constexpr Alphabet base32Alphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZ234567");
+        /// @brief Base32Hex alphabet in accordance to RFC 4648 §7.
+        constexpr Alphabet base32HexAlphabet("0123456789ABCDEFGHIJKLMNOPQRSTUV");
+        /// @brief Base64 alphabet in accordance to RFC 4648 §4.
+        constexpr Alphabet base64Alphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+        /// @brief Base64Url alphabet in accordance to RFC 4648 §5.
+        constexpr Alphabet base64UrlAlphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+        /// @brief Crockford's Base32 alphabet. Decoding ignores the case and reads O as 0 and I and L as 1, it is normally used without padding.
+        constexpr Alphabet crockfordBase32Alphabet("0123456789ABCDEFGHJKMNPQRSTVWXYZ", true, "O0I1L1");
+        /// @brief The z-base-32 alphabet, it is normally used without padding.
+        constexpr Alphabet zBase32Alphabet("ybndrfg8ejkmcpqxot1uwisza345h769");
+
+        /**
+         * @brief Gets the category of the error codes set by the non-throwing functions.
+         * @returns Error category of the BaseN namespace.
+        */
+        inline const std::error_category& GetErrorCategory() noexcept
+        {
+            static const Internal::ErrorCategory<Error> errorCategory("BinaryText::BaseN");
+
+            return errorCategory;
+        }
+        /**
+         * @brief Creates an error code of given Type.
+         * @param[in] type_ Type of Error.
+         * @returns Error code in the category returned by GetErrorCategory.
+        */
+        inline std::error_code MakeErrorCode(const Error::Type type_) noexcept { return std::error_code(static_cast<int>(type_) + 1, GetErrorCategory()); }
+        /**
+         * @brief Calculates the size of an encoded string.
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] size_ Amount of bytes to be encoded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) is included.
+         * @returns Amount of characters the encoded string will have.
+        */
+        template<Alphabet alphabet_>
+        constexpr std::size_t EncodedSize(const std::size_t size_, const bool withPadding_ = true) noexcept
+        {
+            return Internal::AlphabetEncodedSize<alphabet_.characters.size()>(size_, withPadding_);
+        }
+        /**
+         * @brief Calculates the maximum amount of bytes an encoded string can be decoded into.
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] size_ Amount of characters to be decoded.
+         * @returns Maximum amount of decoded bytes.
+        */
+        template<Alphabet alphabet_>
+        constexpr std::size_t MaximumDecodedSize(const std::size_t size_) noexcept
+        {
+            return Internal::AlphabetMaximumDecodedSize<alphabet_.characters.size()>(size_);
+        }
 
         /**
-         * @brief Encodes a not-encoded string into an Ascii85 encoded string.
+         * @brief Encodes a not-encoded string into an encoded string.
+         * @tparam alphabet_ Alphabet to be used.
          * @param[in] string_ String to be encoded.
-         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
-         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
-         * @throws BinaryText::Ascii85::Error
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
         */
-        std::string EncodeStringToString(const std::string& string_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+        template<Alphabet alphabet_>
+        std::string EncodeStringToString(const std::string_view string_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
         {
-            using Internal::charSize;
+            using Geometry = typename decltype(alphabet_)::Geometry;
 
             std::string encodedString;
 
-            try {
-                if(string_.size() > 0) {
-                    encodedString.reserve(string_.size() + static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 4.0)));
-                }
-            } catch(const std::length_error&) {
+            if(string_.size() > (encodedString.max_size() / Geometry::charactersPerGroup) * Geometry::bytesPerGroup) {
                 throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            if(adobeMode_) {
-                encodedString.append("<~");
-            }
-
-            for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
-                std::bitset<charSize * 4> bitset;
-                unsigned int counter(0U);
-
-                for(std::string::const_iterator jter(iter); jter != string_.end(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize * 4>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-
-                    if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(counter) {
-                    case 4U: counter = 0U; break;
-                    case 3U: bitset <<= charSize; break;
-                    case 2U: bitset <<= (charSize * 2); break;
-                    case 1U: bitset <<= (charSize * 3); break;
-                    default: Internal::UnreachableTerminate();
-                }
-
-                if(bitset == std::bitset<charSize * 4>(0B00000000000000000000000000000000ULL)) {
-                    encodedString.append(1, 'z');
-                } else if(bitset == std::bitset<charSize * 4>(0B00100000001000000010000000100000ULL) and foldSpaces_) {
-                    encodedString.append(1, 'y');
-                } else {
-                    unsigned long long bitsetNumber(bitset.to_ullong());
-                    std::array<unsigned long long, 5> codes;
-
-                    for(std::array<unsigned long long, 5>::iterator jter(codes.begin()); jter != codes.end(); ++jter) {
-                        *jter = bitsetNumber % 85ULL;
-                        bitsetNumber = static_cast<unsigned long long>(std::floor(static_cast<double>(bitsetNumber) / 85.0));
-                    }
-
-                    for(std::array<unsigned long long, 5>::reverse_iterator jter(codes.rbegin()); jter != codes.rend(); ++jter) {
-                        encodedString.append(1, static_cast<char>(static_cast<unsigned char>(*jter + 33ULL)));
-                    }
-
-                    if((4U - counter) != 4U) {
-                        encodedString.erase(std::prev(encodedString.end(), 4U - counter), encodedString.end());
-                    }
-                }
+            try {
+                encodedString.resize(EncodedSize<alphabet_>(string_.size(), withPadding_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            if(adobeMode_) {
-                encodedString.append("~>");
-            }
+            Internal::EncodeAlphabetInParallel<alphabet_.characters.size()>(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(),
+                                                                            encodedString.data(), alphabet_.characters.data(), withPadding_, threadCount_);
 
             return encodedString;
         }
         /**
-         * @brief Encodes a ByteBuffer into a Ascii85 encoded string.
+         * @brief Encodes a ByteBuffer into an encoded string.
+         * @tparam alphabet_ Alphabet to be used.
          * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
          * @param[in] byteBuffer_ ByteBuffer to be encoded.
-         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
-         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
-         * @throws BinaryText::Ascii85::Error
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
          * @throws BinaryText::ByteBuffer::Error
         */
-        template<typename ByteType>
+        template<Alphabet alphabet_, typename ByteType>
             requires ByteBufferStringCompatible<ByteType>
-        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+        std::string EncodeByteBufferToString(const ByteBuffer<ByteType>& byteBuffer_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
         {
-            using Internal::charSize;
+            using Geometry = typename decltype(alphabet_)::Geometry;
 
             std::string encodedString;
 
-            try {
-                if(byteBuffer_.GetSize() > 0) {
-                    encodedString.reserve(byteBuffer_.GetSize()
-                                          + static_cast<std::string::size_type>(std::ceil(static_cast<double>(byteBuffer_.GetSize()) / 4.0)));
-                }
-            } catch(const std::length_error&) {
+            if(byteBuffer_.IsEmpty()) {
+                return encodedString;
+            } else if(byteBuffer_.GetSize() > (encodedString.max_size() / Geometry::charactersPerGroup) * Geometry::bytesPerGroup) {
                 throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            if(adobeMode_) {
-                encodedString.append("<~");
+            try {
+                encodedString.resize(EncodedSize<alphabet_>(byteBuffer_.GetSize(), withPadding_));
+            } catch(const std::length_error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            for(typename ByteBuffer<ByteType>::ConstantIterator iter(byteBuffer_.ConstantBegin()); iter != byteBuffer_.ConstantEnd(); ++iter) {
-                std::bitset<charSize * 4> bitset;
-                unsigned int counter(0U);
+            Internal::EncodeAlphabetInParallel<alphabet_.characters.size()>(reinterpret_cast<const unsigned char*>(byteBuffer_.GetBuffer()),
+                                                                            byteBuffer_.GetSize(), encodedString.data(), alphabet_.characters.data(),
+                                                                            withPadding_, threadCount_);
 
-                for(typename ByteBuffer<ByteType>::ConstantIterator jter(iter); jter != byteBuffer_.ConstantEnd(); ++jter) {
-                    counter += 1U;
-                    bitset <<= charSize;
-                    bitset |= std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong();
-
-                    if(std::next(jter, 1) == byteBuffer_.ConstantEnd() or std::next(jter, 1) == std::next(iter, 4)) {
-                        iter = jter;
-
-                        break;
-                    }
-                }
-
-                switch(counter) {
-                    case 4U: counter = 0U; break;
-                    case 3U: bitset <<= charSize; break;
-                    case 2U: bitset <<= (charSize * 2); break;
-                    case 1U: bitset <<= (charSize * 3); break;
-                    default: Internal::UnreachableTerminate();
-                }
-
-                if(bitset == std::bitset<charSize * 4>(0B00000000000000000000000000000000ULL)) {
-                    encodedString.append(1, 'z');
-                } else if(bitset == std::bitset<charSize * 4>(0B00100000001000000010000000100000ULL) and foldSpaces_) {
-                    encodedString.append(1, 'y');
-                } else {
-                    unsigned long long bitsetNumber(bitset.to_ullong());
-                    std::array<unsigned long long, 5> codes;
-
-                    for(std::array<unsigned long long, 5>::iterator jter(codes.begin()); jter != codes.end(); ++jter) {
-                        *jter = bitsetNumber % 85ULL;
-                        bitsetNumber = static_cast<unsigned long long>(std::floor(static_cast<double>(bitsetNumber) / 85.0));
-                    }
-
-                    for(std::array<unsigned long long, 5>::reverse_iterator jter(codes.rbegin()); jter != codes.rend(); ++jter) {
-                        encodedString.append(1, static_cast<char>(static_cast<unsigned char>(*jter + 33ULL)));
-                    }
+            return encodedString;
+        }
+        /**
+         * @brief Encodes a ByteBufferView into an encoded string.
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        std::string EncodeByteBufferToString(const ByteBufferView<ByteType> byteBufferView_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            return EncodeStringToString<alphabet_>(Internal::ViewAsCharacters(byteBufferView_), withPadding_, threadCount_);
+        }
+        /**
+         * Encodes a not-encoded string into an encoded string of the caller, like EncodeStringToString but reusing the capacity of the string, so
+         * that encoding many inputs into the same string does not allocate once it is big enough.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] string_ String to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_>
+        void EncodeInto(const std::string_view string_, std::string& encodedString_, const bool withPadding_ = true, const std::size_t threadCount_ = 1)
+        {
+            using Geometry = typename decltype(alphabet_)::Geometry;
 
-                    if((4U - counter) != 4U) {
-                        encodedString.erase(std::prev(encodedString.end(), 4U - counter), encodedString.end());
-                    }
-                }
+            if(string_.size() > (encodedString_.max_size() / Geometry::charactersPerGroup) * Geometry::bytesPerGroup) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            if(adobeMode_) {
-                encodedString.append("~>");
-            }
+            const auto encode([string_, withPadding_, threadCount_](char* output_) noexcept {
+                return Internal::EncodeAlphabetInParallel<alphabet_.characters.size()>(reinterpret_cast<const unsigned char*>(string_.data()), string_.size(),
+                                                                                       output_, alphabet_.characters.data(), withPadding_, threadCount_);
+            });
 
-            return encodedString;
+            Internal::EncodeIntoString<Error>(encodedString_, EncodedSize<alphabet_>(string_.size(), withPadding_), encode);
         }
         /**
-         * @brief Decodes a Ascii85 encoded string into a decoded string. Whitespace and newline characters are ignored.
+         * @brief Encodes a ByteBuffer into an encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBuffer_ ByteBuffer to be encoded.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBuffer<ByteType>& byteBuffer_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            EncodeInto<alphabet_>(Internal::ViewAsCharacters(byteBuffer_), encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Encodes a ByteBufferView into an encoded string of the caller, like EncodeByteBufferToString but reusing the capacity of the string.
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] byteBufferView_ ByteBufferView to be encoded, for example a Subview of a bigger ByteBuffer.
+         * @param[out] encodedString_ String the encoded characters are written to, its previous contents are discarded.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void EncodeInto(const ByteBufferView<ByteType> byteBufferView_, std::string& encodedString_, const bool withPadding_ = true,
+                        const std::size_t threadCount_ = 1)
+        {
+            EncodeInto<alphabet_>(Internal::ViewAsCharacters(byteBufferView_), encodedString_, withPadding_, threadCount_);
+        }
+        /**
+         * @brief Decodes an encoded string into a decoded string. Whitespace and newline characters are not ignored.
+         * @tparam alphabet_ Alphabet to be used.
          * @param[in] encodedString_ String to be decoded.
-         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
-         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
-         * @throws BinaryText::Ascii85::Error
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
         */
-        std::string DecodeStringToString(const std::string& encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+        template<Alphabet alphabet_>
+        std::string DecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1)
         {
-            using Internal::charSize;
-
             std::string decodedString;
 
             try {
-                if(encodedString_.size() > 0) {
-                    decodedString.reserve(encodedString_.size()
-                                          - static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 5.0)));
-                }
+                decodedString.resize(MaximumDecodedSize<alphabet_>(encodedString_.size()));
             } catch(const std::length_error&) {
                 throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
             }
 
-            std::string::const_iterator encodedStringBegin(encodedString_.cbegin());
-            std::string::const_iterator encodedStringEnd(encodedString_.cend());
-
-            if(adobeMode_) {
-                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                    if(*iter == '<' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.cend()) {
-                        encodedStringBegin = std::next(iter, 2);
-
-                        break;
-                    } else if(*iter == ' ' or *iter == '\n') {
-                        if(std::next(iter, 1) == encodedString_.cend()) {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        } else {
-                            continue;
-                        }
-                    } else {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    }
-                }
-
-                for(std::string::const_reverse_iterator iter(encodedString_.crbegin()); iter != encodedString_.crend(); ++iter) {
-                    if(*iter == '>' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.crend()) {
-                        encodedStringEnd = std::next(iter, 2).base();
+            const Internal::DecodeResult result(Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(
+                encodedString_.data(), encodedString_.size(), reinterpret_cast<unsigned char*>(decodedString.data()), alphabet_.decodeTable, threadCount_));
 
-                        break;
-                    } else if(*iter == ' ' or *iter == '\n') {
-                        if(std::next(iter, 1) == encodedString_.crend()) {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        } else {
-                            continue;
-                        }
-                    } else {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    }
-                }
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
             }
 
-            for(std::string::const_iterator iter(encodedStringBegin); iter != encodedStringEnd; ++iter) {
-                unsigned long long bitsetNumber(0ULL);
-                unsigned int counter(0U);
-
-                switch(*iter) {
-                    case ' ': continue;
-                    case '\n': continue;
-                    case 'y': {
-                        if(foldSpaces_) {
-                            decodedString.append("    ");
-
-                            continue;
-                        } else {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
-                    case 'z': continue; // decodedString.append("\0\0\0\0");
-                    default: {
-                        for(std::string::const_iterator jter(iter); iter != encodedStringEnd; ++jter) {
-                            if(*jter == ' ' or *jter == '\n') {
-                                if(std::next(jter, 1) == encodedStringEnd) {
-                                    break;
-                                } else {
-                                    std::advance(iter, 1);
-
-                                    continue;
-                                }
-                            } else {
-                                const unsigned long long partialBitsetNumber(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-                                counter += 1U;
-
-                                if(partialBitsetNumber < 33ULL or partialBitsetNumber > 117ULL) {
-                                    throw Error(Error::Type::STRING_PARSE_ERROR);
-                                } else {
-                                    switch(counter) {
-                                        case 1U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL * 85ULL); break;
-                                        case 2U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL); break;
-                                        case 3U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL); break;
-                                        case 4U: bitsetNumber += (partialBitsetNumber - 33ULL) * 85ULL; break;
-                                        case 5U: bitsetNumber += partialBitsetNumber - 33ULL; break;
-                                        default: Internal::UnreachableTerminate();
-                                    }
-
-                                    if(std::next(jter, 1) == encodedStringEnd or std::next(jter, 1) == std::next(iter, 5)) {
-                                        iter = jter;
-
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-
-                {
-                    const unsigned int previousCounter(counter);
-
-                    while(counter < 5U) {
-                        counter += 1U;
-
-                        switch(counter) {
-                            case 1U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL * 85ULL; break;
-                            case 2U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL; break;
-                            case 3U: bitsetNumber += 84ULL * 85ULL * 85ULL; break;
-                            case 4U: bitsetNumber += 84ULL * 85ULL; break;
-                            case 5U: bitsetNumber += 84ULL; break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
-
-                    counter = 5U - previousCounter;
-                }
-
-                const std::bitset<charSize * 4> bitset(bitsetNumber);
-
-                switch(counter) {
-                    case 0U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
-
-                        break;
-                    }
-                    case 1U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
-
-                        break;
-                    }
-                    case 2U: {
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
-                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
-
-                        break;
-                    }
-                    case 3U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()))); break;
-                    case 4U: break;
-                    default: Internal::UnreachableTerminate();
-                }
-            }
+            decodedString.resize(result.size);
 
             return decodedString;
         }
         /**
-         * @brief Decodes a Ascii85 encoded string into a decoded ByteBuffer. Whitespace and newline characters are ignored.
+         * @brief Decodes an encoded string into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam alphabet_ Alphabet to be used.
          * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
          * @param[in] encodedString_ String to be decoded.
-         * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
-         * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
-         * @throws BinaryText::Ascii85::Error
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::BaseN::Error
          * @throws BinaryText::ByteBuffer::Error
         */
-        template<typename ByteType>
+        template<Alphabet alphabet_, typename ByteType>
             requires ByteBufferStringCompatible<ByteType>
-        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string& encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
-        {
-            using Internal::charSize;
-
-            ByteBuffer<ByteType> decodedByteBuffer;
-            ByteBuffer<ByteType> byteBuffer(8192);
-            typename ByteBuffer<ByteType>::SizeType bufferIterator(0);
-            std::string::const_iterator encodedStringBegin(encodedString_.cbegin());
-            std::string::const_iterator encodedStringEnd(encodedString_.cend());
-            auto addToByteBuffer = [&decodedByteBuffer, &byteBuffer, &bufferIterator](const unsigned char byte_) -> void {
-                if(bufferIterator < 8192) {
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
-
-                    bufferIterator += 1;
-                } else {
-                    decodedByteBuffer += byteBuffer;
-                    bufferIterator = 0;
+        ByteBuffer<ByteType> DecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                      std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            ByteBuffer<ByteType> decodedByteBuffer(MaximumDecodedSize<alphabet_>(encodedString_.size()), uninitialized, memoryResource_);
+            const Internal::DecodeResult result(Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(
+                encodedString_.data(), encodedString_.size(), reinterpret_cast<unsigned char*>(decodedByteBuffer.GetBuffer()), alphabet_.decodeTable,
+                threadCount_));
 
-                    if constexpr(std::is_same_v<ByteType, unsigned char>) {
-                        byteBuffer.At(bufferIterator) = byte_;
-                    } else {
-                        byteBuffer.At(bufferIterator) = static_cast<ByteType>(byte_);
-                    }
+            if(not result.isValid) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
 
-                    bufferIterator += 1;
-                }
-            };
+            decodedByteBuffer.Resize(result.size);
 
-            if(adobeMode_) {
-                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
-                    if(*iter == '<' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.cend()) {
-                        encodedStringBegin = std::next(iter, 2);
+            return decodedByteBuffer;
+        }
+        /**
+         * Decodes an encoded string into a decoded string like DecodeStringToString, but reports errors through the result instead of throwing. Whitespace and
+         * newline characters are not ignored.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Decoded string, or an error code in the category returned by GetErrorCategory.
+        */
+        template<Alphabet alphabet_>
+        Result<std::string> TryDecodeStringToString(const std::string_view encodedString_, const std::size_t threadCount_ = 1) noexcept
+        {
+            const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(input_, inputSize_, output_, alphabet_.decodeTable, threadCount_);
+            });
 
-                        break;
-                    } else if(*iter == ' ' or *iter == '\n') {
-                        if(std::next(iter, 1) == encodedString_.cend()) {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        } else {
-                            continue;
-                        }
-                    } else {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    }
-                }
+            return Internal::TryDecodeToString<Error>(encodedString_, MaximumDecodedSize<alphabet_>(encodedString_.size()), MakeErrorCode, decode);
+        }
+        /**
+         * Decodes an encoded string into a decoded ByteBuffer like DecodeStringToByteBuffer, but reports errors through the result instead of throwing. A
+         * ByteBuffer that cannot be allocated is reported as Error::Type::INTERNAL_STRING_RESERVE_ERROR. Whitespace and newline characters are not ignored.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @returns Decoded ByteBuffer, or an error code in the category returned by GetErrorCategory.
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        Result<ByteBuffer<ByteType>> TryDecodeStringToByteBuffer(const std::string_view encodedString_, const std::size_t threadCount_ = 1,
+                                                                 std::pmr::memory_resource* memoryResource_ = nullptr) noexcept
+        {
+            const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(input_, inputSize_, output_, alphabet_.decodeTable, threadCount_);
+            });
 
-                for(std::string::const_reverse_iterator iter(encodedString_.crbegin()); iter != encodedString_.crend(); ++iter) {
-                    if(*iter == '>' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.crend()) {
-                        encodedStringEnd = std::next(iter, 2).base();
+            return Internal::TryDecodeToByteBuffer<Error, ByteType>(encodedString_, MaximumDecodedSize<alphabet_>(encodedString_.size()), memoryResource_,
+                                                                    MakeErrorCode, decode);
+        }
+        /**
+         * Decodes an encoded string into a decoded string of the caller, like DecodeStringToString but reusing the capacity of the string, so
+         * that decoding many inputs into the same string does not allocate once it is big enough. If an Error is thrown the string is left empty.
+         * Whitespace and newline characters are not ignored.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedString_.
+         * @param[out] decodedString_ String the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_>
+        void DecodeInto(const std::string_view encodedString_, std::string& decodedString_, const std::size_t threadCount_ = 1)
+        {
+            const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(input_, inputSize_, output_, alphabet_.decodeTable, threadCount_);
+            });
 
-                        break;
-                    } else if(*iter == ' ' or *iter == '\n') {
-                        if(std::next(iter, 1) == encodedString_.crend()) {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        } else {
-                            continue;
-                        }
-                    } else {
-                        throw Error(Error::Type::STRING_PARSE_ERROR);
-                    }
-                }
-            }
+            Internal::DecodeIntoString<Error>(encodedString_, decodedString_, MaximumDecodedSize<alphabet_>(encodedString_.size()), decode);
+        }
+        /**
+         * Decodes an encoded string into a decoded ByteBuffer of the caller, like DecodeStringToByteBuffer but reusing the capacity of the
+         * ByteBuffer and without initializing its bytes first. If an Error is thrown the ByteBuffer is left empty. Whitespace and newline characters are not
+         * ignored.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in] encodedString_ String to be decoded, it must not be part of decodedByteBuffer_.
+         * @param[out] decodedByteBuffer_ ByteBuffer the decoded bytes are written to, its previous contents are discarded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @throws BinaryText::BaseN::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferStringCompatible<ByteType>
+        void DecodeInto(const std::string_view encodedString_, ByteBuffer<ByteType>& decodedByteBuffer_, const std::size_t threadCount_ = 1)
+        {
+            const auto decode([threadCount_](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(input_, inputSize_, output_, alphabet_.decodeTable, threadCount_);
+            });
 
-            for(std::string::const_iterator iter(encodedStringBegin); iter != encodedStringEnd; ++iter) {
-                unsigned long long bitsetNumber(0ULL);
-                unsigned int counter(0U);
+            Internal::DecodeIntoByteBuffer<Error>(encodedString_, decodedByteBuffer_, MaximumDecodedSize<alphabet_>(encodedString_.size()), decode);
+        }
 
-                switch(*iter) {
-                    case ' ': continue;
-                    case '\n': continue;
-                    case 'y': {
-                        if(foldSpaces_) {
-                            for(unsigned int i(0U); i < 4U; ++i) {
-                                addToByteBuffer(static_cast<unsigned char>(' '));
-                            }
+        /**
+         * @brief Decodes BaseN encoded characters held by a ByteBuffer into a decoded ByteBuffer. Whitespace and newline characters are not ignored.
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @tparam EncodedByteType Type of the encoded ByteBuffer that satisfies the ByteBufferCompatible concept.
+         * @param[in] encodedByteBuffer_ ByteBuffer to be decoded.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+         * @throws BinaryText::BaseN::Error
+         * @throws BinaryText::ByteBuffer::Error
+        */
+        template<Alphabet alphabet_, typename ByteType, typename EncodedByteType>
+            requires ByteBufferStringCompatible<ByteType> and ByteBufferCompatible<EncodedByteType>
+        ByteBuffer<ByteType> DecodeByteBufferToByteBuffer(const ByteBuffer<EncodedByteType>& encodedByteBuffer_, const std::size_t threadCount_ = 1,
+                                                          std::pmr::memory_resource* memoryResource_ = nullptr)
+        {
+            return DecodeStringToByteBuffer<alphabet_, ByteType>(Internal::ViewAsCharacters(encodedByteBuffer_), threadCount_, memoryResource_);
+        }
+        /**
+         * Decodes BaseN encoded characters held by a ByteBuffer into the ByteBuffer itself, the decoded bytes overwrite the characters and the ByteBuffer is
+         * shrunk to fit them, so no second buffer is needed. Whitespace and newline characters are not ignored. If an Error is thrown the ByteBuffer is
+         * cleared.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @tparam ByteType Type that satisfies the ByteBufferCompatible concept (char, signed char, unsigned char and std::byte).
+         * @param[in,out] byteBuffer_ ByteBuffer to be decoded.
+         * @throws BinaryText::BaseN::Error
+        */
+        template<Alphabet alphabet_, typename ByteType>
+            requires ByteBufferCompatible<ByteType>
+        void DecodeByteBufferInPlace(ByteBuffer<ByteType>& byteBuffer_)
+        {
+            const auto decode([](const char* input_, const std::size_t inputSize_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabet<alphabet_.characters.size()>(input_, inputSize_, output_, alphabet_.decodeTable);
+            });
 
-                            continue;
-                        } else {
-                            throw Error(Error::Type::STRING_PARSE_ERROR);
-                        }
-                    }
-                    case 'z': {
-                        for(unsigned int i(0U); i < 4U; ++i) {
-                            addToByteBuffer(static_cast<unsigned char>('\0'));
-                        }
+            if(not Internal::DecodeInPlace(byteBuffer_, decode)) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+        }
 
-                        continue;
-                    }
-                    default: {
-                        for(std::string::const_iterator jter(iter); iter != encodedStringEnd; ++jter) {
-                            if(*jter == ' ' or *jter == '\n') {
-                                if(std::next(jter, 1) == encodedStringEnd) {
-                                    break;
-                                } else {
-                                    std::advance(iter, 1);
-
-                                    continue;
-                                }
-                            } else {
-                                const unsigned long long partialBitsetNumber(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
-                                counter += 1U;
-
-                                if(partialBitsetNumber < 33ULL or partialBitsetNumber > 117ULL) {
-                                    throw Error(Error::Type::STRING_PARSE_ERROR);
-                                } else {
-                                    switch(counter) {
-                                        case 1U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL * 85ULL); break;
-                                        case 2U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL); break;
-                                        case 3U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL); break;
-                                        case 4U: bitsetNumber += (partialBitsetNumber - 33ULL) * 85ULL; break;
-                                        case 5U: bitsetNumber += partialBitsetNumber - 33ULL; break;
-                                        default: Internal::UnreachableTerminate();
-                                    }
-
-                                    if(std::next(jter, 1) == encodedStringEnd or std::next(jter, 1) == std::next(iter, 5)) {
-                                        iter = jter;
-
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+        /**
+         * Checks whether BaseN encoded characters can be decoded, by the same rules as the decoding functions but without keeping the decoded bytes.
+         * Nothing is allocated and nothing is thrown. Whitespace and newline characters are not ignored.
+         *
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] input_ Characters to be checked.
+         * @returns Whether or not the input is valid, the exact decoded size and the offset of the first group that cannot be decoded.
+        */
+        template<Alphabet alphabet_>
+        ValidationResult Validate(const std::string_view input_) noexcept
+        {
+            using Geometry = Internal::AlphabetGeometry<alphabet_.characters.size()>;
 
-                {
-                    const unsigned int previousCounter(counter);
-
-                    while(counter < 5U) {
-                        counter += 1U;
-
-                        switch(counter) {
-                            case 1U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL * 85ULL; break;
-                            case 2U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL; break;
-                            case 3U: bitsetNumber += 84ULL * 85ULL * 85ULL; break;
-                            case 4U: bitsetNumber += 84ULL * 85ULL; break;
-                            case 5U: bitsetNumber += 84ULL; break;
-                            default: Internal::UnreachableTerminate();
-                        }
-                    }
+            const auto decode([](const char* characters_, const std::size_t size_, unsigned char* output_) noexcept {
+                return Internal::DecodeAlphabet<alphabet_.characters.size()>(characters_, size_, output_, alphabet_.decodeTable);
+            });
 
-                    counter = 5U - previousCounter;
-                }
+            return Internal::ValidateGroups<Geometry::charactersPerGroup, Geometry::bytesPerGroup>(input_, decode);
+        }
 
-                const std::bitset<charSize * 4> bitset(bitsetNumber);
+        /**
+         * @brief Encodes bytes into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] input_ Bytes to be encoded.
+         * @param[out] output_ Where the encoded characters are written to, must have room for EncodedSize(input_.size(), withPadding_) characters.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of characters written, 0 on error.
+        */
+        template<Alphabet alphabet_>
+        std::size_t Encode(const std::span<const std::byte> input_, const std::span<char> output_, std::error_code& errorCode_, const bool withPadding_ = true,
+                           const std::size_t threadCount_ = 1) noexcept
+        {
+            if(output_.size() < EncodedSize<alphabet_>(input_.size(), withPadding_)) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
 
-                switch(counter) {
-                    case 0U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>(bitset.to_ullong()));
+                return 0;
+            }
 
-                        break;
-                    }
-                    case 1U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> charSize).to_ullong()));
+            errorCode_.clear();
 
-                        break;
-                    }
-                    case 2U: {
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()));
-                        addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()));
+            return Internal::EncodeAlphabetInParallel<alphabet_.characters.size()>(reinterpret_cast<const unsigned char*>(input_.data()), input_.size(),
+                                                                                   output_.data(), alphabet_.characters.data(), withPadding_, threadCount_);
+        }
+        /**
+         * @brief Decodes characters into a caller-provided buffer. Nothing is allocated and nothing is thrown.
+         * @tparam alphabet_ Alphabet to be used.
+         * @param[in] input_ Characters to be decoded.
+         * @param[out] output_ Where the decoded bytes are written to, must have room for MaximumDecodedSize(input_.size()) bytes.
+         * @param[out] errorCode_ Cleared on success, set to an error code of GetErrorCategory otherwise.
+         * @param[in] threadCount_ Amount of threads large inputs are split across, 0 for one per hardware thread.
+         * @returns Amount of bytes written, 0 on error.
+        */
+        template<Alphabet alphabet_>
+        std::size_t Decode(const std::string_view input_, const std::span<std::byte> output_, std::error_code& errorCode_,
+                           const std::size_t threadCount_ = 1) noexcept
+        {
+            if(output_.size() < MaximumDecodedSize<alphabet_>(input_.size())) {
+                errorCode_ = MakeErrorCode(Error::Type::OUTPUT_BUFFER_TOO_SMALL_ERROR);
 
-                        break;
-                    }
-                    case 3U: addToByteBuffer(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())); break;
-                    case 4U: break;
-                    default: Internal::UnreachableTerminate();
-                }
+                return 0;
             }
 
-            if(bufferIterator > 0) {
-                byteBuffer.Resize(bufferIterator);
+            const Internal::DecodeResult result(Internal::DecodeAlphabetInParallel<alphabet_.characters.size()>(
+                input_.data(), input_.size(), reinterpret_cast<unsigned char*>(output_.data()), alphabet_.decodeTable, threadCount_));
 
-                decodedByteBuffer += byteBuffer;
+            if(not result.isValid) {
+                errorCode_ = MakeErrorCode(Error::Type::STRING_PARSE_ERROR);
+
+                return 0;
             }
 
-            return decodedByteBuffer;
+            errorCode_.clear();
+
+            return result.size;
         }
     };
+
+    /**
+     * User-defined literals that decode a string literal at compile time into a std::array of unsigned char, for example "SGVsbG8="_b64. A string
+     * literal that is not valid does not compile. They are brought into scope with using namespace BinaryText::Literals.
+    */
+    namespace Literals
+    {
+        /// @brief Decodes a Base16 string literal of mixed case at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_b16() noexcept { return Base16::DecodeArray<encodedString_>(); }
+        /// @brief Decodes a Base32 string literal at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_b32() noexcept { return Base32::DecodeArray<encodedString_>(); }
+        /// @brief Decodes a Base32Hex string literal at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_b32hex() noexcept { return Base32Hex::DecodeArray<encodedString_>(); }
+        /// @brief Decodes a Base64 string literal at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_b64() noexcept { return Base64::DecodeArray<encodedString_>(); }
+        /// @brief Decodes a Base64Url string literal at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_b64url() noexcept { return Base64Url::DecodeArray<encodedString_>(); }
+        /// @brief Decodes an Ascii85 string literal without folded spaces or delimiters at compile time.
+        template<Internal::ConstantString encodedString_>
+        consteval auto operator""_a85() noexcept { return Ascii85::DecodeArray<encodedString_>(); }
+    };
 };
\ No newline at end of file
@@ -0,0 +1,1558 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "BinaryText.hpp"
+#include "Differential.hpp"
+#include "Reference.hpp"
+
+namespace Differential
+{
+    /// @brief Amount of threads passed to the functions that split large inputs, so that inputs above 2 MiB are checked in chunks too.
+    constexpr std::size_t threadCount = 4;
+
+    using InstructionSet = BinaryText::Internal::InstructionSet;
+
+    /**
+     * @brief Gets every InstructionSet the processor supports, so that the vectorized functions of each are checked and not only the ones in use.
+     * @returns NONE and every supported InstructionSet.
+    */
+    std::vector<InstructionSet> GetInstructionSets()
+    {
+        switch(BinaryText::Internal::GetInstructionSet()) {
+            case InstructionSet::AVX2: return {InstructionSet::NONE, InstructionSet::SSE4_1, InstructionSet::AVX2};
+            case InstructionSet::SSE4_1: return {InstructionSet::NONE, InstructionSet::SSE4_1};
+            case InstructionSet::NEON: return {InstructionSet::NONE, InstructionSet::NEON};
+            default: return {InstructionSet::NONE};
+        }
+    }
+
+    /**
+     * @brief Gets the name of an InstructionSet, for the names of the functions.
+     * @param[in] instructionSet_ InstructionSet to be named.
+     * @returns Name of the InstructionSet.
+    */
+    std::string_view GetName(const InstructionSet instructionSet_)
+    {
+        switch(instructionSet_) {
+            case InstructionSet::SSE4_1: return "sse4.1";
+            case InstructionSet::AVX2: return "avx2";
+            case InstructionSet::NEON: return "neon";
+            default: return "scalar";
+        }
+    }
+
+    /// @brief What a function produced, either its output or the Error::Type of the codec it failed with.
+    struct Outcome
+    {
+        std::string output; ///< Encoded characters or decoded bytes, empty if it failed.
+        int errorType = -1; ///< Error::Type of the codec as an integer, -1 if it did not fail, -2 and -3 for failures that only a check can have.
+
+        bool operator==(const Outcome&) const = default;
+    };
+
+    /// @brief A function of a codec with fixed options.
+    struct Function
+    {
+        std::string name;                             ///< Name of the function, for the mismatch descriptions.
+        std::function<Outcome(std::string_view)> run; ///< Encodes or decodes a string.
+        bool isSizeOnly = false;                      ///< Whether or not only the size of the output is compared, for Validate.
+    };
+
+    /// @brief Functions that are checked against a reference of their own, such as the line-wrapping encoders against the wrapped reference encoding.
+    struct Group
+    {
+        Function reference;              ///< BinaryText::Reference with the input or the output adjusted to the functions.
+        std::vector<Function> functions; ///< Functions to be checked.
+    };
+
+    /// @brief A codec with fixed options, its reference functions and every function that is checked against them.
+    struct Variant
+    {
+        std::string name;                 ///< Algorithm and options.
+        Function referenceEncode;         ///< Encoding function of BinaryText::Reference.
+        Function referenceDecode;         ///< Decoding function of BinaryText::Reference.
+        std::vector<Function> encoders;   ///< Encoding functions to be checked.
+        std::vector<Function> decoders;   ///< Decoding functions to be checked.
+        std::vector<Group> encoderGroups; ///< Encoding functions with a reference of their own.
+        std::vector<Group> decoderGroups; ///< Decoding functions with a reference of their own.
+    };
+
+    /**
+     * @brief Runs a function and turns an Error of the codec into an Outcome.
+     * @param[in] function_ Function that returns the output.
+     * @returns Output or Error::Type of the function.
+    */
+    template<typename ErrorType, typename FunctionType>
+    Outcome Catch(const FunctionType& function_)
+    {
+        try {
+            return Outcome{function_(), -1};
+        } catch(const ErrorType& error_) {
+            return Outcome{std::string(), static_cast<int>(error_.GetType())};
+        }
+    }
+
+    /**
+     * @brief Runs a function of a Codec and turns an Error of the Codec into the Outcome of the Error::Type with the same meaning.
+     * @param[in] function_ Function that returns the output.
+     * @returns Output or Error::Type of the function, -2 for an Error that the codec functions cannot have.
+    */
+    template<typename ErrorType, typename FunctionType>
+    Outcome CatchCodec(const FunctionType& function_)
+    {
+        try {
+            return Outcome{function_(), -1};
+        } catch(const BinaryText::Codec::Error& error_) {
+            switch(error_.GetType()) {
+                case BinaryText::Codec::Error::Type::STRING_PARSE_ERROR: return Outcome{std::string(), static_cast<int>(ErrorType::Type::STRING_PARSE_ERROR)};
+                case BinaryText::Codec::Error::Type::INTERNAL_STRING_RESERVE_ERROR: {
+                    return Outcome{std::string(), static_cast<int>(ErrorType::Type::INTERNAL_STRING_RESERVE_ERROR)};
+                }
+                default: return Outcome{std::string(), -2};
+            }
+        }
+    }
+
+    /**
+     * @brief Turns the output and the error code of a function that does not throw into an Outcome.
+     * @param[in] output_ Output of the function.
+     * @param[in] errorCode_ Error code of the function, in the error category of the codec.
+     * @returns Output or Error::Type of the function.
+    */
+    Outcome FromErrorCode(const std::string_view output_, const std::error_code& errorCode_)
+    {
+        return errorCode_ ? Outcome{std::string(), errorCode_.value() - 1} : Outcome{std::string(output_), -1};
+    }
+
+    /**
+     * @brief Views bytes as characters.
+     * @param[in] bytes_ Bytes to be viewed.
+     * @returns Characters of the bytes.
+    */
+    template<typename ByteType>
+    std::string_view ToString(const std::span<const ByteType> bytes_)
+    {
+        return std::string_view(reinterpret_cast<const char*>(bytes_.data()), bytes_.size());
+    }
+
+    /**
+     * @brief Splits characters into lines the way the line-wrapping encoding functions do.
+     * @param[in] string_ Characters to be split.
+     * @param[in] lineWrapping_ Line length and separator.
+     * @returns Characters with a separator after every full line but the last.
+    */
+    std::string Wrap(const std::string_view string_, const BinaryText::LineWrapping& lineWrapping_)
+    {
+        if(lineWrapping_.lineLength == 0) {
+            return std::string(string_);
+        }
+
+        std::string wrappedString;
+
+        for(std::size_t i(0); i < string_.size(); i += lineWrapping_.lineLength) {
+            if(i != 0) {
+                wrappedString.append(lineWrapping_.separator);
+            }
+
+            wrappedString.append(string_.substr(i, lineWrapping_.lineLength));
+        }
+
+        return wrappedString;
+    }
+
+    /**
+     * @brief Removes the characters that the decoding functions taking IgnoreWhitespace skip.
+     * @param[in] string_ Characters to be stripped.
+     * @returns Characters without space, tab, newline, vertical tab, form feed and carriage return.
+    */
+    std::string StripWhitespace(const std::string_view string_)
+    {
+        std::string strippedString;
+
+        std::copy_if(string_.begin(), string_.end(), std::back_inserter(strippedString),
+                     [](const char character_) { return not BinaryText::Internal::IsWhitespace(character_); });
+
+        return strippedString;
+    }
+
+    /**
+     * @brief Copies characters or bytes into a new ByteBuffer.
+     * @param[in] string_ Characters or bytes to be copied.
+     * @param[in] memoryResource_ Memory resource the ByteBuffer allocates from, nullptr for the default one.
+     * @returns ByteBuffer with a copy of the string.
+    */
+    BinaryText::ByteBuffer<unsigned char> MakeByteBuffer(const std::string_view string_, std::pmr::memory_resource* memoryResource_ = nullptr)
+    {
+        BinaryText::ByteBuffer<unsigned char> byteBuffer(string_.size(), BinaryText::uninitialized, memoryResource_);
+
+        std::copy(string_.begin(), string_.end(), byteBuffer.GetBuffer());
+
+        return byteBuffer;
+    }
+
+    /// @brief A memory resource that counts what is allocated from it, so that a ByteBuffer can be checked to allocate from the one it was given.
+    class CountingMemoryResource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Gets the amount of allocations that were made.
+         * @returns Amount of allocations.
+        */
+        std::size_t GetAllocationCount() const noexcept { return _allocationCount; }
+
+    private:
+        void* do_allocate(const std::size_t size_, const std::size_t alignment_) override
+        {
+            void* pointer(std::pmr::new_delete_resource()->allocate(size_, alignment_));
+
+            ++_allocationCount;
+
+            return pointer;
+        }
+        void do_deallocate(void* pointer_, const std::size_t size_, const std::size_t alignment_) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer_, size_, alignment_);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& memoryResource_) const noexcept override { return this == &memoryResource_; }
+
+        std::size_t _allocationCount = 0;
+    };
+
+    /**
+     * @brief Encodes with an Encoder, a piece of the given size at a time.
+     * @param[in] encoder_ Encoder to be used.
+     * @param[in] input_ Bytes to be encoded.
+     * @param[in] pieceSize_ Amount of bytes passed to each Update.
+     * @returns Encoded characters.
+    */
+    template<typename EncoderType>
+    std::string EncodeInPieces(EncoderType encoder_, const std::string_view input_, const std::size_t pieceSize_)
+    {
+        std::string output;
+        std::vector<char> buffer;
+
+        for(std::size_t i(0); i < input_.size(); i += pieceSize_) {
+            const std::string_view piece(input_.substr(i, pieceSize_));
+
+            buffer.resize(encoder_.GetMaximumUpdateSize(piece.size()));
+            output.append(buffer.data(), encoder_.Update(std::as_bytes(std::span(piece)), buffer));
+        }
+
+        buffer.resize(encoder_.GetMaximumFinishSize());
+        output.append(buffer.data(), encoder_.Finish(buffer));
+
+        return output;
+    }
+
+    /**
+     * @brief Decodes with a Decoder, a piece of the given size at a time.
+     * @param[in] decoder_ Decoder to be used.
+     * @param[in] input_ Characters to be decoded.
+     * @param[in] pieceSize_ Amount of characters passed to each Update.
+     * @returns Decoded bytes.
+    */
+    template<typename DecoderType>
+    std::string DecodeInPieces(DecoderType decoder_, const std::string_view input_, const std::size_t pieceSize_)
+    {
+        std::string output;
+        std::vector<std::byte> buffer;
+
+        for(std::size_t i(0); i < input_.size(); i += pieceSize_) {
+            const std::string_view piece(input_.substr(i, pieceSize_));
+
+            buffer.resize(decoder_.GetMaximumUpdateSize(piece.size()));
+            output.append(ToString(std::span<const std::byte>(buffer.data(), decoder_.Update(piece, buffer))));
+        }
+
+        buffer.resize(decoder_.GetMaximumFinishSize());
+        output.append(ToString(std::span<const std::byte>(buffer.data(), decoder_.Finish(buffer))));
+
+        return output;
+    }
+
+    /// @brief Functions of Base16, the case of encoding and decoding is taken from the options.
+    struct Base16Functions
+    {
+        using Error = BinaryText::Base16::Error;
+        using Encoder = BinaryText::Base16::Encoder;
+        using Decoder = BinaryText::Base16::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::BASE_16;
+
+        static std::string Name(const O& o_)
+        {
+            const auto name([](const BinaryText::Base16::Case case_) {
+                return (case_ == BinaryText::Base16::Case::UPPERCASE) ? "uppercase" : ((case_ == BinaryText::Base16::Case::LOWERCASE) ? "lowercase" : "mixed");
+            });
+
+            return std::format("base16/{}+{}", name(o_.encodeCase), name(o_.decodeCase));
+        }
+        static std::vector<O> MakeOptions()
+        {
+            std::vector<O> options;
+
+            for(const BinaryText::Base16::Case encodeCase : {BinaryText::Base16::Case::UPPERCASE, BinaryText::Base16::Case::LOWERCASE}) {
+                for(const BinaryText::Base16::Case decodeCase :
+                    {BinaryText::Base16::Case::MIXED, BinaryText::Base16::Case::UPPERCASE, BinaryText::Base16::Case::LOWERCASE}) {
+                    options.push_back(O{.encodeCase = encodeCase, .decodeCase = decodeCase});
+                }
+            }
+
+            return options;
+        }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base16::EncodeStringToString(s_, o_.encodeCase);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base16::DecodeStringToString(s_, o_.decodeCase);
+        }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base16::EncodeStringToString(s_, o_.encodeCase, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Base16::EncodeByteBufferToString(b_, o_.encodeCase);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base16::EncodeByteBufferToString(v_, o_.encodeCase, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Base16::EncodeByteBufferViewsToString(v_, o_.encodeCase);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::Base16::EncodeInto(s_, e_, o_.encodeCase); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base16::Encode(i_, e_, c_, o_.encodeCase);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.encodeCase); }
+        static std::size_t EncodeWith(const unsigned char* i_, const std::size_t n_, char* e_, const O& o_, const InstructionSet x_) noexcept
+        {
+            BinaryText::Internal::EncodeBase16(i_, n_, e_, (o_.encodeCase == BinaryText::Base16::Case::UPPERCASE)
+                                                              ? BinaryText::Internal::base16UppercaseEncodeTable
+                                                              : BinaryText::Internal::base16LowercaseEncodeTable,
+                                               BinaryText::Internal::MakeBase16Kernels(x_));
+
+            return n_ * 2;
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base16::DecodeStringToString(s_, o_.decodeCase, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O& o_, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base16::DecodeStringToByteBuffer<unsigned char>(s_, o_.decodeCase, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base16::DecodeByteBufferToByteBuffer<unsigned char>(b_, o_.decodeCase, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            BinaryText::Base16::DecodeByteBufferInPlace(b_, o_.decodeCase);
+        }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Base16::TryDecodeStringToString(s_, o_.decodeCase);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Base16::TryDecodeStringToByteBuffer<unsigned char>(s_, o_.decodeCase);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O& o_) { BinaryText::Base16::DecodeInto(s_, d_, o_.decodeCase); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base16::Decode(s_, d_, c_, o_.decodeCase);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Base16::Validate(s_, o_.decodeCase);
+        }
+        static Decoder MakeDecoder(const O& o_) { return Decoder(o_.decodeCase); }
+        static BinaryText::Internal::DecodeResult DecodeWith(const char* s_, const std::size_t n_, unsigned char* d_, const O& o_,
+                                                             const InstructionSet x_) noexcept
+        {
+            const BinaryText::Internal::Base16Kernels kernels(BinaryText::Internal::MakeBase16Kernels(x_));
+
+            switch(o_.decodeCase) {
+                case BinaryText::Base16::Case::UPPERCASE: {
+                    return BinaryText::Internal::DecodeBase16(s_, n_, d_, BinaryText::Internal::base16UppercaseDecodeTable, kernels);
+                }
+                case BinaryText::Base16::Case::LOWERCASE: {
+                    return BinaryText::Internal::DecodeBase16(s_, n_, d_, BinaryText::Internal::base16LowercaseDecodeTable, kernels);
+                }
+                default: return BinaryText::Internal::DecodeBase16(s_, n_, d_, BinaryText::Internal::base16MixedDecodeTable, kernels);
+            }
+        }
+    };
+
+    /// @brief Functions of Base32, padding is taken from the options.
+    struct Base32Functions
+    {
+        using Error = BinaryText::Base32::Error;
+        using Encoder = BinaryText::Base32::Encoder;
+        using Decoder = BinaryText::Base32::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::BASE_32;
+
+        static std::string Name(const O& o_) { return std::format("base32/{}", o_.withPadding ? "padding" : "no-padding"); }
+        static std::vector<O> MakeOptions() { return {O{.withPadding = true}, O{.withPadding = false}}; }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base32::EncodeStringToString(s_, o_.withPadding);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O&) { return BinaryText::Reference::Base32::DecodeStringToString(s_); }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base32::EncodeStringToString(s_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Base32::EncodeByteBufferToString(b_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base32::EncodeByteBufferToString(v_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Base32::EncodeByteBufferViewsToString(v_, o_.withPadding);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::Base32::EncodeInto(s_, e_, o_.withPadding); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base32::Encode(i_, e_, c_, o_.withPadding);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.withPadding); }
+        static std::size_t EncodeWith(const unsigned char* i_, const std::size_t n_, char* e_, const O& o_, const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::EncodeBase32(i_, n_, e_, BinaryText::Internal::base32Alphabet, o_.withPadding,
+                                                      BinaryText::Internal::MakeBase32Kernels(x_));
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O&, const std::size_t t_)
+        {
+            return BinaryText::Base32::DecodeStringToString(s_, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O&, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base32::DecodeStringToByteBuffer<unsigned char>(s_, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O&,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base32::DecodeByteBufferToByteBuffer<unsigned char>(b_, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O&) { BinaryText::Base32::DecodeByteBufferInPlace(b_); }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base32::TryDecodeStringToString(s_);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base32::TryDecodeStringToByteBuffer<unsigned char>(s_);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O&) { BinaryText::Base32::DecodeInto(s_, d_); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O&) noexcept
+        {
+            return BinaryText::Base32::Decode(s_, d_, c_);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O&) noexcept { return BinaryText::Base32::Validate(s_); }
+        static Decoder MakeDecoder(const O&) { return Decoder(); }
+        static BinaryText::Internal::DecodeResult DecodeWith(const char* s_, const std::size_t n_, unsigned char* d_, const O&,
+                                                             const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::DecodeBase32(s_, n_, d_, BinaryText::Internal::base32DecodeTable, BinaryText::Internal::MakeBase32Kernels(x_));
+        }
+    };
+
+    /// @brief Functions of Base32Hex, padding is taken from the options.
+    struct Base32HexFunctions
+    {
+        using Error = BinaryText::Base32Hex::Error;
+        using Encoder = BinaryText::Base32Hex::Encoder;
+        using Decoder = BinaryText::Base32Hex::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::BASE_32_HEX;
+
+        static std::string Name(const O& o_) { return std::format("base32hex/{}", o_.withPadding ? "padding" : "no-padding"); }
+        static std::vector<O> MakeOptions() { return {O{.withPadding = true}, O{.withPadding = false}}; }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base32Hex::EncodeStringToString(s_, o_.withPadding);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O&) { return BinaryText::Reference::Base32Hex::DecodeStringToString(s_); }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base32Hex::EncodeStringToString(s_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Base32Hex::EncodeByteBufferToString(b_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base32Hex::EncodeByteBufferToString(v_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Base32Hex::EncodeByteBufferViewsToString(v_, o_.withPadding);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::Base32Hex::EncodeInto(s_, e_, o_.withPadding); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base32Hex::Encode(i_, e_, c_, o_.withPadding);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.withPadding); }
+        static std::size_t EncodeWith(const unsigned char* i_, const std::size_t n_, char* e_, const O& o_, const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::EncodeBase32(i_, n_, e_, BinaryText::Internal::base32HexAlphabet, o_.withPadding,
+                                                      BinaryText::Internal::MakeBase32Kernels(x_));
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O&, const std::size_t t_)
+        {
+            return BinaryText::Base32Hex::DecodeStringToString(s_, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O&, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base32Hex::DecodeStringToByteBuffer<unsigned char>(s_, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O&,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base32Hex::DecodeByteBufferToByteBuffer<unsigned char>(b_, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O&) { BinaryText::Base32Hex::DecodeByteBufferInPlace(b_); }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base32Hex::TryDecodeStringToString(s_);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base32Hex::TryDecodeStringToByteBuffer<unsigned char>(s_);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O&) { BinaryText::Base32Hex::DecodeInto(s_, d_); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O&) noexcept
+        {
+            return BinaryText::Base32Hex::Decode(s_, d_, c_);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O&) noexcept { return BinaryText::Base32Hex::Validate(s_); }
+        static Decoder MakeDecoder(const O&) { return Decoder(); }
+        static BinaryText::Internal::DecodeResult DecodeWith(const char* s_, const std::size_t n_, unsigned char* d_, const O&,
+                                                             const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::DecodeBase32(s_, n_, d_, BinaryText::Internal::base32HexDecodeTable, BinaryText::Internal::MakeBase32Kernels(x_));
+        }
+    };
+
+    /// @brief Functions of Base64, padding is taken from the options.
+    struct Base64Functions
+    {
+        using Error = BinaryText::Base64::Error;
+        using Encoder = BinaryText::Base64::Encoder;
+        using Decoder = BinaryText::Base64::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::BASE_64;
+
+        static std::string Name(const O& o_) { return std::format("base64/{}", o_.withPadding ? "padding" : "no-padding"); }
+        static std::vector<O> MakeOptions() { return {O{.withPadding = true}, O{.withPadding = false}}; }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base64::EncodeStringToString(s_, o_.withPadding);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O&) { return BinaryText::Reference::Base64::DecodeStringToString(s_); }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base64::EncodeStringToString(s_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Base64::EncodeByteBufferToString(b_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base64::EncodeByteBufferToString(v_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Base64::EncodeByteBufferViewsToString(v_, o_.withPadding);
+        }
+        static constexpr bool isWrappedEncodedSizeExact = true;
+        static std::size_t WrappedEncodedSize(const std::size_t n_, const BinaryText::LineWrapping& w_, const O& o_) noexcept
+        {
+            return BinaryText::Base64::WrappedEncodedSize(n_, w_, o_.withPadding);
+        }
+        static std::string EncodeStringToString(const std::string_view s_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Base64::EncodeStringToString(s_, w_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Base64::EncodeByteBufferToString(v_, w_, o_.withPadding);
+        }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const BinaryText::LineWrapping& w_,
+                                  const O& o_) noexcept
+        {
+            return BinaryText::Base64::Encode(i_, e_, c_, w_, o_.withPadding);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::Base64::EncodeInto(s_, e_, o_.withPadding); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base64::Encode(i_, e_, c_, o_.withPadding);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.withPadding); }
+        static std::size_t EncodeWith(const unsigned char* i_, const std::size_t n_, char* e_, const O& o_, const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::EncodeBase64(i_, n_, e_, false, o_.withPadding, BinaryText::Internal::MakeBase64Kernels(x_));
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O&, const std::size_t t_)
+        {
+            return BinaryText::Base64::DecodeStringToString(s_, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O&, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base64::DecodeStringToByteBuffer<unsigned char>(s_, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O&,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base64::DecodeByteBufferToByteBuffer<unsigned char>(b_, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O&) { BinaryText::Base64::DecodeByteBufferInPlace(b_); }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base64::TryDecodeStringToString(s_);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base64::TryDecodeStringToByteBuffer<unsigned char>(s_);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O&) { BinaryText::Base64::DecodeInto(s_, d_); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O&) noexcept
+        {
+            return BinaryText::Base64::Decode(s_, d_, c_);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O&) noexcept { return BinaryText::Base64::Validate(s_); }
+        static std::string DecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&)
+        {
+            return BinaryText::Base64::DecodeStringToString(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&)
+        {
+            return BinaryText::Base64::DecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&) noexcept
+        {
+            return BinaryText::Base64::TryDecodeStringToString(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace,
+                                                                                                     const O&) noexcept
+        {
+            return BinaryText::Base64::TryDecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace);
+        }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, BinaryText::IgnoreWhitespace,
+                                  const O&) noexcept
+        {
+            return BinaryText::Base64::Decode(s_, d_, c_, BinaryText::ignoreWhitespace);
+        }
+        static Decoder MakeDecoder(const O&) { return Decoder(); }
+        static BinaryText::Internal::DecodeResult DecodeWith(const char* s_, const std::size_t n_, unsigned char* d_, const O&,
+                                                             const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::DecodeBase64(s_, n_, d_, false, BinaryText::Internal::MakeBase64Kernels(x_));
+        }
+    };
+
+    /// @brief Functions of Base64Url, padding is taken from the options.
+    struct Base64UrlFunctions
+    {
+        using Error = BinaryText::Base64Url::Error;
+        using Encoder = BinaryText::Base64Url::Encoder;
+        using Decoder = BinaryText::Base64Url::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::BASE_64_URL;
+
+        static std::string Name(const O& o_) { return std::format("base64url/{}", o_.withPadding ? "padding" : "no-padding"); }
+        static std::vector<O> MakeOptions() { return {O{.withPadding = true}, O{.withPadding = false}}; }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Base64Url::EncodeStringToString(s_, o_.withPadding);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O&) { return BinaryText::Reference::Base64Url::DecodeStringToString(s_); }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base64Url::EncodeStringToString(s_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Base64Url::EncodeByteBufferToString(b_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Base64Url::EncodeByteBufferToString(v_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Base64Url::EncodeByteBufferViewsToString(v_, o_.withPadding);
+        }
+        static constexpr bool isWrappedEncodedSizeExact = true;
+        static std::size_t WrappedEncodedSize(const std::size_t n_, const BinaryText::LineWrapping& w_, const O& o_) noexcept
+        {
+            return BinaryText::Base64Url::WrappedEncodedSize(n_, w_, o_.withPadding);
+        }
+        static std::string EncodeStringToString(const std::string_view s_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Base64Url::EncodeStringToString(s_, w_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Base64Url::EncodeByteBufferToString(v_, w_, o_.withPadding);
+        }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const BinaryText::LineWrapping& w_,
+                                  const O& o_) noexcept
+        {
+            return BinaryText::Base64Url::Encode(i_, e_, c_, w_, o_.withPadding);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::Base64Url::EncodeInto(s_, e_, o_.withPadding); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Base64Url::Encode(i_, e_, c_, o_.withPadding);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.withPadding); }
+        static std::size_t EncodeWith(const unsigned char* i_, const std::size_t n_, char* e_, const O& o_, const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::EncodeBase64(i_, n_, e_, true, o_.withPadding, BinaryText::Internal::MakeBase64Kernels(x_));
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O&, const std::size_t t_)
+        {
+            return BinaryText::Base64Url::DecodeStringToString(s_, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O&, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base64Url::DecodeStringToByteBuffer<unsigned char>(s_, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O&,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Base64Url::DecodeByteBufferToByteBuffer<unsigned char>(b_, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O&) { BinaryText::Base64Url::DecodeByteBufferInPlace(b_); }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base64Url::TryDecodeStringToString(s_);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::Base64Url::TryDecodeStringToByteBuffer<unsigned char>(s_);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O&) { BinaryText::Base64Url::DecodeInto(s_, d_); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O&) noexcept
+        {
+            return BinaryText::Base64Url::Decode(s_, d_, c_);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O&) noexcept { return BinaryText::Base64Url::Validate(s_); }
+        static std::string DecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&)
+        {
+            return BinaryText::Base64Url::DecodeStringToString(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&)
+        {
+            return BinaryText::Base64Url::DecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O&) noexcept
+        {
+            return BinaryText::Base64Url::TryDecodeStringToString(s_, BinaryText::ignoreWhitespace);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace,
+                                                                                                     const O&) noexcept
+        {
+            return BinaryText::Base64Url::TryDecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace);
+        }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, BinaryText::IgnoreWhitespace,
+                                  const O&) noexcept
+        {
+            return BinaryText::Base64Url::Decode(s_, d_, c_, BinaryText::ignoreWhitespace);
+        }
+        static Decoder MakeDecoder(const O&) { return Decoder(); }
+        static BinaryText::Internal::DecodeResult DecodeWith(const char* s_, const std::size_t n_, unsigned char* d_, const O&,
+                                                             const InstructionSet x_) noexcept
+        {
+            return BinaryText::Internal::DecodeBase64(s_, n_, d_, true, BinaryText::Internal::MakeBase64Kernels(x_));
+        }
+    };
+
+    /**
+     * Functions of Ascii85, space folding and adobe mode are taken from the options. It has no vectorized functions to pick, and an input with a z (or
+     * a y when spaces are folded) is not decoded in place, as it can decode into more bytes than it has characters.
+    */
+    struct Ascii85Functions
+    {
+        using Error = BinaryText::Ascii85::Error;
+        using Encoder = BinaryText::Ascii85::Encoder;
+        using Decoder = BinaryText::Ascii85::Decoder;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr BinaryText::Algorithm algorithm = BinaryText::Algorithm::ASCII_85;
+
+        static std::string Name(const O& o_)
+        {
+            return std::format("ascii85/{}{}", o_.foldSpaces ? "fold-spaces" : "no-fold-spaces", o_.adobeMode ? "+adobe-mode" : "");
+        }
+        static std::vector<O> MakeOptions()
+        {
+            std::vector<O> options;
+
+            for(const bool foldSpaces : {false, true}) {
+                for(const bool adobeMode : {false, true}) {
+                    options.push_back(O{.foldSpaces = foldSpaces, .adobeMode = adobeMode});
+                }
+            }
+
+            return options;
+        }
+
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Ascii85::EncodeStringToString(s_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O& o_)
+        {
+            return BinaryText::Reference::Ascii85::DecodeStringToString(s_, o_.foldSpaces, o_.adobeMode);
+        }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Ascii85::EncodeStringToString(s_, o_.foldSpaces, o_.adobeMode, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::Ascii85::EncodeByteBufferToString(b_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Ascii85::EncodeByteBufferToString(v_, o_.foldSpaces, o_.adobeMode, t_);
+        }
+        static std::string EncodeByteBufferViewsToString(const std::span<const BinaryText::ByteBufferView<unsigned char>> v_, const O& o_)
+        {
+            return BinaryText::Ascii85::EncodeByteBufferViewsToString(v_, o_.foldSpaces, o_.adobeMode);
+        }
+        static constexpr bool isWrappedEncodedSizeExact = false;
+        static std::size_t WrappedEncodedSize(const std::size_t n_, const BinaryText::LineWrapping& w_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::MaximumWrappedEncodedSize(n_, w_, o_.adobeMode);
+        }
+        static std::string EncodeStringToString(const std::string_view s_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Ascii85::EncodeStringToString(s_, w_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const BinaryText::LineWrapping& w_, const O& o_)
+        {
+            return BinaryText::Ascii85::EncodeByteBufferToString(v_, w_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const BinaryText::LineWrapping& w_,
+                                  const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::Encode(i_, e_, c_, w_, o_.foldSpaces, o_.adobeMode);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_)
+        {
+            BinaryText::Ascii85::EncodeInto(s_, e_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::Encode(i_, e_, c_, o_.foldSpaces, o_.adobeMode);
+        }
+        static Encoder MakeEncoder(const O& o_) { return Encoder(o_.foldSpaces, o_.adobeMode); }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::Ascii85::DecodeStringToString(s_, o_.foldSpaces, o_.adobeMode, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O& o_, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Ascii85::DecodeStringToByteBuffer<unsigned char>(s_, o_.foldSpaces, o_.adobeMode, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::Ascii85::DecodeByteBufferToByteBuffer<unsigned char>(b_, o_.foldSpaces, o_.adobeMode, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            BinaryText::Ascii85::DecodeByteBufferInPlace(b_, o_.foldSpaces, o_.adobeMode);
+        }
+        static bool IsDecodedInPlace(const std::string_view s_, const O& o_)
+        {
+            return s_.find('z') == std::string_view::npos and not (o_.foldSpaces and s_.find('y') != std::string_view::npos);
+        }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::TryDecodeStringToString(s_, o_.foldSpaces, o_.adobeMode);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::TryDecodeStringToByteBuffer<unsigned char>(s_, o_.foldSpaces, o_.adobeMode);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O& o_)
+        {
+            BinaryText::Ascii85::DecodeInto(s_, d_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::Decode(s_, d_, c_, o_.foldSpaces, o_.adobeMode);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::Validate(s_, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::string DecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O& o_)
+        {
+            return BinaryText::Ascii85::DecodeStringToString(s_, BinaryText::ignoreWhitespace, o_.foldSpaces, o_.adobeMode);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace, const O& o_)
+        {
+            return BinaryText::Ascii85::DecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace, o_.foldSpaces, o_.adobeMode);
+        }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, BinaryText::IgnoreWhitespace, const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::TryDecodeStringToString(s_, BinaryText::ignoreWhitespace, o_.foldSpaces, o_.adobeMode);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, BinaryText::IgnoreWhitespace,
+                                                                                                     const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::TryDecodeStringToByteBuffer<unsigned char>(s_, BinaryText::ignoreWhitespace, o_.foldSpaces, o_.adobeMode);
+        }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, BinaryText::IgnoreWhitespace,
+                                  const O& o_) noexcept
+        {
+            return BinaryText::Ascii85::Decode(s_, d_, c_, BinaryText::ignoreWhitespace, o_.foldSpaces, o_.adobeMode);
+        }
+        static Decoder MakeDecoder(const O& o_) { return Decoder(o_.foldSpaces, o_.adobeMode); }
+    };
+
+    /**
+     * Functions of BaseN with a given alphabet, padding is taken from the options. BaseN has no reference of its own, so the reference of the codec with
+     * the standard alphabet of the same size is used with every character translated between the two alphabets. A character outside of the alphabet
+     * becomes a '!', which is outside of every standard alphabet as well. BaseN has no Encoder, Decoder, Codec or vectorized functions to pick, and no
+     * Base16 leniency for an odd trailing digit.
+     *
+     * @tparam alphabet_ Alphabet of BaseN to be checked.
+     * @tparam standardAlphabet_ BaseN Alphabet of the standard codec.
+     * @tparam StandardFunctions Struct of the standard codec above, whose reference is used.
+    */
+    template<BinaryText::BaseN::Alphabet alphabet_, BinaryText::BaseN::Alphabet standardAlphabet_, typename StandardFunctions>
+    struct BaseNFunctions
+    {
+        using Error = BinaryText::BaseN::Error;
+        using O = BinaryText::CodecOptions;
+
+        static constexpr bool hasPadding = alphabet_.characters.size() != 16;
+
+        static std::string Name(const O& o_)
+        {
+            return std::format("basen/{}/{}", std::string_view(alphabet_.characters.data(), alphabet_.characters.size()),
+                               o_.withPadding ? "padding" : "no-padding");
+        }
+        static std::vector<O> MakeOptions() { return hasPadding ? std::vector<O>{O{.withPadding = true}, O{.withPadding = false}} : std::vector<O>{O{}}; }
+
+        /**
+         * @brief Translates characters from one alphabet into another, leaving the padding character as it is.
+         * @param[in] s_ Characters to be translated.
+         * @param[in] from_ Alphabet of the characters.
+         * @param[in] to_ Alphabet the characters are translated into.
+         * @returns Translated characters.
+        */
+        template<std::size_t size_>
+        static std::string Translate(std::string s_, const BinaryText::BaseN::Alphabet<size_>& from_, const BinaryText::BaseN::Alphabet<size_>& to_)
+        {
+            for(char& character : s_) {
+                const unsigned char value(from_.decodeTable[static_cast<unsigned char>(character)]);
+
+                if(character != '=') {
+                    character = (value != BinaryText::Internal::invalidSymbol) ? to_.characters[value] : '!';
+                }
+            }
+
+            return s_;
+        }
+        static std::string ReferenceEncode(const std::string& s_, const O& o_)
+        {
+            try {
+                return Translate(StandardFunctions::ReferenceEncode(s_, o_), standardAlphabet_, alphabet_);
+            } catch(const typename StandardFunctions::Error&) {
+                throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+        }
+        static std::string ReferenceDecode(const std::string& s_, const O& o_)
+        {
+            // Base16 keeps an odd trailing digit, BaseN only decodes whole groups of two characters
+            if(not hasPadding and s_.size() % 2 != 0) {
+                throw Error(Error::Type::STRING_PARSE_ERROR);
+            }
+
+            try {
+                return StandardFunctions::ReferenceDecode(Translate(s_, alphabet_, standardAlphabet_), o_);
+            } catch(const typename StandardFunctions::Error& error_) {
+                throw Error((error_.GetType() == StandardFunctions::Error::Type::STRING_PARSE_ERROR) ? Error::Type::STRING_PARSE_ERROR
+                                                                                                     : Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+            }
+        }
+
+        static std::string EncodeStringToString(const std::string_view s_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::BaseN::EncodeStringToString<alphabet_>(s_, o_.withPadding, t_);
+        }
+        static std::string EncodeByteBufferToString(const BinaryText::ByteBuffer<unsigned char>& b_, const O& o_)
+        {
+            return BinaryText::BaseN::EncodeByteBufferToString<alphabet_>(b_, o_.withPadding);
+        }
+        static std::string EncodeByteBufferViewToString(const BinaryText::ByteBufferView<unsigned char> v_, const O& o_, const std::size_t t_)
+        {
+            return BinaryText::BaseN::EncodeByteBufferToString<alphabet_>(v_, o_.withPadding, t_);
+        }
+        static void EncodeInto(const std::string_view s_, std::string& e_, const O& o_) { BinaryText::BaseN::EncodeInto<alphabet_>(s_, e_, o_.withPadding); }
+        static std::size_t Encode(const std::span<const std::byte> i_, const std::span<char> e_, std::error_code& c_, const O& o_) noexcept
+        {
+            return BinaryText::BaseN::Encode<alphabet_>(i_, e_, c_, o_.withPadding);
+        }
+
+        static std::string DecodeStringToString(const std::string_view s_, const O&, const std::size_t t_)
+        {
+            return BinaryText::BaseN::DecodeStringToString<alphabet_>(s_, t_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeStringToByteBuffer(const std::string_view s_, const O&, std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::BaseN::DecodeStringToByteBuffer<alphabet_, unsigned char>(s_, 1, m_);
+        }
+        static BinaryText::ByteBuffer<unsigned char> DecodeByteBufferToByteBuffer(const BinaryText::ByteBuffer<unsigned char>& b_, const O&,
+                                                                                  std::pmr::memory_resource* m_ = nullptr)
+        {
+            return BinaryText::BaseN::DecodeByteBufferToByteBuffer<alphabet_, unsigned char>(b_, 1, m_);
+        }
+        static void DecodeByteBufferInPlace(BinaryText::ByteBuffer<unsigned char>& b_, const O&) { BinaryText::BaseN::DecodeByteBufferInPlace<alphabet_>(b_); }
+        static BinaryText::Result<std::string> TryDecodeStringToString(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::BaseN::TryDecodeStringToString<alphabet_>(s_);
+        }
+        static BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> TryDecodeStringToByteBuffer(const std::string_view s_, const O&) noexcept
+        {
+            return BinaryText::BaseN::TryDecodeStringToByteBuffer<alphabet_, unsigned char>(s_);
+        }
+        static void DecodeInto(const std::string_view s_, std::string& d_, const O&) { BinaryText::BaseN::DecodeInto<alphabet_>(s_, d_); }
+        static std::size_t Decode(const std::string_view s_, const std::span<std::byte> d_, std::error_code& c_, const O&) noexcept
+        {
+            return BinaryText::BaseN::Decode<alphabet_>(s_, d_, c_);
+        }
+        static BinaryText::ValidationResult Validate(const std::string_view s_, const O&) noexcept { return BinaryText::BaseN::Validate<alphabet_>(s_); }
+    };
+
+    /**
+     * Creates the Variant of a codec with fixed options. Every way of encoding and decoding of the codec becomes a Function: the string, ByteBuffer,
+     * ByteBufferView, in-place, caller buffer and error code functions, the Encoder and Decoder one piece at a time, the Codec, the Transcoder into
+     * Base16 and the vectorized functions of every InstructionSet the processor supports (NONE being the scalar code on its own).
+     *
+     * @tparam Functions One of the structs above.
+     * @param[in] options_ Options of the codec.
+     * @returns The Variant.
+    */
+    template<typename Functions>
+    Variant MakeVariant(const BinaryText::CodecOptions& options_)
+    {
+        using Error = typename Functions::Error;
+
+        const BinaryText::CodecOptions o(options_);
+        Variant variant{Functions::Name(o), {}, {}, {}, {}, {}, {}};
+        const auto addEncoder([&variant](const std::string& name_, std::function<Outcome(std::string_view)> run_) {
+            variant.encoders.push_back(Function{name_, std::move(run_)});
+        });
+        const auto addDecoder([&variant](const std::string& name_, std::function<Outcome(std::string_view)> run_, const bool isSizeOnly_ = false) {
+            variant.decoders.push_back(Function{name_, std::move(run_), isSizeOnly_});
+        });
+
+        variant.referenceEncode = Function{"Reference", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::ReferenceEncode(std::string(s_), o); });
+        }};
+        variant.referenceDecode = Function{"Reference", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::ReferenceDecode(std::string(s_), o); });
+        }};
+
+        addEncoder("EncodeStringToString", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::EncodeStringToString(s_, o, 1); });
+        });
+        addEncoder("EncodeStringToString/threads", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::EncodeStringToString(s_, o, threadCount); });
+        });
+        addEncoder("EncodeByteBufferToString", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::EncodeByteBufferToString(MakeByteBuffer(s_), o); });
+        });
+        // The bytes are viewed inside a bigger ByteBuffer, so that the Subview does not start at the beginning of its buffer
+        addEncoder("EncodeByteBufferToString/subview", [o](const std::string_view s_) {
+            return Catch<Error>([&]() {
+                const BinaryText::ByteBuffer<unsigned char> byteBuffer(MakeByteBuffer(std::string("head").append(s_).append("tail")));
+                const BinaryText::ByteBufferView<unsigned char> byteBufferView(byteBuffer);
+
+                return Functions::EncodeByteBufferViewToString(byteBufferView.Subview(4, s_.size()), o, threadCount);
+            });
+        });
+        // Two Subviews of a ByteBuffer with a view of a vector between them, split so that the groups of the codecs straddle the views
+        if constexpr(requires { Functions::EncodeByteBufferViewsToString({}, o); }) {
+            addEncoder("EncodeByteBufferViewsToString", [o](const std::string_view s_) {
+                return Catch<Error>([&]() {
+                    const BinaryText::ByteBuffer<unsigned char> byteBuffer(MakeByteBuffer(std::string("head").append(s_)));
+                    const BinaryText::ByteBufferView<unsigned char> byteBufferView(byteBuffer);
+                    const std::size_t middleStart(s_.size() / 3);
+                    const std::size_t middleEnd((s_.size() * 2) / 3);
+                    const std::vector<unsigned char> middle(s_.begin() + static_cast<std::ptrdiff_t>(middleStart),
+                                                            s_.begin() + static_cast<std::ptrdiff_t>(middleEnd));
+                    const std::array<BinaryText::ByteBufferView<unsigned char>, 3> byteBufferViews{byteBufferView.Subview(4, middleStart),
+                                                                                                   BinaryText::ByteBufferView<unsigned char>(std::span(middle)),
+                                                                                                   byteBufferView.Subview(4 + middleEnd)};
+
+                    return Functions::EncodeByteBufferViewsToString(byteBufferViews, o);
+                });
+            });
+        }
+        addEncoder("EncodeInto", [o](const std::string_view s_) {
+            return Catch<Error>([&]() {
+                std::string encodedString("stale");
+
+                Functions::EncodeInto(s_, encodedString, o);
+
+                return encodedString;
+            });
+        });
+        addEncoder("Encode", [o](const std::string_view s_) {
+            std::vector<char> buffer((s_.size() * 2) + 16);
+            std::error_code errorCode;
+            const std::size_t size(Functions::Encode(std::as_bytes(std::span(s_)), buffer, errorCode, o));
+
+            return FromErrorCode(std::string_view(buffer.data(), size), errorCode);
+        });
+
+        if constexpr(requires { Functions::algorithm; }) {
+            for(const std::size_t pieceSize : {1, 7}) {
+                addEncoder(std::format("Encoder/{}", pieceSize), [o, pieceSize](const std::string_view s_) {
+                    return Catch<Error>([&]() { return EncodeInPieces(Functions::MakeEncoder(o), s_, pieceSize); });
+                });
+            }
+
+            addEncoder("Codec", [o](const std::string_view s_) {
+                return CatchCodec<Error>([&]() { return std::string(BinaryText::Codec(Functions::algorithm, o).Encode(s_)); });
+            });
+        }
+
+        if constexpr(requires { Functions::EncodeWith(nullptr, 0, nullptr, o, InstructionSet::NONE); }) {
+            for(const InstructionSet instructionSet : GetInstructionSets()) {
+                addEncoder(std::format("kernels/{}", GetName(instructionSet)), [o, instructionSet](const std::string_view s_) {
+                    std::vector<unsigned char> input(s_.begin(), s_.end());
+                    std::vector<char> buffer((s_.size() * 2) + 16);
+
+                    return Outcome{std::string(buffer.data(), Functions::EncodeWith(input.data(), input.size(), buffer.data(), o, instructionSet)), -1};
+                });
+            }
+        }
+
+        addDecoder("DecodeStringToString", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::DecodeStringToString(s_, o, 1); });
+        });
+        addDecoder("DecodeStringToString/threads", [o](const std::string_view s_) {
+            return Catch<Error>([&]() { return Functions::DecodeStringToString(s_, o, threadCount); });
+        });
+        addDecoder("DecodeStringToByteBuffer", [o](const std::string_view s_) {
+            return Catch<Error>([&]() {
+                const BinaryText::ByteBuffer<unsigned char> byteBuffer(Functions::DecodeStringToByteBuffer(s_, o));
+
+                return std::string(byteBuffer.begin(), byteBuffer.end());
+            });
+        });
+        addDecoder("DecodeByteBufferToByteBuffer", [o](const std::string_view s_) {
+            return Catch<Error>([&]() {
+                const BinaryText::ByteBuffer<unsigned char> byteBuffer(Functions::DecodeByteBufferToByteBuffer(MakeByteBuffer(s_), o));
+
+                return std::string(byteBuffer.begin(), byteBuffer.end());
+            });
+        });
+        // The decoded ByteBuffer has to allocate from the given memory resource, not from the one of the encoded ByteBuffer or the default one, or else
+        // it counts as the Error::Type -3
+        for(const bool isFromByteBuffer : {false, true}) {
+            const std::string name(isFromByteBuffer ? "DecodeByteBufferToByteBuffer/pmr" : "DecodeStringToByteBuffer/pmr");
+
+            addDecoder(name, [o, isFromByteBuffer](const std::string_view s_) {
+                CountingMemoryResource encodedMemoryResource;
+                CountingMemoryResource memoryResource;
+                bool isFromMemoryResource(true);
+                const Outcome outcome(Catch<Error>([&]() {
+                    const BinaryText::ByteBuffer<unsigned char> byteBuffer(
+                        isFromByteBuffer ? Functions::DecodeByteBufferToByteBuffer(MakeByteBuffer(s_, &encodedMemoryResource), o, &memoryResource)
+                                         : Functions::DecodeStringToByteBuffer(s_, o, &memoryResource));
+
+                    isFromMemoryResource = byteBuffer.GetMemoryResource() == &memoryResource
+                                           and (byteBuffer.IsEmpty() or memoryResource.GetAllocationCount() != 0);
+
+                    return std::string(byteBuffer.begin(), byteBuffer.end());
+                }));
+
+                return isFromMemoryResource ? outcome : Outcome{std::string(), -3};
+            });
+        }
+        // The decoded bytes have to overwrite the characters, a ByteBuffer that got a buffer of its own counts as the Error::Type -3
+        addDecoder("DecodeByteBufferInPlace", [o](const std::string_view s_) {
+            BinaryText::ByteBuffer<unsigned char> byteBuffer(MakeByteBuffer(s_));
+            const unsigned char* const characters(byteBuffer.GetBuffer());
+            const Outcome outcome(Catch<Error>([&]() {
+                Functions::DecodeByteBufferInPlace(byteBuffer, o);
+
+                return std::string(byteBuffer.begin(), byteBuffer.end());
+            }));
+            bool isDecodedInPlace(true);
+
+            if constexpr(requires { Functions::IsDecodedInPlace(s_, o); }) {
+                isDecodedInPlace = Functions::IsDecodedInPlace(s_, o);
+            }
+
+            if(isDecodedInPlace and not byteBuffer.IsEmpty() and byteBuffer.GetBuffer() != characters) {
+                return Outcome{std::string(), -3};
+            }
+
+            return outcome;
+        });
+        addDecoder("TryDecodeStringToString", [o](const std::string_view s_) {
+            const BinaryText::Result<std::string> result(Functions::TryDecodeStringToString(s_, o));
+
+            return FromErrorCode(result.value, result.errorCode);
+        });
+        addDecoder("TryDecodeStringToByteBuffer", [o](const std::string_view s_) {
+            const BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> result(Functions::TryDecodeStringToByteBuffer(s_, o));
+
+            return FromErrorCode(std::string(result.value.begin(), result.value.end()), result.errorCode);
+        });
+        addDecoder("DecodeInto", [o](const std::string_view s_) {
+            return Catch<Error>([&]() {
+                std::string decodedString("stale");
+
+                Functions::DecodeInto(s_, decodedString, o);
+
+                return decodedString;
+            });
+        });
+        addDecoder("Decode", [o](const std::string_view s_) {
+            std::vector<std::byte> buffer((s_.size() * 4) + 4);
+            std::error_code errorCode;
+            const std::size_t size(Functions::Decode(s_, buffer, errorCode, o));
+
+            return FromErrorCode(ToString(std::span<const std::byte>(buffer.data(), size)), errorCode);
+        });
+        addDecoder(
+            "Validate",
+            [o](const std::string_view s_) {
+                const BinaryText::ValidationResult result(Functions::Validate(s_, o));
+
+                return result.isValid ? Outcome{std::string(result.decodedSize, '\0'), -1}
+                                      : Outcome{std::string(), static_cast<int>(Error::Type::STRING_PARSE_ERROR)};
+            },
+            true);
+
+        if constexpr(requires { Functions::algorithm; }) {
+            for(const std::size_t pieceSize : {1, 7}) {
+                addDecoder(std::format("Decoder/{}", pieceSize), [o, pieceSize](const std::string_view s_) {
+                    return Catch<Error>([&]() { return DecodeInPieces(Functions::MakeDecoder(o), s_, pieceSize); });
+                });
+            }
+
+            addDecoder("Codec", [o](const std::string_view s_) {
+                return CatchCodec<Error>([&]() { return std::string(BinaryText::Codec(Functions::algorithm, o).Decode(s_)); });
+            });
+            addDecoder("Transcode", [o](const std::string_view s_) {
+                return Catch<Error>([&]() {
+                    const std::string transcodedString(
+                        BinaryText::Transcode<typename Functions::Decoder, BinaryText::Base16::Encoder>(s_, Functions::MakeDecoder(o)));
+
+                    return BinaryText::Base16::DecodeStringToString(transcodedString);
+                });
+            });
+        }
+
+        if constexpr(requires { Functions::DecodeWith(nullptr, 0, nullptr, o, InstructionSet::NONE); }) {
+            for(const InstructionSet instructionSet : GetInstructionSets()) {
+                addDecoder(std::format("kernels/{}", GetName(instructionSet)), [o, instructionSet](const std::string_view s_) {
+                    std::vector<unsigned char> buffer(s_.size() + 4);
+                    const BinaryText::Internal::DecodeResult result(Functions::DecodeWith(s_.data(), s_.size(), buffer.data(), o, instructionSet));
+
+                    return result.isValid ? Outcome{std::string(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(result.size)), -1}
+                                          : Outcome{std::string(), static_cast<int>(Error::Type::STRING_PARSE_ERROR)};
+                });
+            }
+        }
+
+        // The line-wrapping encoders are checked against the reference encoding split into lines, with the size function checked by Encode
+        if constexpr(requires { Functions::WrappedEncodedSize(0, BinaryText::mimeLineWrapping, o); }) {
+            for(const BinaryText::LineWrapping lineWrapping : {BinaryText::mimeLineWrapping, BinaryText::pemLineWrapping, BinaryText::LineWrapping{5, "\r\n"},
+                                                               BinaryText::LineWrapping{1, "\n"}, BinaryText::LineWrapping{0, "\n"}}) {
+                const std::string name(std::format("{}/{}", lineWrapping.lineLength, (lineWrapping.separator == "\r\n") ? "crlf" : "lf"));
+                Group group{Function{"Reference/" + name, [o, lineWrapping](const std::string_view s_) {
+                                Outcome outcome(Catch<Error>([&]() { return Functions::ReferenceEncode(std::string(s_), o); }));
+
+                                outcome.output = Wrap(outcome.output, lineWrapping);
+
+                                return outcome;
+                            }},
+                            {}};
+
+                group.functions.push_back(Function{"EncodeStringToString/" + name, [o, lineWrapping](const std::string_view s_) {
+                    return Catch<Error>([&]() { return Functions::EncodeStringToString(s_, lineWrapping, o); });
+                }});
+                group.functions.push_back(Function{"EncodeByteBufferToString/subview/" + name, [o, lineWrapping](const std::string_view s_) {
+                    return Catch<Error>([&]() {
+                        const BinaryText::ByteBuffer<unsigned char> byteBuffer(MakeByteBuffer(std::string("head").append(s_)));
+                        const BinaryText::ByteBufferView<unsigned char> byteBufferView(byteBuffer);
+
+                        return Functions::EncodeByteBufferViewToString(byteBufferView.Subview(4), lineWrapping, o);
+                    });
+                }});
+                // The buffer has exactly the size the size function asks for, an exact size that does not match the output counts as the Error::Type -3
+                group.functions.push_back(Function{"Encode/" + name, [o, lineWrapping](const std::string_view s_) {
+                    std::vector<char> buffer(Functions::WrappedEncodedSize(s_.size(), lineWrapping, o));
+                    std::error_code errorCode;
+                    const std::size_t size(Functions::Encode(std::as_bytes(std::span(s_)), buffer, errorCode, lineWrapping, o));
+
+                    if(Functions::isWrappedEncodedSizeExact and not errorCode and size != buffer.size()) {
+                        return Outcome{std::string(), -3};
+                    }
+
+                    return FromErrorCode(std::string_view(buffer.data(), size), errorCode);
+                }});
+                variant.encoderGroups.push_back(std::move(group));
+            }
+        }
+
+        // The decoders that skip whitespace are checked against the reference decoding of the input without whitespace
+        if constexpr(requires { Functions::DecodeStringToString(std::string_view(), BinaryText::ignoreWhitespace, o); }) {
+            Group group{Function{"Reference/ignore-whitespace", [o](const std::string_view s_) {
+                            return Catch<Error>([&]() { return Functions::ReferenceDecode(StripWhitespace(s_), o); });
+                        }},
+                        {}};
+
+            group.functions.push_back(Function{"DecodeStringToString/ignore-whitespace", [o](const std::string_view s_) {
+                return Catch<Error>([&]() { return Functions::DecodeStringToString(s_, BinaryText::ignoreWhitespace, o); });
+            }});
+            group.functions.push_back(Function{"DecodeStringToByteBuffer/ignore-whitespace", [o](const std::string_view s_) {
+                return Catch<Error>([&]() {
+                    const BinaryText::ByteBuffer<unsigned char> byteBuffer(Functions::DecodeStringToByteBuffer(s_, BinaryText::ignoreWhitespace, o));
+
+                    return std::string(byteBuffer.begin(), byteBuffer.end());
+                });
+            }});
+            group.functions.push_back(Function{"TryDecodeStringToString/ignore-whitespace", [o](const std::string_view s_) {
+                const BinaryText::Result<std::string> result(Functions::TryDecodeStringToString(s_, BinaryText::ignoreWhitespace, o));
+
+                return FromErrorCode(result.value, result.errorCode);
+            }});
+            group.functions.push_back(Function{"TryDecodeStringToByteBuffer/ignore-whitespace", [o](const std::string_view s_) {
+                const BinaryText::Result<BinaryText::ByteBuffer<unsigned char>> result(
+                    Functions::TryDecodeStringToByteBuffer(s_, BinaryText::ignoreWhitespace, o));
+
+                return FromErrorCode(std::string(result.value.begin(), result.value.end()), result.errorCode);
+            }});
+            group.functions.push_back(Function{"Decode/ignore-whitespace", [o](const std::string_view s_) {
+                std::vector<std::byte> buffer((s_.size() * 4) + 4);
+                std::error_code errorCode;
+                const std::size_t size(Functions::Decode(s_, buffer, errorCode, BinaryText::ignoreWhitespace, o));
+
+                return FromErrorCode(ToString(std::span<const std::byte>(buffer.data(), size)), errorCode);
+            }});
+            variant.decoderGroups.push_back(std::move(group));
+        }
+
+        return variant;
+    }
+
+    /**
+     * @brief Creates the Variants of every codec with every combination of its options.
+     * @returns The Variants.
+    */
+    std::vector<Variant> MakeVariants()
+    {
+        std::vector<Variant> variants;
+
+        const auto addVariants([&variants]<typename Functions>(const Functions&) {
+            for(const BinaryText::CodecOptions& options : Functions::MakeOptions()) {
+                variants.push_back(MakeVariant<Functions>(options));
+            }
+        });
+
+        addVariants(Base16Functions());
+        addVariants(Base32Functions());
+        addVariants(Base32HexFunctions());
+        addVariants(Base64Functions());
+        addVariants(Base64UrlFunctions());
+        addVariants(Ascii85Functions());
+        addVariants(BaseNFunctions<BinaryText::BaseN::base16Alphabet, BinaryText::BaseN::base16Alphabet, Base16Functions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::base32Alphabet, BinaryText::BaseN::base32Alphabet, Base32Functions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::base32HexAlphabet, BinaryText::BaseN::base32HexAlphabet, Base32HexFunctions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::base64Alphabet, BinaryText::BaseN::base64Alphabet, Base64Functions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::base64UrlAlphabet, BinaryText::BaseN::base64UrlAlphabet, Base64UrlFunctions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::crockfordBase32Alphabet, BinaryText::BaseN::base32Alphabet, Base32Functions>());
+        addVariants(BaseNFunctions<BinaryText::BaseN::zBase32Alphabet, BinaryText::BaseN::base32Alphabet, Base32Functions>());
+
+        return variants;
+    }
+
+    /**
+     * @brief Describes an Outcome for a mismatch description, long outputs are cut short.
+     * @param[in] outcome_ Outcome to be described.
+     * @returns Description of the Outcome.
+    */
+    std::string Describe(const Outcome& outcome_)
+    {
+        if(outcome_.errorType != -1) {
+            return std::format("Error::Type {}", outcome_.errorType);
+        }
+
+        std::string description(std::format("{} bytes \"", outcome_.output.size()));
+
+        for(const char character : std::string_view(outcome_.output).substr(0, 32)) {
+            const unsigned char byte(static_cast<unsigned char>(character));
+
+            description += (byte >= 0x20 and byte < 0x7F and byte != '"' and byte != '\\') ? std::string(1, character) : std::format("\\x{:02X}", byte);
+        }
+
+        return description + ((outcome_.output.size() > 32) ? "...\"" : "\"");
+    }
+
+    /**
+     * @brief Runs every function against the reference on one input and adds a description of every mismatch.
+     * @param[in] variantName_ Name of the Variant.
+     * @param[in] inputName_ Which form of the input it is.
+     * @param[in] input_ Input to be encoded or decoded.
+     * @param[in] reference_ Reference function.
+     * @param[in] functions_ Functions to be checked.
+     * @param[out] mismatches_ Where the descriptions are added to.
+     * @returns Outcome of the reference.
+    */
+    Outcome Compare(const std::string& variantName_, const std::string_view inputName_, const std::string_view input_, const Function& reference_,
+                    const std::vector<Function>& functions_, std::vector<std::string>& mismatches_)
+    {
+        const Outcome reference(reference_.run(input_));
+
+        for(const Function& function : functions_) {
+            Outcome outcome(function.run(input_));
+            Outcome expected(reference);
+
+            if(function.isSizeOnly) {
+                outcome.output.assign(outcome.output.size(), '\0');
+                expected.output.assign(expected.output.size(), '\0');
+            }
+
+            if(outcome != expected) {
+                mismatches_.push_back(std::format("{} {} of {} ({}): {} instead of {}", variantName_, function.name, inputName_,
+                                                  Describe(Outcome{std::string(input_), -1}), Describe(outcome), Describe(expected)));
+            }
+        }
+
+        return reference;
+    }
+
+    std::vector<std::string> Check(const std::span<const unsigned char> input_)
+    {
+        static const std::vector<Variant> variants(MakeVariants());
+
+        const std::string_view input(ToString(input_));
+        std::vector<std::string> mismatches;
+
+        for(const Variant& variant : variants) {
+            const auto compareDecoders([&variant, &mismatches](const std::string_view inputName_, const std::string_view string_) {
+                Compare(variant.name, inputName_, string_, variant.referenceDecode, variant.decoders, mismatches);
+
+                for(const Group& group : variant.decoderGroups) {
+                    Compare(variant.name, inputName_, string_, group.reference, group.functions, mismatches);
+                }
+            });
+            const Outcome encoded(Compare(variant.name, "encoding", input, variant.referenceEncode, variant.encoders, mismatches));
+
+            for(const Group& group : variant.encoderGroups) {
+                Compare(variant.name, "encoding", input, group.reference, group.functions, mismatches);
+            }
+
+            compareDecoders("decoding", input);
+
+            if(encoded.errorType != -1 or encoded.output.empty()) {
+                continue;
+            }
+
+            // The encoded input is decoded intact, with a character replaced by one that depends on the input, cut short by a character and split into
+            // lines by every kind of whitespace, with whitespace before the first and after the last line
+            std::string changedString(encoded.output);
+            const std::size_t position((input_.empty() ? 0 : input_[0]) % changedString.size());
+
+            changedString[position] = static_cast<char>(input_.empty() ? '=' : input_[input_.size() - 1]);
+
+            compareDecoders("its encoding", encoded.output);
+            compareDecoders("its changed encoding", changedString);
+            compareDecoders("its cut encoding", std::string_view(encoded.output).substr(0, encoded.output.size() - 1));
+            compareDecoders("its spaced encoding", " " + Wrap(encoded.output, BinaryText::LineWrapping{5, "\t\n\v\f\r "}) + "\r\n");
+        }
+
+        return mismatches;
+    }
+}
\ No newline at end of file
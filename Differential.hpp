@@ -0,0 +1,49 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+/// @brief A namespace that checks the optimized functions of BinaryText.hpp against BinaryText::Reference, for the tests and the fuzz target.
+namespace Differential
+{
+    /**
+     * Checks an input against every codec and option combination. The input is encoded by every encoding function, with and without line wrapping,
+     * and decoded by every decoding function as it is as well as in the form of its reference encoding (intact, with a character replaced, cut short and
+     * with whitespace inserted). Every function has to give the same output as the reference or fail with the same Error::Type. The
+     * compile-time functions and BinaryText::Files are checked by Tests.cpp instead.
+     *
+     * @param[in] input_ Bytes to be checked.
+     * @returns A description of every mismatch, empty if every function agreed with the reference.
+    */
+    std::vector<std::string> Check(const std::span<const unsigned char> input_);
+}
\ No newline at end of file
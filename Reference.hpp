@@ -0,0 +1,1774 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+#pragma once
+
+#include <bitset>    // std::bitset
+#include <cmath>     // std::ceil / std::floor
+#include <iterator>  // std::next
+#include <stdexcept> // std::length_error
+#include <string>    // std::string
+
+#include "BinaryText.hpp"
+
+namespace BinaryText
+{
+    /**
+     * The original implementations of the encoding and decoding functions, one character at a time through std::bitset. They are slow and are only
+     * kept so that the differential tests and the fuzz target can check the optimized functions against them, they are not part of BinaryText.hpp.
+    */
+    namespace Reference
+    {
+        /// @brief Reference Base16 encoding and decoding, throwing the same BinaryText::Base16::Error.
+        namespace Base16
+        {
+            using Error = BinaryText::Base16::Error;
+            using Case = BinaryText::Base16::Case;
+
+            /**
+             * @brief Encodes a not-encoded string into a Base16 encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] case_ Case to be used (mixed case not supported).
+             * @throws BinaryText::Base16::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const Case case_ = Case::UPPERCASE)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(string_.size() * 2);
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(string_.cbegin()); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize> bitset(static_cast<unsigned char>(*iter));
+
+                    for(unsigned int i(0U); i < 2U; ++i) {
+                        std::bitset<charSize / 2> partialBitset;
+
+                        if(i == 0U) {
+                            partialBitset = std::bitset<charSize / 2>((bitset >> 4).to_ullong());
+                        } else {
+                            partialBitset = std::bitset<charSize / 2>(((bitset << 4) >> 4).to_ullong());
+                        }
+
+                        switch(case_) {
+                            case Case::UPPERCASE: {
+                                switch(partialBitset.to_ullong()) {
+                                    case 0B0000ULL: encodedString.append(1, '0'); break;
+                                    case 0B0001ULL: encodedString.append(1, '1'); break;
+                                    case 0B0010ULL: encodedString.append(1, '2'); break;
+                                    case 0B0011ULL: encodedString.append(1, '3'); break;
+                                    case 0B0100ULL: encodedString.append(1, '4'); break;
+                                    case 0B0101ULL: encodedString.append(1, '5'); break;
+                                    case 0B0110ULL: encodedString.append(1, '6'); break;
+                                    case 0B0111ULL: encodedString.append(1, '7'); break;
+                                    case 0B1000ULL: encodedString.append(1, '8'); break;
+                                    case 0B1001ULL: encodedString.append(1, '9'); break;
+                                    case 0B1010ULL: encodedString.append(1, 'A'); break;
+                                    case 0B1011ULL: encodedString.append(1, 'B'); break;
+                                    case 0B1100ULL: encodedString.append(1, 'C'); break;
+                                    case 0B1101ULL: encodedString.append(1, 'D'); break;
+                                    case 0B1110ULL: encodedString.append(1, 'E'); break;
+                                    case 0B1111ULL: encodedString.append(1, 'F'); break;
+                                    default: Internal::UnreachableTerminate();
+                                }
+
+                                break;
+                            }
+                            case Case::LOWERCASE: {
+                                switch(partialBitset.to_ullong()) {
+                                    case 0B0000ULL: encodedString.append(1, '0'); break;
+                                    case 0B0001ULL: encodedString.append(1, '1'); break;
+                                    case 0B0010ULL: encodedString.append(1, '2'); break;
+                                    case 0B0011ULL: encodedString.append(1, '3'); break;
+                                    case 0B0100ULL: encodedString.append(1, '4'); break;
+                                    case 0B0101ULL: encodedString.append(1, '5'); break;
+                                    case 0B0110ULL: encodedString.append(1, '6'); break;
+                                    case 0B0111ULL: encodedString.append(1, '7'); break;
+                                    case 0B1000ULL: encodedString.append(1, '8'); break;
+                                    case 0B1001ULL: encodedString.append(1, '9'); break;
+                                    case 0B1010ULL: encodedString.append(1, 'a'); break;
+                                    case 0B1011ULL: encodedString.append(1, 'b'); break;
+                                    case 0B1100ULL: encodedString.append(1, 'c'); break;
+                                    case 0B1101ULL: encodedString.append(1, 'd'); break;
+                                    case 0B1110ULL: encodedString.append(1, 'e'); break;
+                                    case 0B1111ULL: encodedString.append(1, 'f'); break;
+                                    default: Internal::UnreachableTerminate();
+                                }
+
+                                break;
+                            }
+                            case Case::MIXED: throw Error(Error::Type::INVALID_CASE_ERROR);
+                            default: throw Error(Error::Type::INVALID_CASE_ERROR);
+                        }
+                    }
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Base16 encoded string into a decoded string. Whitespace and newline characters are ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @param[in] case_ Case to be used. The default is mixed case.
+             * @throws BinaryText::Base16::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_, const Case case_ = Case::MIXED)
+            {
+                using Internal::charSize;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(encodedString_.size() / 2);
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                    if(*iter == ' ' or *iter == '\n') {
+                        continue;
+                    } else {
+                        std::bitset<charSize> bitset;
+                        unsigned int counter(0U);
+
+                        for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
+                            if(*jter == ' ' or *jter == '\n') {
+                                if(std::next(jter, 1) == encodedString_.cend()) {
+                                    break;
+                                } else {
+                                    std::advance(iter, 1);
+
+                                    continue;
+                                }
+                            } else {
+                                counter += 1U;
+                                bitset <<= charSize / 2;
+
+                                switch(case_) {
+                                    case Case::MIXED: {
+                                        switch(*jter) {
+                                            case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
+                                            case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
+                                            case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
+                                            case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
+                                            case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
+                                            case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
+                                            case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
+                                            case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
+                                            case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
+                                            case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
+                                            case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
+                                            case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
+                                            case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
+                                            case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
+                                            case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
+                                            case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
+                                            case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
+                                            case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
+                                            case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
+                                            case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
+                                            case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
+                                            case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
+                                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                                        }
+
+                                        break;
+                                    }
+                                    case Case::UPPERCASE: {
+                                        switch(*jter) {
+                                            case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
+                                            case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
+                                            case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
+                                            case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
+                                            case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
+                                            case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
+                                            case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
+                                            case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
+                                            case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
+                                            case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
+                                            case 'A': bitset |= std::bitset<charSize>(0B1010ULL); break;
+                                            case 'B': bitset |= std::bitset<charSize>(0B1011ULL); break;
+                                            case 'C': bitset |= std::bitset<charSize>(0B1100ULL); break;
+                                            case 'D': bitset |= std::bitset<charSize>(0B1101ULL); break;
+                                            case 'E': bitset |= std::bitset<charSize>(0B1110ULL); break;
+                                            case 'F': bitset |= std::bitset<charSize>(0B1111ULL); break;
+                                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                                        }
+
+                                        break;
+                                    }
+                                    case Case::LOWERCASE: {
+                                        switch(*jter) {
+                                            case '0': bitset |= std::bitset<charSize>(0B0000ULL); break;
+                                            case '1': bitset |= std::bitset<charSize>(0B0001ULL); break;
+                                            case '2': bitset |= std::bitset<charSize>(0B0010ULL); break;
+                                            case '3': bitset |= std::bitset<charSize>(0B0011ULL); break;
+                                            case '4': bitset |= std::bitset<charSize>(0B0100ULL); break;
+                                            case '5': bitset |= std::bitset<charSize>(0B0101ULL); break;
+                                            case '6': bitset |= std::bitset<charSize>(0B0110ULL); break;
+                                            case '7': bitset |= std::bitset<charSize>(0B0111ULL); break;
+                                            case '8': bitset |= std::bitset<charSize>(0B1000ULL); break;
+                                            case '9': bitset |= std::bitset<charSize>(0B1001ULL); break;
+                                            case 'a': bitset |= std::bitset<charSize>(0B1010ULL); break;
+                                            case 'b': bitset |= std::bitset<charSize>(0B1011ULL); break;
+                                            case 'c': bitset |= std::bitset<charSize>(0B1100ULL); break;
+                                            case 'd': bitset |= std::bitset<charSize>(0B1101ULL); break;
+                                            case 'e': bitset |= std::bitset<charSize>(0B1110ULL); break;
+                                            case 'f': bitset |= std::bitset<charSize>(0B1111ULL); break;
+                                            default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                                        }
+
+                                        break;
+                                    }
+                                    default: throw Error(Error::Type::INVALID_CASE_ERROR);
+                                }
+
+                                if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 2)) {
+                                    iter = jter;
+
+                                    break;
+                                }
+                            }
+                        }
+
+                        switch(counter) {
+                            case 2U: break;
+                            case 1U: bitset <<= charSize / 2; break;
+                            default: Internal::UnreachableTerminate();
+                        }
+
+                        decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+
+        /// @brief Reference Base32 encoding and decoding, throwing the same BinaryText::Base32::Error.
+        namespace Base32
+        {
+            using Error = BinaryText::Base32::Error;
+
+            /**
+             * @brief Encodes a not-encoded string into a Base32 encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+             * @throws BinaryText::Base32::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 5.0) * 8.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize * 5> bitset;
+                    unsigned int counter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
+                        counter += 1U;
+                        bitset <<= charSize;
+                        bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+
+                        if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 5)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(counter) {
+                        case 5U: counter = 8U; break;
+                        case 4U: {
+                            bitset <<= charSize;
+                            counter = 7U;
+
+                            break;
+                        }
+                        case 3U: {
+                            bitset <<= (charSize * 2);
+                            counter = 5U;
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= (charSize * 3);
+                            counter = 4U;
+
+                            break;
+                        }
+                        case 1U: {
+                            bitset <<= (charSize * 4);
+                            counter = 2U;
+
+                            break;
+                        }
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    for(unsigned int i(1U); i < 9U; ++i) {
+                        if(i > counter) {
+                            if(withPadding_) {
+                                encodedString.append(1, '=');
+                            } else {
+                                break;
+                            }
+                        } else {
+                            std::bitset<(charSize * 5) / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
+
+                            switch(partialBitset.to_ullong()) {
+                                case 0B00000ULL: encodedString.append(1, 'A'); break;
+                                case 0B00001ULL: encodedString.append(1, 'B'); break;
+                                case 0B00010ULL: encodedString.append(1, 'C'); break;
+                                case 0B00011ULL: encodedString.append(1, 'D'); break;
+                                case 0B00100ULL: encodedString.append(1, 'E'); break;
+                                case 0B00101ULL: encodedString.append(1, 'F'); break;
+                                case 0B00110ULL: encodedString.append(1, 'G'); break;
+                                case 0B00111ULL: encodedString.append(1, 'H'); break;
+                                case 0B01000ULL: encodedString.append(1, 'I'); break;
+                                case 0B01001ULL: encodedString.append(1, 'J'); break;
+                                case 0B01010ULL: encodedString.append(1, 'K'); break;
+                                case 0B01011ULL: encodedString.append(1, 'L'); break;
+                                case 0B01100ULL: encodedString.append(1, 'M'); break;
+                                case 0B01101ULL: encodedString.append(1, 'N'); break;
+                                case 0B01110ULL: encodedString.append(1, 'O'); break;
+                                case 0B01111ULL: encodedString.append(1, 'P'); break;
+                                case 0B10000ULL: encodedString.append(1, 'Q'); break;
+                                case 0B10001ULL: encodedString.append(1, 'R'); break;
+                                case 0B10010ULL: encodedString.append(1, 'S'); break;
+                                case 0B10011ULL: encodedString.append(1, 'T'); break;
+                                case 0B10100ULL: encodedString.append(1, 'U'); break;
+                                case 0B10101ULL: encodedString.append(1, 'V'); break;
+                                case 0B10110ULL: encodedString.append(1, 'W'); break;
+                                case 0B10111ULL: encodedString.append(1, 'X'); break;
+                                case 0B11000ULL: encodedString.append(1, 'Y'); break;
+                                case 0B11001ULL: encodedString.append(1, 'Z'); break;
+                                case 0B11010ULL: encodedString.append(1, '2'); break;
+                                case 0B11011ULL: encodedString.append(1, '3'); break;
+                                case 0B11100ULL: encodedString.append(1, '4'); break;
+                                case 0B11101ULL: encodedString.append(1, '5'); break;
+                                case 0B11110ULL: encodedString.append(1, '6'); break;
+                                case 0B11111ULL: encodedString.append(1, '7'); break;
+                                default: Internal::UnreachableTerminate();
+                            }
+                        }
+                    }
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Base32 encoded string into a decoded string. Whitespace and newline characters are not ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @throws BinaryText::Base32::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_)
+            {
+                using Internal::charSize;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 8.0) * 5.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                    std::bitset<charSize * 5> bitset;
+                    unsigned int paddingCounter(0U);
+                    unsigned int loopCounter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
+                        loopCounter += 1U;
+                        bitset <<= (charSize * 5) / 8;
+
+                        if(paddingCounter > 0U and *jter != '=') {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        } else {
+                            switch(*jter) {
+                                case 'A': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
+                                case 'B': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
+                                case 'C': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
+                                case 'D': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
+                                case 'E': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
+                                case 'F': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
+                                case 'G': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
+                                case 'H': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
+                                case 'I': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
+                                case 'J': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
+                                case 'K': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
+                                case 'L': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
+                                case 'M': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
+                                case 'N': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
+                                case 'O': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
+                                case 'P': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
+                                case 'Q': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
+                                case 'R': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
+                                case 'S': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
+                                case 'T': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
+                                case 'U': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
+                                case 'V': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
+                                case 'W': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
+                                case 'X': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
+                                case 'Y': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
+                                case 'Z': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
+                                case '2': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
+                                case '3': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
+                                case '4': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
+                                case '5': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
+                                case '6': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
+                                case '7': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
+                                case '=': paddingCounter += 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+                        }
+
+                        if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(loopCounter) {
+                        case 8U: break;
+                        case 7U: {
+                            bitset <<= (charSize * 5) / 8;
+
+                            switch(paddingCounter) {
+                                case 5U: paddingCounter = 6U; break;
+                                case 3U: paddingCounter = 4U; break;
+                                case 2U: paddingCounter = 3U; break;
+                                case 0U: paddingCounter = 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 6U: {
+                            bitset <<= ((charSize * 5) / 8) * 2;
+
+                            switch(paddingCounter) {
+                                case 4U: paddingCounter = 6U; break;
+                                case 2U: paddingCounter = 4U; break;
+                                case 1U: paddingCounter = 3U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 5U: {
+                            bitset <<= ((charSize * 5) / 8) * 3;
+
+                            switch(paddingCounter) {
+                                case 3U: paddingCounter = 6U; break;
+                                case 1U: paddingCounter = 4U; break;
+                                case 0U: paddingCounter = 3U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 4U: {
+                            bitset <<= ((charSize * 5) / 8) * 4;
+
+                            switch(paddingCounter) {
+                                case 2U: paddingCounter = 6U; break;
+                                case 0U: paddingCounter = 4U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 3U: {
+                            bitset <<= ((charSize * 5) / 8) * 5;
+
+                            switch(paddingCounter) {
+                                case 1U: paddingCounter = 6U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= ((charSize * 5) / 8) * 6;
+
+                            switch(paddingCounter) {
+                                case 0U: paddingCounter = 6U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    switch(paddingCounter) {
+                        case 0U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+
+                            break;
+                        }
+                        case 1U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+
+                            break;
+                        }
+                        case 3U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+
+                            break;
+                        }
+                        case 4U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+
+                            break;
+                        }
+                        case 6U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()))); break;
+                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    if(paddingCounter > 0U) {
+                        break;
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+
+        /// @brief Reference Base32Hex encoding and decoding, throwing the same BinaryText::Base32Hex::Error.
+        namespace Base32Hex
+        {
+            using Error = BinaryText::Base32Hex::Error;
+
+            /**
+             * @brief Encodes a not-encoded string into a Base32Hex encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+             * @throws BinaryText::Base32Hex::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 5.0) * 8.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize * 5> bitset;
+                    unsigned int counter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
+                        counter += 1U;
+                        bitset <<= charSize;
+                        bitset |= std::bitset<charSize * 5>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+
+                        if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 5)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(counter) {
+                        case 5U: counter = 8U; break;
+                        case 4U: {
+                            bitset <<= charSize;
+                            counter = 7U;
+
+                            break;
+                        }
+                        case 3U: {
+                            bitset <<= (charSize * 2);
+                            counter = 5U;
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= (charSize * 3);
+                            counter = 4U;
+
+                            break;
+                        }
+                        case 1U: {
+                            bitset <<= (charSize * 4);
+                            counter = 2U;
+
+                            break;
+                        }
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    for(unsigned int i(1U); i < 9U; ++i) {
+                        if(i > counter) {
+                            if(withPadding_) {
+                                encodedString.append(1, '=');
+                            } else {
+                                break;
+                            }
+                        } else {
+                            std::bitset<(charSize * 5) / 8> partialBitset((bitset >> ((charSize * 5) - (5 * i))).to_ullong());
+
+                            switch(partialBitset.to_ullong()) {
+                                case 0B00000ULL: encodedString.append(1, '0'); break;
+                                case 0B00001ULL: encodedString.append(1, '1'); break;
+                                case 0B00010ULL: encodedString.append(1, '2'); break;
+                                case 0B00011ULL: encodedString.append(1, '3'); break;
+                                case 0B00100ULL: encodedString.append(1, '4'); break;
+                                case 0B00101ULL: encodedString.append(1, '5'); break;
+                                case 0B00110ULL: encodedString.append(1, '6'); break;
+                                case 0B00111ULL: encodedString.append(1, '7'); break;
+                                case 0B01000ULL: encodedString.append(1, '8'); break;
+                                case 0B01001ULL: encodedString.append(1, '9'); break;
+                                case 0B01010ULL: encodedString.append(1, 'A'); break;
+                                case 0B01011ULL: encodedString.append(1, 'B'); break;
+                                case 0B01100ULL: encodedString.append(1, 'C'); break;
+                                case 0B01101ULL: encodedString.append(1, 'D'); break;
+                                case 0B01110ULL: encodedString.append(1, 'E'); break;
+                                case 0B01111ULL: encodedString.append(1, 'F'); break;
+                                case 0B10000ULL: encodedString.append(1, 'G'); break;
+                                case 0B10001ULL: encodedString.append(1, 'H'); break;
+                                case 0B10010ULL: encodedString.append(1, 'I'); break;
+                                case 0B10011ULL: encodedString.append(1, 'J'); break;
+                                case 0B10100ULL: encodedString.append(1, 'K'); break;
+                                case 0B10101ULL: encodedString.append(1, 'L'); break;
+                                case 0B10110ULL: encodedString.append(1, 'M'); break;
+                                case 0B10111ULL: encodedString.append(1, 'N'); break;
+                                case 0B11000ULL: encodedString.append(1, 'O'); break;
+                                case 0B11001ULL: encodedString.append(1, 'P'); break;
+                                case 0B11010ULL: encodedString.append(1, 'Q'); break;
+                                case 0B11011ULL: encodedString.append(1, 'R'); break;
+                                case 0B11100ULL: encodedString.append(1, 'S'); break;
+                                case 0B11101ULL: encodedString.append(1, 'T'); break;
+                                case 0B11110ULL: encodedString.append(1, 'U'); break;
+                                case 0B11111ULL: encodedString.append(1, 'V'); break;
+                                default: Internal::UnreachableTerminate();
+                            }
+                        }
+                    }
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Base32Hex encoded string into a decoded string. Whitespace and newline characters are not ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @throws BinaryText::Base32Hex::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_)
+            {
+                using Internal::charSize;
+                using Internal::UnreachableTerminate;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 8.0) * 5.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                    std::bitset<charSize * 5> bitset;
+                    unsigned int paddingCounter(0U);
+                    unsigned int loopCounter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
+                        loopCounter += 1U;
+                        bitset <<= (charSize * 5) / 8;
+
+                        if(paddingCounter > 0U and *jter != '=') {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        } else {
+                            switch(*jter) {
+                                case '0': bitset |= std::bitset<charSize * 5>(0B00000ULL); break;
+                                case '1': bitset |= std::bitset<charSize * 5>(0B00001ULL); break;
+                                case '2': bitset |= std::bitset<charSize * 5>(0B00010ULL); break;
+                                case '3': bitset |= std::bitset<charSize * 5>(0B00011ULL); break;
+                                case '4': bitset |= std::bitset<charSize * 5>(0B00100ULL); break;
+                                case '5': bitset |= std::bitset<charSize * 5>(0B00101ULL); break;
+                                case '6': bitset |= std::bitset<charSize * 5>(0B00110ULL); break;
+                                case '7': bitset |= std::bitset<charSize * 5>(0B00111ULL); break;
+                                case '8': bitset |= std::bitset<charSize * 5>(0B01000ULL); break;
+                                case '9': bitset |= std::bitset<charSize * 5>(0B01001ULL); break;
+                                case 'A': bitset |= std::bitset<charSize * 5>(0B01010ULL); break;
+                                case 'B': bitset |= std::bitset<charSize * 5>(0B01011ULL); break;
+                                case 'C': bitset |= std::bitset<charSize * 5>(0B01100ULL); break;
+                                case 'D': bitset |= std::bitset<charSize * 5>(0B01101ULL); break;
+                                case 'E': bitset |= std::bitset<charSize * 5>(0B01110ULL); break;
+                                case 'F': bitset |= std::bitset<charSize * 5>(0B01111ULL); break;
+                                case 'G': bitset |= std::bitset<charSize * 5>(0B10000ULL); break;
+                                case 'H': bitset |= std::bitset<charSize * 5>(0B10001ULL); break;
+                                case 'I': bitset |= std::bitset<charSize * 5>(0B10010ULL); break;
+                                case 'J': bitset |= std::bitset<charSize * 5>(0B10011ULL); break;
+                                case 'K': bitset |= std::bitset<charSize * 5>(0B10100ULL); break;
+                                case 'L': bitset |= std::bitset<charSize * 5>(0B10101ULL); break;
+                                case 'M': bitset |= std::bitset<charSize * 5>(0B10110ULL); break;
+                                case 'N': bitset |= std::bitset<charSize * 5>(0B10111ULL); break;
+                                case 'O': bitset |= std::bitset<charSize * 5>(0B11000ULL); break;
+                                case 'P': bitset |= std::bitset<charSize * 5>(0B11001ULL); break;
+                                case 'Q': bitset |= std::bitset<charSize * 5>(0B11010ULL); break;
+                                case 'R': bitset |= std::bitset<charSize * 5>(0B11011ULL); break;
+                                case 'S': bitset |= std::bitset<charSize * 5>(0B11100ULL); break;
+                                case 'T': bitset |= std::bitset<charSize * 5>(0B11101ULL); break;
+                                case 'U': bitset |= std::bitset<charSize * 5>(0B11110ULL); break;
+                                case 'V': bitset |= std::bitset<charSize * 5>(0B11111ULL); break;
+                                case '=': paddingCounter += 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+                        }
+
+                        if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 8)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(loopCounter) {
+                        case 8U: break;
+                        case 7U: {
+                            bitset <<= (charSize * 5) / 8;
+
+                            switch(paddingCounter) {
+                                case 5U: paddingCounter = 6U; break;
+                                case 3U: paddingCounter = 4U; break;
+                                case 2U: paddingCounter = 3U; break;
+                                case 0U: paddingCounter = 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 6U: {
+                            bitset <<= ((charSize * 5) / 8) * 2;
+
+                            switch(paddingCounter) {
+                                case 4U: paddingCounter = 6U; break;
+                                case 2U: paddingCounter = 4U; break;
+                                case 1U: paddingCounter = 3U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 5U: {
+                            bitset <<= ((charSize * 5) / 8) * 3;
+
+                            switch(paddingCounter) {
+                                case 3U: paddingCounter = 6U; break;
+                                case 1U: paddingCounter = 4U; break;
+                                case 0U: paddingCounter = 3U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 4U: {
+                            bitset <<= ((charSize * 5) / 8) * 4;
+
+                            switch(paddingCounter) {
+                                case 2U: paddingCounter = 6U; break;
+                                case 0U: paddingCounter = 4U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 3U: {
+                            bitset <<= ((charSize * 5) / 8) * 5;
+
+                            switch(paddingCounter) {
+                                case 1U: paddingCounter = 6U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= ((charSize * 5) / 8) * 6;
+
+                            switch(paddingCounter) {
+                                case 0U: paddingCounter = 6U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    switch(paddingCounter) {
+                        case 0U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+
+                            break;
+                        }
+                        case 1U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+
+                            break;
+                        }
+                        case 3U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+
+                            break;
+                        }
+                        case 4U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+
+                            break;
+                        }
+                        case 6U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 4)).to_ullong()))); break;
+                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    if(paddingCounter > 0U) {
+                        break;
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+
+        /// @brief Reference Base64 encoding and decoding, throwing the same BinaryText::Base64::Error.
+        namespace Base64
+        {
+            using Error = BinaryText::Base64::Error;
+
+            /**
+             * @brief Encodes a not-encoded string into a Base64 encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+             * @throws BinaryText::Base64::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(string_.size())) / 3.0) * 4.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize * 3> bitset;
+                    unsigned int counter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
+                        counter += 1U;
+                        bitset <<= charSize;
+                        bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+
+                        if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 3)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(counter) {
+                        case 3U: counter = 4U; break;
+                        case 2U: {
+                            bitset <<= charSize;
+                            counter = 3U;
+
+                            break;
+                        }
+                        case 1U: {
+                            bitset <<= charSize * 2;
+                            counter = 2U;
+
+                            break;
+                        }
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    for(unsigned int i(1U); i < 5U; ++i) {
+                        if(i > counter) {
+                            if(withPadding_) {
+                                encodedString.append(1, '=');
+                            } else {
+                                break;
+                            }
+                        } else {
+                            std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
+
+                            switch(partialBitset.to_ullong()) {
+                                case 0B000000ULL: encodedString.append(1, 'A'); break;
+                                case 0B000001ULL: encodedString.append(1, 'B'); break;
+                                case 0B000010ULL: encodedString.append(1, 'C'); break;
+                                case 0B000011ULL: encodedString.append(1, 'D'); break;
+                                case 0B000100ULL: encodedString.append(1, 'E'); break;
+                                case 0B000101ULL: encodedString.append(1, 'F'); break;
+                                case 0B000110ULL: encodedString.append(1, 'G'); break;
+                                case 0B000111ULL: encodedString.append(1, 'H'); break;
+                                case 0B001000ULL: encodedString.append(1, 'I'); break;
+                                case 0B001001ULL: encodedString.append(1, 'J'); break;
+                                case 0B001010ULL: encodedString.append(1, 'K'); break;
+                                case 0B001011ULL: encodedString.append(1, 'L'); break;
+                                case 0B001100ULL: encodedString.append(1, 'M'); break;
+                                case 0B001101ULL: encodedString.append(1, 'N'); break;
+                                case 0B001110ULL: encodedString.append(1, 'O'); break;
+                                case 0B001111ULL: encodedString.append(1, 'P'); break;
+                                case 0B010000ULL: encodedString.append(1, 'Q'); break;
+                                case 0B010001ULL: encodedString.append(1, 'R'); break;
+                                case 0B010010ULL: encodedString.append(1, 'S'); break;
+                                case 0B010011ULL: encodedString.append(1, 'T'); break;
+                                case 0B010100ULL: encodedString.append(1, 'U'); break;
+                                case 0B010101ULL: encodedString.append(1, 'V'); break;
+                                case 0B010110ULL: encodedString.append(1, 'W'); break;
+                                case 0B010111ULL: encodedString.append(1, 'X'); break;
+                                case 0B011000ULL: encodedString.append(1, 'Y'); break;
+                                case 0B011001ULL: encodedString.append(1, 'Z'); break;
+                                case 0B011010ULL: encodedString.append(1, 'a'); break;
+                                case 0B011011ULL: encodedString.append(1, 'b'); break;
+                                case 0B011100ULL: encodedString.append(1, 'c'); break;
+                                case 0B011101ULL: encodedString.append(1, 'd'); break;
+                                case 0B011110ULL: encodedString.append(1, 'e'); break;
+                                case 0B011111ULL: encodedString.append(1, 'f'); break;
+                                case 0B100000ULL: encodedString.append(1, 'g'); break;
+                                case 0B100001ULL: encodedString.append(1, 'h'); break;
+                                case 0B100010ULL: encodedString.append(1, 'i'); break;
+                                case 0B100011ULL: encodedString.append(1, 'j'); break;
+                                case 0B100100ULL: encodedString.append(1, 'k'); break;
+                                case 0B100101ULL: encodedString.append(1, 'l'); break;
+                                case 0B100110ULL: encodedString.append(1, 'm'); break;
+                                case 0B100111ULL: encodedString.append(1, 'n'); break;
+                                case 0B101000ULL: encodedString.append(1, 'o'); break;
+                                case 0B101001ULL: encodedString.append(1, 'p'); break;
+                                case 0B101010ULL: encodedString.append(1, 'q'); break;
+                                case 0B101011ULL: encodedString.append(1, 'r'); break;
+                                case 0B101100ULL: encodedString.append(1, 's'); break;
+                                case 0B101101ULL: encodedString.append(1, 't'); break;
+                                case 0B101110ULL: encodedString.append(1, 'u'); break;
+                                case 0B101111ULL: encodedString.append(1, 'v'); break;
+                                case 0B110000ULL: encodedString.append(1, 'w'); break;
+                                case 0B110001ULL: encodedString.append(1, 'x'); break;
+                                case 0B110010ULL: encodedString.append(1, 'y'); break;
+                                case 0B110011ULL: encodedString.append(1, 'z'); break;
+                                case 0B110100ULL: encodedString.append(1, '0'); break;
+                                case 0B110101ULL: encodedString.append(1, '1'); break;
+                                case 0B110110ULL: encodedString.append(1, '2'); break;
+                                case 0B110111ULL: encodedString.append(1, '3'); break;
+                                case 0B111000ULL: encodedString.append(1, '4'); break;
+                                case 0B111001ULL: encodedString.append(1, '5'); break;
+                                case 0B111010ULL: encodedString.append(1, '6'); break;
+                                case 0B111011ULL: encodedString.append(1, '7'); break;
+                                case 0B111100ULL: encodedString.append(1, '8'); break;
+                                case 0B111101ULL: encodedString.append(1, '9'); break;
+                                case 0B111110ULL: encodedString.append(1, '+'); break;
+                                case 0B111111ULL: encodedString.append(1, '/'); break;
+                                default: Internal::UnreachableTerminate();
+                            }
+                        }
+                    }
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Base64 encoded string into a decoded string. Whitespace and newline characters are not ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @throws BinaryText::Base64::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_)
+            {
+                using Internal::charSize;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(encodedString_.size())) / 4.0) * 3.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                    std::bitset<charSize * 3> bitset;
+                    unsigned int paddingCounter(0U);
+                    unsigned int loopCounter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
+                        loopCounter += 1U;
+                        bitset <<= (charSize * 3) / 4;
+
+                        if(paddingCounter > 0U and *jter != '=') {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        } else {
+                            switch(*jter) {
+                                case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
+                                case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
+                                case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
+                                case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
+                                case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
+                                case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
+                                case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
+                                case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
+                                case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
+                                case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
+                                case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
+                                case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
+                                case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
+                                case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
+                                case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
+                                case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
+                                case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
+                                case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
+                                case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
+                                case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
+                                case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
+                                case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
+                                case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
+                                case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
+                                case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
+                                case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
+                                case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
+                                case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
+                                case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
+                                case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
+                                case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
+                                case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
+                                case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
+                                case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
+                                case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
+                                case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
+                                case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
+                                case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
+                                case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
+                                case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
+                                case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
+                                case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
+                                case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
+                                case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
+                                case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
+                                case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
+                                case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
+                                case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
+                                case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
+                                case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
+                                case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
+                                case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
+                                case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
+                                case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
+                                case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
+                                case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
+                                case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
+                                case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
+                                case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
+                                case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
+                                case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
+                                case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
+                                case '+': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
+                                case '/': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
+                                case '=': paddingCounter += 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+                        }
+
+                        if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(loopCounter) {
+                        case 4U: break;
+                        case 3U: {
+                            bitset <<= (charSize * 3) / 4;
+
+                            switch(paddingCounter) {
+                                case 1U: paddingCounter = 2U; break;
+                                case 0U: paddingCounter = 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= ((charSize * 3) / 4) * 2;
+
+                            switch(paddingCounter) {
+                                case 0U: paddingCounter = 2U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    switch(paddingCounter) {
+                        case 0U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+
+                            break;
+                        }
+                        case 1U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+
+                            break;
+                        }
+                        case 2U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()))); break;
+                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    if(paddingCounter > 0U) {
+                        break;
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+
+        /// @brief Reference Base64Url encoding and decoding, throwing the same BinaryText::Base64Url::Error.
+        namespace Base64Url
+        {
+            using Error = BinaryText::Base64Url::Error;
+
+            /**
+             * @brief Encodes a not-encoded string into a Base64Url encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] withPadding_ Whether or not padding (the '=' character) should be included.
+             * @throws BinaryText::Base64Url::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const bool withPadding_ = true)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(string_.size())) / 3.0) * 4.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize * 3> bitset;
+                    unsigned int counter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != string_.cend(); ++jter) {
+                        counter += 1U;
+                        bitset <<= charSize;
+                        bitset |= std::bitset<charSize * 3>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+
+                        if((std::next(jter, 1) == string_.cend()) or (std::next(jter, 1) == std::next(iter, 3))) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(counter) {
+                        case 3U: counter = 4U; break;
+                        case 2U: {
+                            bitset <<= charSize;
+                            counter = 3U;
+
+                            break;
+                        }
+                        case 1U: {
+                            bitset <<= (charSize * 2);
+                            counter = 2U;
+
+                            break;
+                        }
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    for(unsigned int i(1U); i < 5U; ++i) {
+                        if(i > counter) {
+                            if(withPadding_) {
+                                encodedString.append(1, '=');
+                            } else {
+                                break;
+                            }
+                        } else {
+                            std::bitset<(charSize * 3) / 4> partialBitset((bitset >> ((charSize * 3) - (6 * i))).to_ullong());
+
+                            switch(partialBitset.to_ullong()) {
+                                case 0B000000ULL: encodedString.append(1, 'A'); break;
+                                case 0B000001ULL: encodedString.append(1, 'B'); break;
+                                case 0B000010ULL: encodedString.append(1, 'C'); break;
+                                case 0B000011ULL: encodedString.append(1, 'D'); break;
+                                case 0B000100ULL: encodedString.append(1, 'E'); break;
+                                case 0B000101ULL: encodedString.append(1, 'F'); break;
+                                case 0B000110ULL: encodedString.append(1, 'G'); break;
+                                case 0B000111ULL: encodedString.append(1, 'H'); break;
+                                case 0B001000ULL: encodedString.append(1, 'I'); break;
+                                case 0B001001ULL: encodedString.append(1, 'J'); break;
+                                case 0B001010ULL: encodedString.append(1, 'K'); break;
+                                case 0B001011ULL: encodedString.append(1, 'L'); break;
+                                case 0B001100ULL: encodedString.append(1, 'M'); break;
+                                case 0B001101ULL: encodedString.append(1, 'N'); break;
+                                case 0B001110ULL: encodedString.append(1, 'O'); break;
+                                case 0B001111ULL: encodedString.append(1, 'P'); break;
+                                case 0B010000ULL: encodedString.append(1, 'Q'); break;
+                                case 0B010001ULL: encodedString.append(1, 'R'); break;
+                                case 0B010010ULL: encodedString.append(1, 'S'); break;
+                                case 0B010011ULL: encodedString.append(1, 'T'); break;
+                                case 0B010100ULL: encodedString.append(1, 'U'); break;
+                                case 0B010101ULL: encodedString.append(1, 'V'); break;
+                                case 0B010110ULL: encodedString.append(1, 'W'); break;
+                                case 0B010111ULL: encodedString.append(1, 'X'); break;
+                                case 0B011000ULL: encodedString.append(1, 'Y'); break;
+                                case 0B011001ULL: encodedString.append(1, 'Z'); break;
+                                case 0B011010ULL: encodedString.append(1, 'a'); break;
+                                case 0B011011ULL: encodedString.append(1, 'b'); break;
+                                case 0B011100ULL: encodedString.append(1, 'c'); break;
+                                case 0B011101ULL: encodedString.append(1, 'd'); break;
+                                case 0B011110ULL: encodedString.append(1, 'e'); break;
+                                case 0B011111ULL: encodedString.append(1, 'f'); break;
+                                case 0B100000ULL: encodedString.append(1, 'g'); break;
+                                case 0B100001ULL: encodedString.append(1, 'h'); break;
+                                case 0B100010ULL: encodedString.append(1, 'i'); break;
+                                case 0B100011ULL: encodedString.append(1, 'j'); break;
+                                case 0B100100ULL: encodedString.append(1, 'k'); break;
+                                case 0B100101ULL: encodedString.append(1, 'l'); break;
+                                case 0B100110ULL: encodedString.append(1, 'm'); break;
+                                case 0B100111ULL: encodedString.append(1, 'n'); break;
+                                case 0B101000ULL: encodedString.append(1, 'o'); break;
+                                case 0B101001ULL: encodedString.append(1, 'p'); break;
+                                case 0B101010ULL: encodedString.append(1, 'q'); break;
+                                case 0B101011ULL: encodedString.append(1, 'r'); break;
+                                case 0B101100ULL: encodedString.append(1, 's'); break;
+                                case 0B101101ULL: encodedString.append(1, 't'); break;
+                                case 0B101110ULL: encodedString.append(1, 'u'); break;
+                                case 0B101111ULL: encodedString.append(1, 'v'); break;
+                                case 0B110000ULL: encodedString.append(1, 'w'); break;
+                                case 0B110001ULL: encodedString.append(1, 'x'); break;
+                                case 0B110010ULL: encodedString.append(1, 'y'); break;
+                                case 0B110011ULL: encodedString.append(1, 'z'); break;
+                                case 0B110100ULL: encodedString.append(1, '0'); break;
+                                case 0B110101ULL: encodedString.append(1, '1'); break;
+                                case 0B110110ULL: encodedString.append(1, '2'); break;
+                                case 0B110111ULL: encodedString.append(1, '3'); break;
+                                case 0B111000ULL: encodedString.append(1, '4'); break;
+                                case 0B111001ULL: encodedString.append(1, '5'); break;
+                                case 0B111010ULL: encodedString.append(1, '6'); break;
+                                case 0B111011ULL: encodedString.append(1, '7'); break;
+                                case 0B111100ULL: encodedString.append(1, '8'); break;
+                                case 0B111101ULL: encodedString.append(1, '9'); break;
+                                case 0B111110ULL: encodedString.append(1, '-'); break;
+                                case 0B111111ULL: encodedString.append(1, '_'); break;
+                                default: Internal::UnreachableTerminate();
+                            }
+                        }
+                    }
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Base64Url encoded string into a decoded string. Whitespace and newline characters are not ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @throws BinaryText::Base64Url::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_)
+            {
+                using Internal::charSize;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(static_cast<std::string::size_type>(std::ceil((static_cast<double>(encodedString_.size())) / 4.0) * 3.0));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                    std::bitset<charSize * 3> bitset;
+                    unsigned int paddingCounter(0U);
+                    unsigned int loopCounter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != encodedString_.cend(); ++jter) {
+                        loopCounter += 1U;
+                        bitset <<= (charSize * 3) / 4;
+
+                        if(paddingCounter > 0U and *jter != '=') {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        } else {
+                            switch(*jter) {
+                                case 'A': bitset |= std::bitset<charSize * 3>(0B000000ULL); break;
+                                case 'B': bitset |= std::bitset<charSize * 3>(0B000001ULL); break;
+                                case 'C': bitset |= std::bitset<charSize * 3>(0B000010ULL); break;
+                                case 'D': bitset |= std::bitset<charSize * 3>(0B000011ULL); break;
+                                case 'E': bitset |= std::bitset<charSize * 3>(0B000100ULL); break;
+                                case 'F': bitset |= std::bitset<charSize * 3>(0B000101ULL); break;
+                                case 'G': bitset |= std::bitset<charSize * 3>(0B000110ULL); break;
+                                case 'H': bitset |= std::bitset<charSize * 3>(0B000111ULL); break;
+                                case 'I': bitset |= std::bitset<charSize * 3>(0B001000ULL); break;
+                                case 'J': bitset |= std::bitset<charSize * 3>(0B001001ULL); break;
+                                case 'K': bitset |= std::bitset<charSize * 3>(0B001010ULL); break;
+                                case 'L': bitset |= std::bitset<charSize * 3>(0B001011ULL); break;
+                                case 'M': bitset |= std::bitset<charSize * 3>(0B001100ULL); break;
+                                case 'N': bitset |= std::bitset<charSize * 3>(0B001101ULL); break;
+                                case 'O': bitset |= std::bitset<charSize * 3>(0B001110ULL); break;
+                                case 'P': bitset |= std::bitset<charSize * 3>(0B001111ULL); break;
+                                case 'Q': bitset |= std::bitset<charSize * 3>(0B010000ULL); break;
+                                case 'R': bitset |= std::bitset<charSize * 3>(0B010001ULL); break;
+                                case 'S': bitset |= std::bitset<charSize * 3>(0B010010ULL); break;
+                                case 'T': bitset |= std::bitset<charSize * 3>(0B010011ULL); break;
+                                case 'U': bitset |= std::bitset<charSize * 3>(0B010100ULL); break;
+                                case 'V': bitset |= std::bitset<charSize * 3>(0B010101ULL); break;
+                                case 'W': bitset |= std::bitset<charSize * 3>(0B010110ULL); break;
+                                case 'X': bitset |= std::bitset<charSize * 3>(0B010111ULL); break;
+                                case 'Y': bitset |= std::bitset<charSize * 3>(0B011000ULL); break;
+                                case 'Z': bitset |= std::bitset<charSize * 3>(0B011001ULL); break;
+                                case 'a': bitset |= std::bitset<charSize * 3>(0B011010ULL); break;
+                                case 'b': bitset |= std::bitset<charSize * 3>(0B011011ULL); break;
+                                case 'c': bitset |= std::bitset<charSize * 3>(0B011100ULL); break;
+                                case 'd': bitset |= std::bitset<charSize * 3>(0B011101ULL); break;
+                                case 'e': bitset |= std::bitset<charSize * 3>(0B011110ULL); break;
+                                case 'f': bitset |= std::bitset<charSize * 3>(0B011111ULL); break;
+                                case 'g': bitset |= std::bitset<charSize * 3>(0B100000ULL); break;
+                                case 'h': bitset |= std::bitset<charSize * 3>(0B100001ULL); break;
+                                case 'i': bitset |= std::bitset<charSize * 3>(0B100010ULL); break;
+                                case 'j': bitset |= std::bitset<charSize * 3>(0B100011ULL); break;
+                                case 'k': bitset |= std::bitset<charSize * 3>(0B100100ULL); break;
+                                case 'l': bitset |= std::bitset<charSize * 3>(0B100101ULL); break;
+                                case 'm': bitset |= std::bitset<charSize * 3>(0B100110ULL); break;
+                                case 'n': bitset |= std::bitset<charSize * 3>(0B100111ULL); break;
+                                case 'o': bitset |= std::bitset<charSize * 3>(0B101000ULL); break;
+                                case 'p': bitset |= std::bitset<charSize * 3>(0B101001ULL); break;
+                                case 'q': bitset |= std::bitset<charSize * 3>(0B101010ULL); break;
+                                case 'r': bitset |= std::bitset<charSize * 3>(0B101011ULL); break;
+                                case 's': bitset |= std::bitset<charSize * 3>(0B101100ULL); break;
+                                case 't': bitset |= std::bitset<charSize * 3>(0B101101ULL); break;
+                                case 'u': bitset |= std::bitset<charSize * 3>(0B101110ULL); break;
+                                case 'v': bitset |= std::bitset<charSize * 3>(0B101111ULL); break;
+                                case 'w': bitset |= std::bitset<charSize * 3>(0B110000ULL); break;
+                                case 'x': bitset |= std::bitset<charSize * 3>(0B110001ULL); break;
+                                case 'y': bitset |= std::bitset<charSize * 3>(0B110010ULL); break;
+                                case 'z': bitset |= std::bitset<charSize * 3>(0B110011ULL); break;
+                                case '0': bitset |= std::bitset<charSize * 3>(0B110100ULL); break;
+                                case '1': bitset |= std::bitset<charSize * 3>(0B110101ULL); break;
+                                case '2': bitset |= std::bitset<charSize * 3>(0B110110ULL); break;
+                                case '3': bitset |= std::bitset<charSize * 3>(0B110111ULL); break;
+                                case '4': bitset |= std::bitset<charSize * 3>(0B111000ULL); break;
+                                case '5': bitset |= std::bitset<charSize * 3>(0B111001ULL); break;
+                                case '6': bitset |= std::bitset<charSize * 3>(0B111010ULL); break;
+                                case '7': bitset |= std::bitset<charSize * 3>(0B111011ULL); break;
+                                case '8': bitset |= std::bitset<charSize * 3>(0B111100ULL); break;
+                                case '9': bitset |= std::bitset<charSize * 3>(0B111101ULL); break;
+                                case '-': bitset |= std::bitset<charSize * 3>(0B111110ULL); break;
+                                case '_': bitset |= std::bitset<charSize * 3>(0B111111ULL); break;
+                                case '=': paddingCounter += 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+                        }
+
+                        if(std::next(jter, 1) == encodedString_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(loopCounter) {
+                        case 4U: break;
+                        case 3U: {
+                            bitset <<= ((charSize * 3) / 4);
+
+                            switch(paddingCounter) {
+                                case 1U: paddingCounter = 2U; break;
+                                case 0U: paddingCounter = 1U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 2U: {
+                            bitset <<= (((charSize * 3) / 4) * 2);
+
+                            switch(paddingCounter) {
+                                case 0U: paddingCounter = 2U; break;
+                                default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+
+                            break;
+                        }
+                        case 1U: throw Error(Error::Type::STRING_PARSE_ERROR);
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    switch(paddingCounter) {
+                        case 0U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+
+                            break;
+                        }
+                        case 1U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+
+                            break;
+                        }
+                        case 2U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong()))); break;
+                        default: throw Error(Error::Type::STRING_PARSE_ERROR);
+                    }
+
+                    if(paddingCounter > 0U) {
+                        break;
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+
+        /// @brief Reference Ascii85 encoding and decoding, throwing the same BinaryText::Ascii85::Error.
+        namespace Ascii85
+        {
+            using Error = BinaryText::Ascii85::Error;
+
+            /**
+             * @brief Encodes a not-encoded string into an Ascii85 encoded string.
+             * @param[in] string_ String to be encoded.
+             * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+             * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+             * @throws BinaryText::Ascii85::Error
+            */
+            inline std::string EncodeStringToString(const std::string& string_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+            {
+                using Internal::charSize;
+
+                std::string encodedString;
+
+                try {
+                    if(string_.size() > 0) {
+                        encodedString.reserve(string_.size() + static_cast<std::string::size_type>(std::ceil(static_cast<double>(string_.size()) / 4.0)));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                if(adobeMode_) {
+                    encodedString.append("<~");
+                }
+
+                for(std::string::const_iterator iter = string_.cbegin(); iter != string_.cend(); ++iter) {
+                    std::bitset<charSize * 4> bitset;
+                    unsigned int counter(0U);
+
+                    for(std::string::const_iterator jter(iter); jter != string_.end(); ++jter) {
+                        counter += 1U;
+                        bitset <<= charSize;
+                        bitset |= std::bitset<charSize * 4>(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+
+                        if(std::next(jter, 1) == string_.cend() or std::next(jter, 1) == std::next(iter, 4)) {
+                            iter = jter;
+
+                            break;
+                        }
+                    }
+
+                    switch(counter) {
+                        case 4U: counter = 0U; break;
+                        case 3U: bitset <<= charSize; break;
+                        case 2U: bitset <<= (charSize * 2); break;
+                        case 1U: bitset <<= (charSize * 3); break;
+                        default: Internal::UnreachableTerminate();
+                    }
+
+                    // Only whole groups are folded, a partial group of zeros written as z would decode into 4 bytes
+                    if(counter == 0U and bitset == std::bitset<charSize * 4>(0B00000000000000000000000000000000ULL)) {
+                        encodedString.append(1, 'z');
+                    } else if(counter == 0U and bitset == std::bitset<charSize * 4>(0B00100000001000000010000000100000ULL) and foldSpaces_) {
+                        encodedString.append(1, 'y');
+                    } else {
+                        unsigned long long bitsetNumber(bitset.to_ullong());
+                        std::array<unsigned long long, 5> codes;
+
+                        for(std::array<unsigned long long, 5>::iterator jter(codes.begin()); jter != codes.end(); ++jter) {
+                            *jter = bitsetNumber % 85ULL;
+                            bitsetNumber = static_cast<unsigned long long>(std::floor(static_cast<double>(bitsetNumber) / 85.0));
+                        }
+
+                        for(std::array<unsigned long long, 5>::reverse_iterator jter(codes.rbegin()); jter != codes.rend(); ++jter) {
+                            encodedString.append(1, static_cast<char>(static_cast<unsigned char>(*jter + 33ULL)));
+                        }
+
+                        if((4U - counter) != 4U) {
+                            encodedString.erase(std::prev(encodedString.end(), 4U - counter), encodedString.end());
+                        }
+                    }
+                }
+
+                if(adobeMode_) {
+                    encodedString.append("~>");
+                }
+
+                return encodedString;
+            }
+            /**
+             * @brief Decodes a Ascii85 encoded string into a decoded string. Whitespace and newline characters are ignored.
+             * @param[in] encodedString_ String to be decoded.
+             * @param[in] foldSpaces_ Whether or not to fold spaces. That is, to turn 4 spaces (00100000001000000010000000100000) into y.
+             * @param[in] adobeMode_ Whether or not to surround the encoded string with <~ and ~> delimiters.
+             * @throws BinaryText::Ascii85::Error
+            */
+            inline std::string DecodeStringToString(const std::string& encodedString_, const bool foldSpaces_ = false, const bool adobeMode_ = false)
+            {
+                using Internal::charSize;
+
+                std::string decodedString;
+
+                try {
+                    if(encodedString_.size() > 0) {
+                        decodedString.reserve(encodedString_.size()
+                                              - static_cast<std::string::size_type>(std::ceil(static_cast<double>(encodedString_.size()) / 5.0)));
+                    }
+                } catch(const std::length_error&) {
+                    throw Error(Error::Type::INTERNAL_STRING_RESERVE_ERROR);
+                }
+
+                std::string::const_iterator encodedStringBegin(encodedString_.cbegin());
+                std::string::const_iterator encodedStringEnd(encodedString_.cend());
+
+                if(adobeMode_) {
+                    for(std::string::const_iterator iter(encodedString_.cbegin()); iter != encodedString_.cend(); ++iter) {
+                        if(*iter == '<' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.cend()) {
+                            encodedStringBegin = std::next(iter, 2);
+
+                            break;
+                        } else if(*iter == ' ' or *iter == '\n') {
+                            if(std::next(iter, 1) == encodedString_.cend()) {
+                                throw Error(Error::Type::STRING_PARSE_ERROR);
+                            } else {
+                                continue;
+                            }
+                        } else {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        }
+                    }
+
+                    for(std::string::const_reverse_iterator iter(encodedString_.crbegin()); iter != encodedString_.crend(); ++iter) {
+                        if(*iter == '>' and *std::next(iter, 1) == '~' and std::next(iter, 2) != encodedString_.crend()) {
+                            encodedStringEnd = std::next(iter, 2).base();
+
+                            break;
+                        } else if(*iter == ' ' or *iter == '\n') {
+                            if(std::next(iter, 1) == encodedString_.crend()) {
+                                throw Error(Error::Type::STRING_PARSE_ERROR);
+                            } else {
+                                continue;
+                            }
+                        } else {
+                            throw Error(Error::Type::STRING_PARSE_ERROR);
+                        }
+                    }
+                }
+
+                for(std::string::const_iterator iter(encodedStringBegin); iter != encodedStringEnd; ++iter) {
+                    unsigned long long bitsetNumber(0ULL);
+                    unsigned int counter(0U);
+
+                    switch(*iter) {
+                        case ' ': continue;
+                        case '\n': continue;
+                        case 'y': {
+                            if(foldSpaces_) {
+                                decodedString.append("    ");
+
+                                continue;
+                            } else {
+                                throw Error(Error::Type::STRING_PARSE_ERROR);
+                            }
+                        }
+                        case 'z': {
+                            decodedString.append(4, '\0');
+
+                            continue;
+                        }
+                        default: {
+                            for(std::string::const_iterator jter(iter); iter != encodedStringEnd; ++jter) {
+                                if(*jter == ' ' or *jter == '\n') {
+                                    if(std::next(jter, 1) == encodedStringEnd) {
+                                        // Without moving on the outer loop would decode the rest of this partial group a second time
+                                        iter = jter;
+
+                                        break;
+                                    } else {
+                                        std::advance(iter, 1);
+
+                                        continue;
+                                    }
+                                } else {
+                                    const unsigned long long partialBitsetNumber(std::bitset<charSize>(static_cast<unsigned char>(*jter)).to_ullong());
+                                    counter += 1U;
+
+                                    if(partialBitsetNumber < 33ULL or partialBitsetNumber > 117ULL) {
+                                        throw Error(Error::Type::STRING_PARSE_ERROR);
+                                    } else {
+                                        switch(counter) {
+                                            case 1U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL * 85ULL); break;
+                                            case 2U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL * 85ULL); break;
+                                            case 3U: bitsetNumber += (partialBitsetNumber - 33ULL) * (85ULL * 85ULL); break;
+                                            case 4U: bitsetNumber += (partialBitsetNumber - 33ULL) * 85ULL; break;
+                                            case 5U: bitsetNumber += partialBitsetNumber - 33ULL; break;
+                                            default: Internal::UnreachableTerminate();
+                                        }
+
+                                        if(std::next(jter, 1) == encodedStringEnd or std::next(jter, 1) == std::next(iter, 5)) {
+                                            iter = jter;
+
+                                            break;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    {
+                        const unsigned int previousCounter(counter);
+
+                        while(counter < 5U) {
+                            counter += 1U;
+
+                            switch(counter) {
+                                case 1U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL * 85ULL; break;
+                                case 2U: bitsetNumber += 84ULL * 85ULL * 85ULL * 85ULL; break;
+                                case 3U: bitsetNumber += 84ULL * 85ULL * 85ULL; break;
+                                case 4U: bitsetNumber += 84ULL * 85ULL; break;
+                                case 5U: bitsetNumber += 84ULL; break;
+                                default: Internal::UnreachableTerminate();
+                            }
+                        }
+
+                        counter = 5U - previousCounter;
+                    }
+
+                    const std::bitset<charSize * 4> bitset(bitsetNumber);
+
+                    switch(counter) {
+                        case 0U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>(bitset.to_ullong())));
+
+                            break;
+                        }
+                        case 1U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> charSize).to_ullong())));
+
+                            break;
+                        }
+                        case 2U: {
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong())));
+                            decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 2)).to_ullong())));
+
+                            break;
+                        }
+                        case 3U: decodedString.append(1, static_cast<char>(static_cast<unsigned char>((bitset >> (charSize * 3)).to_ullong()))); break;
+                        case 4U: break;
+                        default: Internal::UnreachableTerminate();
+                    }
+                }
+
+                return decodedString;
+            }
+        };
+    };
+};
\ No newline at end of file
@@ -0,0 +1,363 @@
+/*
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryText.hpp"
+#include "Differential.hpp"
+#include "Reference.hpp"
+#include "Utility.hpp"
+
+/// @brief A namespace that has the pieces of the differential test program.
+namespace Tests
+{
+    /// @brief Amount of mismatches that are printed, the rest are only counted.
+    constexpr std::size_t maximumPrintedMismatches = 20;
+
+    using namespace BinaryText::Literals;
+
+    /**
+     * @brief Compares the characters or bytes of an std::array with a string, for the checks of the compile-time functions.
+     * @param[in] array_ Characters or bytes to be compared.
+     * @param[in] string_ Characters or bytes they should be.
+     * @returns Whether or not both have the same size and values.
+    */
+    template<typename ValueType, std::size_t size_>
+    constexpr bool IsEqual(const std::array<ValueType, size_>& array_, const std::string_view string_)
+    {
+        return std::equal(array_.begin(), array_.end(), string_.begin(), string_.end(),
+                          [](const ValueType value_, const char character_) { return value_ == static_cast<ValueType>(character_); });
+    }
+
+    // The compile-time functions and literals are checked when this file is compiled, with the test vectors of RFC 4648 §10 and of Ascii85
+    static_assert(IsEqual(BinaryText::Base16::EncodeArray<"foobar">(), "666F6F626172"));
+    static_assert(IsEqual(BinaryText::Base16::EncodeArray<"foobar", BinaryText::Base16::Case::LOWERCASE>(), "666f6f626172"));
+    static_assert(IsEqual(BinaryText::Base32::EncodeArray<"foobar">(), "MZXW6YTBOI======"));
+    static_assert(IsEqual(BinaryText::Base32::EncodeArray<"foobar", false>(), "MZXW6YTBOI"));
+    static_assert(IsEqual(BinaryText::Base32Hex::EncodeArray<"foobar">(), "CPNMUOJ1E8======"));
+    static_assert(IsEqual(BinaryText::Base64::EncodeArray<"">(), ""));
+    static_assert(IsEqual(BinaryText::Base64::EncodeArray<"fooba">(), "Zm9vYmE="));
+    static_assert(IsEqual(BinaryText::Base64::EncodeArray<"fooba", false>(), "Zm9vYmE"));
+    static_assert(IsEqual(BinaryText::Base64Url::EncodeArray<"\xFB\xFF">(), "-_8="));
+    static_assert(IsEqual(BinaryText::Ascii85::EncodeArray<"Man ">(), "9jqo^"));
+    static_assert(IsEqual(BinaryText::Ascii85::EncodeArray<"Ma">(), "9jn"));
+    static_assert(IsEqual(BinaryText::Ascii85::EncodeArray<"Man ", false, true>(), "<~9jqo^~>"));
+    static_assert(IsEqual(BinaryText::Ascii85::EncodeArray<"\0\0\0\0">(), "z"));
+    static_assert(IsEqual(BinaryText::Ascii85::EncodeArray<"    ", true>(), "y"));
+    static_assert(IsEqual(BinaryText::Base16::DecodeArray<"666f6f626172", BinaryText::Base16::Case::LOWERCASE>(), "foobar"));
+    static_assert(IsEqual(BinaryText::Base64::DecodeArray<"Zm9vYmE">(), "fooba"));
+    static_assert(IsEqual(BinaryText::Ascii85::DecodeArray<"<~9jqo^~>", false, true>(), "Man "));
+    static_assert(IsEqual("666f6F626172"_b16, "foobar"));
+    static_assert(IsEqual("MZXW6YTBOI======"_b32, "foobar"));
+    static_assert(IsEqual("CPNMUOJ1E8======"_b32hex, "foobar"));
+    static_assert(IsEqual("Zm9vYmFy"_b64, "foobar"));
+    static_assert(IsEqual("-_8="_b64url, "\xFB\xFF"));
+    static_assert(IsEqual("9jqo^z"_a85, std::string_view("Man \0\0\0\0", 8)));
+
+    /**
+     * Creates the inputs that every codec is checked with: random bytes of every size up to 256 bytes, so that every remainder of every block size
+     * is covered, runs of zeros and spaces for the z and y of Ascii85, text that is already encoded, and a 3 MiB input that is large enough for the
+     * functions to split it between threads. The inputs are the same on every run.
+     *
+     * @returns The inputs.
+    */
+    std::vector<std::vector<unsigned char>> MakeInputs()
+    {
+        std::vector<std::vector<unsigned char>> inputs;
+        std::mt19937_64 generator(0x42696E61727954ULL);
+        const auto random([&generator](const std::size_t size_) {
+            std::vector<unsigned char> input(size_);
+
+            for(unsigned char& byte : input) {
+                byte = static_cast<unsigned char>(generator());
+            }
+
+            return input;
+        });
+
+        for(std::size_t size(0); size <= 256; ++size) {
+            inputs.push_back(random(size));
+        }
+
+        for(std::size_t size(1); size <= 13; ++size) {
+            inputs.push_back(std::vector<unsigned char>(size, 0x00));
+            inputs.push_back(std::vector<unsigned char>(size, 0x20));
+        }
+
+        // Alphabet characters only, so that decoding gets past the first character more often
+        for(const std::string_view alphabet : {"0123456789ABCDEFabcdef", "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567=", "0123456789ABCDEFGHIJKLMNOPQRSTUV=",
+                                               "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/-_=",
+                                               "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ!#$%&()*+,-./:;<=>?@[]^_`{|}~ zy<~~>\n"}) {
+            for(std::size_t size(1); size <= 64; ++size) {
+                std::vector<unsigned char> input(random(size));
+
+                for(unsigned char& byte : input) {
+                    byte = static_cast<unsigned char>(alphabet[byte % alphabet.size()]);
+                }
+
+                inputs.push_back(std::move(input));
+            }
+        }
+
+        inputs.push_back(random(3 * 1024 * 1024 + 5));
+
+        return inputs;
+    }
+
+    /// @brief Amounts of bytes or characters the files are read by in CheckFiles(), small so that every file has several blocks.
+    constexpr std::array<std::size_t, 2> fileBlockSizes{7, 4096};
+
+    /**
+     * @brief Reads a whole file into a string.
+     * @param[in] path_ Path to the file.
+     * @returns The bytes of the file.
+    */
+    std::string ReadFile(const std::filesystem::path& path_)
+    {
+        std::ifstream file(path_, std::ios::binary);
+
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    /**
+     * Encodes files with BinaryText::Files::EncodeFile(), decodes them back with BinaryText::Files::DecodeFile() and compares the files with the
+     * reference functions and the sizes returned with the file size functions. The sizes of the files are around every block size of fileBlockSizes,
+     * so that the last block is missing, partial or whole.
+     *
+     * @param[in] name_ Name of the codec, for the mismatches.
+     * @param[in] directory_ Directory the files are written into.
+     * @param[in] referenceEncode_ Function that encodes an std::string with the reference functions.
+     * @param[in] encodedFileSize_ Function that calculates the size of an encoded file (the maximum size for Ascii85).
+     * @param[in] maximumDecodedFileSize_ Function that calculates the maximum size of a decoded file.
+     * @param[in] isSizeExact_ Whether or not encodedFileSize_ is the exact size.
+     * @returns The mismatches found.
+    */
+    template<BinaryText::PieceEncoder EncoderType, BinaryText::PieceDecoder DecoderType, typename ReferenceType, typename EncodedSizeType,
+             typename DecodedSizeType>
+    std::vector<std::string> CheckFiles(const std::string_view name_, const std::filesystem::path& directory_, const ReferenceType& referenceEncode_,
+                                        const EncodedSizeType& encodedFileSize_, const DecodedSizeType& maximumDecodedFileSize_, const bool isSizeExact_)
+    {
+        std::vector<std::string> mismatches;
+        std::mt19937_64 generator(0x46696C6573ULL);
+        const std::filesystem::path inputPath(directory_ / "input");
+        const std::filesystem::path encodedPath(directory_ / "encoded");
+        const std::filesystem::path decodedPath(directory_ / "decoded");
+
+        for(const std::size_t blockSize : fileBlockSizes) {
+            for(const std::size_t size : {std::size_t(0), std::size_t(1), blockSize - 1, blockSize, blockSize + 1, 2 * blockSize, 3 * blockSize + 2}) {
+                std::string input(size, '\0');
+
+                for(char& byte : input) {
+                    byte = static_cast<char>(generator());
+                }
+
+                std::ofstream(inputPath, std::ios::binary | std::ios::trunc).write(input.data(), static_cast<std::streamsize>(input.size()));
+
+                const std::string name(std::format("{}/file/{}+{}", name_, blockSize, size));
+                const std::string expected(referenceEncode_(input));
+                const BinaryText::Files::Sizes encodedSizes(BinaryText::Files::EncodeFile(inputPath, encodedPath, EncoderType(), blockSize));
+
+                if(ReadFile(encodedPath) != expected) {
+                    mismatches.push_back(std::format("{}: EncodeFile does not match the reference", name));
+                }
+
+                if(encodedSizes.inputSize != size or encodedSizes.outputSize != expected.size()) {
+                    mismatches.push_back(std::format("{}: EncodeFile returned {}+{} instead of {}+{}", name, encodedSizes.inputSize, encodedSizes.outputSize,
+                                                     size, expected.size()));
+                }
+
+                if(isSizeExact_ ? encodedSizes.outputSize != encodedFileSize_(size) : encodedSizes.outputSize > encodedFileSize_(size)) {
+                    mismatches.push_back(
+                        std::format("{}: {} encoded characters, EncodedFileSize is {}", name, encodedSizes.outputSize, encodedFileSize_(size)));
+                }
+
+                const BinaryText::Files::Sizes decodedSizes(BinaryText::Files::DecodeFile(encodedPath, decodedPath, DecoderType(), blockSize));
+
+                if(ReadFile(decodedPath) != input) {
+                    mismatches.push_back(std::format("{}: DecodeFile does not give the input back", name));
+                }
+
+                if(decodedSizes.inputSize != expected.size() or decodedSizes.outputSize != size) {
+                    mismatches.push_back(std::format("{}: DecodeFile returned {}+{} instead of {}+{}", name, decodedSizes.inputSize, decodedSizes.outputSize,
+                                                     expected.size(), size));
+                }
+
+                if(decodedSizes.outputSize > maximumDecodedFileSize_(expected.size())) {
+                    mismatches.push_back(std::format("{}: {} decoded bytes, MaximumDecodedFileSize is {}", name, decodedSizes.outputSize,
+                                                     maximumDecodedFileSize_(expected.size())));
+                }
+            }
+        }
+
+        return mismatches;
+    }
+
+    /**
+     * Checks that a file size function works up to the largest size whose result fits into 64 bits, rounded down to whole groups, and throws
+     * std::length_error one byte or character past it.
+     *
+     * @param[in] name_ Name of the function, for the mismatches.
+     * @param[in] fileSize_ The file size function.
+     * @param[in] bytesPerGroup_ Amount of bytes in a group.
+     * @param[in] charactersPerGroup_ Amount of characters a group is encoded into.
+     * @param[in] extraSize_ Amount of characters added to the whole output (such as delimiters).
+     * @returns The mismatches found.
+    */
+    template<typename FileSizeType>
+    std::vector<std::string> CheckFileSizeLimit(const std::string_view name_, const FileSizeType& fileSize_, const std::uint64_t bytesPerGroup_,
+                                                const std::uint64_t charactersPerGroup_, const std::uint64_t extraSize_ = 0)
+    {
+        std::vector<std::string> mismatches;
+        const std::uint64_t limit(((std::numeric_limits<std::uint64_t>::max() - extraSize_ - charactersPerGroup_) / charactersPerGroup_) * bytesPerGroup_);
+
+        try {
+            if(fileSize_(limit) < limit) {
+                mismatches.push_back(std::format("{}: the size of {} wraps around", name_, limit));
+            }
+        } catch(const std::length_error&) {
+            mismatches.push_back(std::format("{}: throws std::length_error at {}", name_, limit));
+        }
+
+        try {
+            fileSize_(limit + 1);
+            mismatches.push_back(std::format("{}: does not throw std::length_error at {}", name_, limit + 1));
+        } catch(const std::length_error&) {
+        }
+
+        return mismatches;
+    }
+
+    /**
+     * Runs CheckFiles() and CheckFileSizeLimit() for every codec, with the default options of its encoder and decoder. The files are written into a
+     * directory of their own in the temporary directory, which is removed afterwards.
+     *
+     * @returns The mismatches found.
+     * @throws BinaryText::Files::Error
+    */
+    std::vector<std::string> CheckAllFiles()
+    {
+        const std::filesystem::path directory(std::filesystem::temp_directory_path() / std::format("binarytext-test-{}", std::random_device()()));
+        std::vector<std::string> mismatches;
+        const auto add([&mismatches](std::vector<std::string>&& found_) { mismatches.insert(mismatches.end(), found_.begin(), found_.end()); });
+
+        std::filesystem::create_directory(directory);
+
+        try {
+            add(CheckFiles<BinaryText::Base16::Encoder, BinaryText::Base16::Decoder>(
+                "base16", directory, [](const std::string& s_) { return BinaryText::Reference::Base16::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Base16::EncodedFileSize(n_); }, BinaryText::Base16::MaximumDecodedFileSize, true));
+            add(CheckFiles<BinaryText::Base32::Encoder, BinaryText::Base32::Decoder>(
+                "base32", directory, [](const std::string& s_) { return BinaryText::Reference::Base32::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Base32::EncodedFileSize(n_); }, BinaryText::Base32::MaximumDecodedFileSize, true));
+            add(CheckFiles<BinaryText::Base32Hex::Encoder, BinaryText::Base32Hex::Decoder>(
+                "base32hex", directory, [](const std::string& s_) { return BinaryText::Reference::Base32Hex::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Base32Hex::EncodedFileSize(n_); }, BinaryText::Base32Hex::MaximumDecodedFileSize, true));
+            add(CheckFiles<BinaryText::Base64::Encoder, BinaryText::Base64::Decoder>(
+                "base64", directory, [](const std::string& s_) { return BinaryText::Reference::Base64::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Base64::EncodedFileSize(n_); }, BinaryText::Base64::MaximumDecodedFileSize, true));
+            add(CheckFiles<BinaryText::Base64Url::Encoder, BinaryText::Base64Url::Decoder>(
+                "base64url", directory, [](const std::string& s_) { return BinaryText::Reference::Base64Url::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Base64Url::EncodedFileSize(n_); }, BinaryText::Base64Url::MaximumDecodedFileSize, true));
+            add(CheckFiles<BinaryText::Ascii85::Encoder, BinaryText::Ascii85::Decoder>(
+                "ascii85", directory, [](const std::string& s_) { return BinaryText::Reference::Ascii85::EncodeStringToString(s_); },
+                [](const std::uint64_t n_) { return BinaryText::Ascii85::MaximumEncodedFileSize(n_); }, BinaryText::Ascii85::MaximumDecodedFileSize, false));
+        } catch(...) {
+            std::filesystem::remove_all(directory);
+            throw;
+        }
+
+        std::filesystem::remove_all(directory);
+
+        add(CheckFileSizeLimit("Base16::EncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Base16::EncodedFileSize(n_); }, 1, 2));
+        add(CheckFileSizeLimit("Base32::EncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Base32::EncodedFileSize(n_); }, 5, 8));
+        add(CheckFileSizeLimit("Base32Hex::EncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Base32Hex::EncodedFileSize(n_, false); }, 5, 8));
+        add(CheckFileSizeLimit("Base64::EncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Base64::EncodedFileSize(n_); }, 3, 4));
+        add(CheckFileSizeLimit("Base64Url::EncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Base64Url::EncodedFileSize(n_, false); }, 3, 4));
+        add(CheckFileSizeLimit(
+            "Ascii85::MaximumEncodedFileSize", [](const std::uint64_t n_) { return BinaryText::Ascii85::MaximumEncodedFileSize(n_, true); }, 4, 5, 4));
+        add(CheckFileSizeLimit("Ascii85::MaximumDecodedFileSize", BinaryText::Ascii85::MaximumDecodedFileSize, 1, 4));
+
+        return mismatches;
+    }
+}
+
+int main()
+{
+    try {
+        const std::vector<std::vector<unsigned char>> inputs(Tests::MakeInputs());
+        std::size_t mismatchCount(0);
+
+        for(const std::vector<unsigned char>& input : inputs) {
+            for(const std::string& mismatch : Differential::Check(input)) {
+                if(mismatchCount < Tests::maximumPrintedMismatches) {
+                    std::cerr << mismatch << std::endl;
+                }
+
+                ++mismatchCount;
+            }
+        }
+
+        std::cerr << std::format("{} inputs, {} mismatches", inputs.size(), mismatchCount) << std::endl;
+
+        if(mismatchCount != 0) {
+            Utility::Exit("The optimized functions do not match the reference functions", -1);
+        }
+
+        const std::vector<std::string> fileMismatches(Tests::CheckAllFiles());
+
+        for(std::size_t index(0); index < fileMismatches.size() and index < Tests::maximumPrintedMismatches; ++index) {
+            std::cerr << fileMismatches[index] << std::endl;
+        }
+
+        std::cerr << std::format("Files: {} mismatches", fileMismatches.size()) << std::endl;
+
+        if(not fileMismatches.empty()) {
+            Utility::Exit("The file functions do not match the reference functions or the file size functions", -1);
+        }
+    } catch(const Utility::Error& error) {
+        Utility::Exit(error.What(), -1);
+    } catch(const std::exception& error) {
+        Utility::Exit(error.what(), -1);
+    }
+
+    return 0;
+}
\ No newline at end of file
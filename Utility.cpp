@@ -25,20 +25,57 @@ OTHER DEALINGS IN THE SOFTWARE.
 For more information, please refer to <https://unlicense.org>
 */
 
+#include <array>
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
 #include <cstdlib>
+#include <deque>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "BinaryText.hpp"
 #include "Utility.hpp"
 
+#if defined(_WIN32)
+#include <fcntl.h> // _O_BINARY
+#include <io.h>    // _setmode / _fileno
+#endif
+
 namespace Utility
 {
     void Arguments::ParseArguments(const std::vector<std::string_view>& argumentVector_)
     {
         Reset();
 
+        bool hasThreadCount(false);
+        bool hasBlockSize(false);
+        bool hasQueueDepth(false);
+        auto parseAlgorithm = [](const std::string_view algorithmOption_) -> Algorithm {
+            if(algorithmOption_ == "base16") {
+                return Algorithm::BASE_16;
+            } else if(algorithmOption_ == "base32") {
+                return Algorithm::BASE_32;
+            } else if(algorithmOption_ == "base32hex") {
+                return Algorithm::BASE_32_HEX;
+            } else if(algorithmOption_ == "base64") {
+                return Algorithm::BASE_64;
+            } else if(algorithmOption_ == "base64url") {
+                return Algorithm::BASE_64_URL;
+            } else if(algorithmOption_ == "ascii85") {
+                return Algorithm::ASCII_85;
+            } else {
+                return Algorithm::NONE;
+            }
+        };
+
         if(argumentVector_.size() >= 2) {
             for(std::vector<std::string_view>::const_iterator iter(std::next(argumentVector_.cbegin(), 1)); iter != argumentVector_.cend(); ++iter) {
                 if(*iter == "-h" or *iter == "--help") {
@@ -50,16 +87,26 @@ namespace Utility
                          "  --decode-text\n"
                          "  --decode-binary\n"
                          "  --input-string=OPTION\n"
-                         "  --input-file=OPTION\n"
-                         "  --output-file=OPTION\n"
-                         "  --algorithm=OPTION (base16, base32, base32hex, base64, base64url, ascii85)\n\n"
-                         "Base16 only:\n"
+                         "  --input-file=OPTION (- for stdin)\n"
+                         "  --output-file=OPTION (- for stdout without a newline at the end)\n"
+                         "  --algorithm=OPTION (base16, base32, base32hex, base64, base64url, ascii85)\n"
+                         "  --threads=OPTION (amount of threads for large inputs, 0 for one per hardware thread, the default is 1)\n"
+                         "  --block-size=OPTION (amount of bytes read at once when --input-file is streamed, the default is 1048576)\n"
+                         "  --async-io (a streamed --input-file is read and the output is written on threads of their own, while encoding or decoding)\n"
+                         "  --queue-depth=OPTION (amount of blocks read ahead or waiting to be written with --async-io, the default is 4)\n"
+                         "  --batch-file=OPTION (file with one INPUT_FILE<tab>OUTPUT_FILE per line, - for stdin)\n"
+                         "  --batch-records (every line of stdin is a record, the results are written to stdout line by line, not with --decode-binary)\n"
+                         "  --stats / --stats=OPTION (text, json; time and bytes of every stage, printed to stderr at the end)\n"
+                         "  --transcode=FROM:TO (converts FROM encoded text into TO encoded text, both are --algorithm options)\n\n"
+                         "Base16 only (with --transcode=FROM:TO only for TO, FROM is decoded in mixed case):\n"
                          "  --case=OPTION (lowercase, mixed, uppercase)\n\n"
-                         "Base32, Base32Hex, Base64 and Base64Url only (--encode-text and --encode-binary only):\n"
+                         "Base32, Base32Hex, Base64 and Base64Url only (--encode-text, --encode-binary and TO of --transcode=FROM:TO only):\n"
                          "  --without-padding\n\n"
-                         "Ascii85 only:\n"
+                         "Ascii85 only (with --transcode=FROM:TO for both FROM and TO):\n"
                          "  --fold-spaces\n"
-                         "  --adobe-mode",
+                         "  --adobe-mode\n\n"
+                         "--batch-records with --decode-text (every decoded record is written on one line):\n"
+                         "  \\ is written as \\\\, CR as \\r, LF as \\n and a record that fails to decode as \\!",
                          0);
                 } else if((*iter == "--encode-text")) {
                     switch(_task) {
@@ -68,6 +115,7 @@ namespace Utility
                         case Task::ENCODE_BINARY: throw Error("Conflicting arguments: \"--encode-text\" and \"--encode-binary\"");
                         case Task::DECODE_TEXT: throw Error("Conflicting arguments: \"--encode-text\" and \"--decode-text\"");
                         case Task::DECODE_BINARY: throw Error("Conflicting arguments: \"--encode-text\" and \"--decode-binary\"");
+                        case Task::TRANSCODE: throw Error("Conflicting arguments: \"--encode-text\" and \"--transcode=FROM:TO\"");
                     }
                 } else if(*iter == "--encode-binary") {
                     switch(_task) {
@@ -76,6 +124,7 @@ namespace Utility
                         case Task::ENCODE_BINARY: throw Error("Conflicting arguments: \"--encode-binary\"");
                         case Task::DECODE_TEXT: throw Error("Conflicting arguments: \"--encode-binary\" and \"--decode-text\"");
                         case Task::DECODE_BINARY: throw Error("Conflicting arguments: \"--encode-binary\" and \"--decode-binary\"");
+                        case Task::TRANSCODE: throw Error("Conflicting arguments: \"--encode-binary\" and \"--transcode=FROM:TO\"");
                     }
                 } else if(*iter == "--decode-text") {
                     switch(_task) {
@@ -84,6 +133,7 @@ namespace Utility
                         case Task::ENCODE_BINARY: throw Error("Conflicting arguments: \"--decode-text\" and \"--encode-binary\"");
                         case Task::DECODE_TEXT: throw Error("Conflicting arguments: \"--decode-text\"");
                         case Task::DECODE_BINARY: throw Error("Conflicting arguments: \"--decode-text\" and \"--decode-binary\"");
+                        case Task::TRANSCODE: throw Error("Conflicting arguments: \"--decode-text\" and \"--transcode=FROM:TO\"");
                     }
                 } else if(*iter == "--decode-binary") {
                     switch(_task) {
@@ -92,6 +142,7 @@ namespace Utility
                         case Task::ENCODE_BINARY: throw Error("Conflicting arguments: \"--decode-binary\" and \"--encode-binary\"");
                         case Task::DECODE_TEXT: throw Error("Conflicting arguments: \"--decode-binary\" and \"--decode-text\"");
                         case Task::DECODE_BINARY: throw Error("Conflicting arguments: \"--decode-binary\"");
+                        case Task::TRANSCODE: throw Error("Conflicting arguments: \"--decode-binary\" and \"--transcode=FROM:TO\"");
                     }
                 } else if(*iter == "--without-padding") {
                     if(_padding == Padding::NONE) {
@@ -131,6 +182,22 @@ namespace Utility
                     } else {
                         throw Error("Conflicting arguments: \"--input-file=OPTION\"");
                     }
+                } else if(*iter == "--batch-records") {
+                    if(not _isBatchRecords) {
+                        _isBatchRecords = true;
+                    } else {
+                        throw Error("Conflicting arguments: \"--batch-records\"");
+                    }
+                } else if(argument = "--batch-file="; iter->find(argument) == 0) {
+                    if(_batchFilePath.empty()) {
+                        _batchFilePath = iter->substr(argument.size(), iter->size());
+
+                        if(_batchFilePath.empty()) {
+                            throw Error("Empty batch file path");
+                        }
+                    } else {
+                        throw Error("Conflicting arguments: \"--batch-file=OPTION\"");
+                    }
                 } else if(argument = "--output-file="; iter->find(argument) == 0) {
                     if(_outputFilePath.empty()) {
                         _outputFilePath = iter->substr(argument.size(), iter->size());
@@ -145,24 +212,43 @@ namespace Utility
                     if(_algorithm == Algorithm::NONE) {
                         const std::string_view algorithmOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
 
-                        if(algorithmOption == "base16") {
-                            _algorithm = Algorithm::BASE_16;
-                        } else if(algorithmOption == "base32") {
-                            _algorithm = Algorithm::BASE_32;
-                        } else if(algorithmOption == "base32hex") {
-                            _algorithm = Algorithm::BASE_32_HEX;
-                        } else if(algorithmOption == "base64") {
-                            _algorithm = Algorithm::BASE_64;
-                        } else if(algorithmOption == "base64url") {
-                            _algorithm = Algorithm::BASE_64_URL;
-                        } else if(algorithmOption == "ascii85") {
-                            _algorithm = Algorithm::ASCII_85;
-                        } else {
+                        _algorithm = parseAlgorithm(algorithmOption);
+
+                        if(_algorithm == Algorithm::NONE) {
                             throw Error(std::format("Invalid algorithm : \"{}\"", algorithmOption));
                         }
+                    } else if(_task == Task::TRANSCODE) {
+                        throw Error("Conflicting arguments: \"--algorithm=OPTION\" and \"--transcode=FROM:TO\"");
                     } else {
                         throw Error("Conflicting arguments: \"--algorithm=OPTION\"");
                     }
+                } else if(argument = "--transcode="; iter->find(argument) == 0) {
+                    switch(_task) {
+                        case Task::NONE: break;
+                        case Task::ENCODE_TEXT: throw Error("Conflicting arguments: \"--transcode=FROM:TO\" and \"--encode-text\"");
+                        case Task::ENCODE_BINARY: throw Error("Conflicting arguments: \"--transcode=FROM:TO\" and \"--encode-binary\"");
+                        case Task::DECODE_TEXT: throw Error("Conflicting arguments: \"--transcode=FROM:TO\" and \"--decode-text\"");
+                        case Task::DECODE_BINARY: throw Error("Conflicting arguments: \"--transcode=FROM:TO\" and \"--decode-binary\"");
+                        case Task::TRANSCODE: throw Error("Conflicting arguments: \"--transcode=FROM:TO\"");
+                    }
+
+                    if(_algorithm != Algorithm::NONE) {
+                        throw Error("Conflicting arguments: \"--transcode=FROM:TO\" and \"--algorithm=OPTION\"");
+                    }
+
+                    const std::string_view transcodeOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
+                    const std::size_t separator(transcodeOption.find(':'));
+
+                    if(separator != std::string_view::npos) {
+                        _algorithm = parseAlgorithm(transcodeOption.substr(0, separator));
+                        _targetAlgorithm = parseAlgorithm(transcodeOption.substr(separator + 1));
+                    }
+
+                    if(_algorithm == Algorithm::NONE or _targetAlgorithm == Algorithm::NONE) {
+                        throw Error(std::format("Invalid algorithms to transcode: \"{}\"", transcodeOption));
+                    }
+
+                    _task = Task::TRANSCODE;
                 } else if(argument = "--case="; iter->find(argument) == 0) {
                     if(_case == Case::NONE) {
                         const std::string_view caseOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
@@ -179,25 +265,124 @@ namespace Utility
                     } else {
                         throw Error("Conflicting arguments: \"--case=OPTION\"");
                     }
+                } else if(argument = "--threads="; iter->find(argument) == 0) {
+                    if(not hasThreadCount) {
+                        const std::string_view threadsOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
+                        const std::from_chars_result result(std::from_chars(threadsOption.data(), threadsOption.data() + threadsOption.size(), _threadCount));
+
+                        if(threadsOption.empty() or result.ec != std::errc() or result.ptr != threadsOption.data() + threadsOption.size()) {
+                            throw Error(std::format("Invalid amount of threads: \"{}\"", threadsOption));
+                        }
+
+                        hasThreadCount = true;
+                    } else {
+                        throw Error("Conflicting arguments: \"--threads=OPTION\"");
+                    }
+                } else if(argument = "--block-size="; iter->find(argument) == 0) {
+                    if(not hasBlockSize) {
+                        const std::string_view blockSizeOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
+                        const std::from_chars_result result(
+                            std::from_chars(blockSizeOption.data(), blockSizeOption.data() + blockSizeOption.size(), _blockSize));
+
+                        if(blockSizeOption.empty() or result.ec != std::errc() or result.ptr != blockSizeOption.data() + blockSizeOption.size()
+                           or _blockSize == 0) {
+                            throw Error(std::format("Invalid block size: \"{}\"", blockSizeOption));
+                        }
+
+                        hasBlockSize = true;
+                    } else {
+                        throw Error("Conflicting arguments: \"--block-size=OPTION\"");
+                    }
+                } else if(*iter == "--async-io") {
+                    if(not _isAsyncIo) {
+                        _isAsyncIo = true;
+                    } else {
+                        throw Error("Conflicting arguments: \"--async-io\"");
+                    }
+                } else if(argument = "--queue-depth="; iter->find(argument) == 0) {
+                    if(not hasQueueDepth) {
+                        const std::string_view queueDepthOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
+                        const std::from_chars_result result(
+                            std::from_chars(queueDepthOption.data(), queueDepthOption.data() + queueDepthOption.size(), _queueDepth));
+
+                        if(queueDepthOption.empty() or result.ec != std::errc() or result.ptr != queueDepthOption.data() + queueDepthOption.size()
+                           or _queueDepth == 0) {
+                            throw Error(std::format("Invalid queue depth: \"{}\"", queueDepthOption));
+                        }
+
+                        hasQueueDepth = true;
+                    } else {
+                        throw Error("Conflicting arguments: \"--queue-depth=OPTION\"");
+                    }
+                } else if(*iter == "--stats") {
+                    if(_statisticsFormat == StatisticsFormat::NONE) {
+                        _statisticsFormat = StatisticsFormat::TEXT;
+                    } else {
+                        throw Error("Conflicting arguments: \"--stats\"");
+                    }
+                } else if(argument = "--stats="; iter->find(argument) == 0) {
+                    if(_statisticsFormat == StatisticsFormat::NONE) {
+                        const std::string_view statsOption(std::next(iter->cbegin(), static_cast<std::ptrdiff_t>(argument.size())), iter->cend());
+
+                        if(statsOption == "text") {
+                            _statisticsFormat = StatisticsFormat::TEXT;
+                        } else if(statsOption == "json") {
+                            _statisticsFormat = StatisticsFormat::JSON;
+                        } else {
+                            throw Error(std::format("Invalid statistics format: \"{}\"", statsOption));
+                        }
+                    } else {
+                        throw Error("Conflicting arguments: \"--stats\"");
+                    }
                 } else {
                     throw Error(std::format("Invalid argument: \"{}\"", *iter));
                 }
             }
 
+            if(hasQueueDepth and not _isAsyncIo) {
+                throw Error("No \"--async-io\" argument provided for \"--queue-depth=OPTION\"");
+            }
+
             if(_task == Task::NONE) {
-                throw Error("No \"--encode-text\", \"--encode-binary\", \"--decode-text\" or \"--decode-binary\" argument provided");
-            } else if(_task == Task::DECODE_BINARY) {
-                if(_outputFilePath.empty()) {
+                throw Error("No \"--encode-text\", \"--encode-binary\", \"--decode-text\", \"--decode-binary\" or \"--transcode=FROM:TO\" argument provided");
+            }
+
+            if(not _batchFilePath.empty() or _isBatchRecords) {
+                const std::string_view batchArgument(_isBatchRecords ? "--batch-records" : "--batch-file=OPTION");
+
+                if(not _batchFilePath.empty() and _isBatchRecords) {
+                    throw Error("Conflicting arguments: \"--batch-file=OPTION\" and \"--batch-records\"");
+                } else if(_task == Task::TRANSCODE) {
+                    throw Error(std::format("Conflicting arguments: \"--transcode=FROM:TO\" and \"{}\"", batchArgument));
+                } else if(_isBatchRecords and _task == Task::DECODE_BINARY) {
+                    throw Error("Conflicting arguments: \"--decode-binary\" and \"--batch-records\"");
+                } else if(_isAsyncIo) {
+                    throw Error(std::format("Conflicting arguments: \"--async-io\" and \"{}\"", batchArgument));
+                } else if(not _inputString.empty()) {
+                    throw Error(std::format("Conflicting arguments: \"--input-string=OPTION\" and \"{}\"", batchArgument));
+                } else if(not _inputFilePath.empty()) {
+                    throw Error(std::format("Conflicting arguments: \"--input-file=OPTION\" and \"{}\"", batchArgument));
+                } else if(not _outputFilePath.empty()) {
+                    throw Error(std::format("Conflicting arguments: \"--output-file=OPTION\" and \"{}\"", batchArgument));
+                }
+            } else {
+                if(_task == Task::DECODE_BINARY and _outputFilePath.empty()) {
                     throw Error("No \"--output-file=OPTION\" argument provided");
                 }
-            }
 
-            if(not _inputString.empty() and not _inputFilePath.empty()) {
-                throw Error("Conflicting arguments: \"--input-string=OPTION\" and \"--input-file=OPTION\"");
+                if(not _inputString.empty() and not _inputFilePath.empty()) {
+                    throw Error("Conflicting arguments: \"--input-string=OPTION\" and \"--input-file=OPTION\"");
+                }
+
+                if(_inputString.empty() and _inputFilePath.empty()) {
+                    throw Error("No \"--input-string=OPTION\" or \"--input-file=OPTION\" argument provided");
+                }
             }
 
-            if(_inputString.empty() and _inputFilePath.empty()) {
-                throw Error("No \"--input-string=OPTION\" or \"--input-file=OPTION\" argument provided");
+            if(_task == Task::TRANSCODE) {
+                CheckTranscodeArguments();
+
+                return;
             }
 
             switch(_algorithm) {
@@ -348,10 +533,49 @@ namespace Utility
         _padding = Padding::NONE;
         _spaceFolding = SpaceFolding::NONE;
         _adobeMode = AdobeMode::NONE;
+        _targetAlgorithm = Algorithm::NONE;
+        _threadCount = 1;
+        _blockSize = defaultBlockSize;
+        _isAsyncIo = false;
+        _queueDepth = defaultQueueDepth;
 
         _inputString.clear();
         _inputFilePath.clear();
         _outputFilePath.clear();
+        _batchFilePath.clear();
+        _isBatchRecords = false;
+        _statisticsFormat = StatisticsFormat::NONE;
+    }
+
+    void Arguments::CheckTranscodeArguments()
+    {
+        const bool isTargetPadded(_targetAlgorithm == Algorithm::BASE_32 or _targetAlgorithm == Algorithm::BASE_32_HEX or _targetAlgorithm == Algorithm::BASE_64
+                                  or _targetAlgorithm == Algorithm::BASE_64_URL);
+
+        if(_targetAlgorithm == Algorithm::BASE_16) {
+            if(_case == Case::MIXED) {
+                throw Error("Conflicting arguments: \"--case=mixed\" and \"--transcode=FROM:TO\"");
+            } else if(_case == Case::NONE) {
+                _case = Case::UPPERCASE;
+            }
+        } else if(_case != Case::NONE) {
+            throw Error("Conflicting arguments: \"--case=OPTION\" and \"--transcode=FROM:TO\" without base16 as TO");
+        }
+
+        if(isTargetPadded) {
+            _padding = (_padding == Padding::NONE) ? Padding::ENABLE_PADDING : _padding;
+        } else if(_padding != Padding::NONE) {
+            throw Error("Conflicting arguments: \"--without-padding\" and \"--transcode=FROM:TO\" without base32, base32hex, base64 or base64url as TO");
+        }
+
+        if(_algorithm == Algorithm::ASCII_85 or _targetAlgorithm == Algorithm::ASCII_85) {
+            _spaceFolding = (_spaceFolding == SpaceFolding::NONE) ? SpaceFolding::DISABLE_SPACE_FOLDING : _spaceFolding;
+            _adobeMode = (_adobeMode == AdobeMode::NONE) ? AdobeMode::DISABLE_ADOBE_MODE : _adobeMode;
+        } else if(_spaceFolding != SpaceFolding::NONE) {
+            throw Error("Conflicting arguments: \"--fold-spaces\" and \"--transcode=FROM:TO\" without ascii85");
+        } else if(_adobeMode != AdobeMode::NONE) {
+            throw Error("Conflicting arguments: \"--adobe-mode\" and \"--transcode=FROM:TO\" without ascii85");
+        }
     }
 
     [[noreturn]] void UnreachableTerminate(const std::source_location sourceLocation_) noexcept
@@ -374,36 +598,453 @@ namespace Utility
         std::exit(exitCode_);
     }
 
-    void WriteStringToFile(const std::string& string_, const std::filesystem::path& filePath_)
+    /// @brief Queue and thread of a StreamOutput that writes asynchronously.
+    struct StreamOutput::Writer
     {
-        std::ofstream fileStream(filePath_, std::ofstream::out | std::ofstream::trunc);
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::string> pieces;     ///< Pieces waiting to be written, oldest first.
+        std::vector<std::string> freePieces; ///< Written pieces whose memory is reused for the next ones.
+        bool isFinished = false;            ///< Set once no more pieces are queued.
+        std::string errorMessage;           ///< Why writing failed, empty as long as it did not.
+        std::thread thread;
+    };
 
-        if(not fileStream.is_open()) {
-            throw Error("Failed to open file");
+    StreamOutput::StreamOutput() :
+        _fileStream(),
+        _isFile(false),
+        _endsWithNewline(true),
+        _queueDepth(0),
+        _writer()
+    {}
+
+    StreamOutput::StreamOutput(const std::filesystem::path& filePath_) :
+        _fileStream(),
+        _isFile(filePath_ != "-"),
+        _endsWithNewline(false),
+        _queueDepth(0),
+        _writer()
+    {
+        if(_isFile) {
+            _fileStream.open(filePath_, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+            if(not _fileStream.is_open()) {
+                throw Error("Failed to open file");
+            }
+        } else {
+#if defined(_WIN32)
+            _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        }
+    }
+
+    StreamOutput::StreamOutput(StreamOutput&&) = default;
+
+    StreamOutput::~StreamOutput()
+    {
+        if(_writer) {
+            try {
+                StopWriter();
+            } catch(const Error&) {
+            }
+        }
+    }
+
+    void StreamOutput::Write(const std::string_view string_)
+    {
+        if(_queueDepth == 0) {
+            WriteNow(string_);
+
+            return;
+        }
+
+        if(not _writer) {
+            _writer = std::make_unique<Writer>();
+            _writer->thread = std::thread([this, &writer = *_writer]() {
+                std::unique_lock lock(writer.mutex);
+
+                while(true) {
+                    writer.condition.wait(lock, [&writer]() { return not writer.pieces.empty() or writer.isFinished; });
+
+                    if(writer.pieces.empty()) {
+                        return;
+                    }
+
+                    std::string piece(std::move(writer.pieces.front()));
+
+                    writer.pieces.pop_front();
+                    lock.unlock();
+
+                    try {
+                        WriteNow(piece);
+                    } catch(const Error& error) {
+                        lock.lock();
+                        writer.errorMessage = error.What();
+                        writer.pieces.clear();
+                        writer.condition.notify_all();
+
+                        return;
+                    }
+
+                    piece.clear();
+                    lock.lock();
+                    writer.freePieces.push_back(std::move(piece));
+                    writer.condition.notify_all();
+                }
+            });
+        }
+
+        std::unique_lock lock(_writer->mutex);
+
+        _writer->condition.wait(lock, [this]() { return _writer->pieces.size() < _queueDepth or not _writer->errorMessage.empty(); });
+
+        if(not _writer->errorMessage.empty()) {
+            throw Error(_writer->errorMessage);
+        }
+
+        std::string piece;
+
+        if(not _writer->freePieces.empty()) {
+            piece = std::move(_writer->freePieces.back());
+            _writer->freePieces.pop_back();
+        }
+
+        // The copy is made without holding the lock, so that the writer thread can go on meanwhile
+        lock.unlock();
+        piece.assign(string_);
+        lock.lock();
+        _writer->pieces.push_back(std::move(piece));
+        _writer->condition.notify_all();
+    }
+
+    void StreamOutput::Finish()
+    {
+        if(_writer) {
+            StopWriter();
         }
 
-        fileStream << string_;
+        if(_isFile) {
+            _fileStream.flush();
 
-        if(fileStream.fail()) {
-            throw Error("Failed to write to file");
+            if(_fileStream.fail()) {
+                throw Error("Failed to write to file");
+            }
+        } else if((_endsWithNewline and std::fputc('\n', stdout) == EOF) or std::fflush(stdout) == EOF) {
+            throw Error("Failed to write to stdout");
+        }
+    }
+
+    void StreamOutput::WriteNow(const std::string_view string_)
+    {
+        BinaryText::Statistics::StageTimer timer(BinaryText::Statistics::Stage::WRITE, string_.size());
+
+        if(_isFile) {
+            _fileStream.write(string_.data(), static_cast<std::streamsize>(string_.size()));
+
+            if(_fileStream.fail()) {
+                throw Error("Failed to write to file");
+            }
+        } else if(std::fwrite(string_.data(), 1, string_.size(), stdout) != string_.size()) {
+            throw Error("Failed to write to stdout");
+        }
+    }
+
+    void StreamOutput::StopWriter()
+    {
+        {
+            std::lock_guard lock(_writer->mutex);
+
+            _writer->isFinished = true;
+        }
+
+        _writer->condition.notify_all();
+        _writer->thread.join();
+
+        const std::string errorMessage(std::move(_writer->errorMessage));
+
+        _writer.reset();
+
+        if(not errorMessage.empty()) {
+            throw Error(errorMessage);
         }
     }
 
+    void WriteStringToFile(const std::string& string_, const std::filesystem::path& filePath_)
+    {
+        StreamOutput output(filePath_);
+
+        output.Write(string_);
+        output.Finish();
+    }
+
     std::string ReadStringFromFile(const std::filesystem::path& filePath_)
     {
-        std::ifstream fileStream(filePath_, std::ifstream::in);
-        std::string fileString;
+        if(filePath_ == "-") {
+            std::string inputString;
+
+            ReadFileInBlocks(filePath_, Arguments::defaultBlockSize, [&inputString](const std::string_view block_) { inputString.append(block_); });
+
+            return inputString;
+        }
+
+        BinaryText::Statistics::StageTimer timer(BinaryText::Statistics::Stage::READ);
+        std::ifstream fileStream(filePath_, std::ifstream::in | std::ifstream::binary);
 
         if(not fileStream.is_open()) {
             throw Error("Failed to open file");
         }
 
-        fileStream >> fileString;
+        std::string fileString((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
 
-        if(fileStream.fail() and not fileStream.eof()) {
+        if(fileStream.bad()) {
             throw Error("Failed to read from file");
         }
 
+        timer.AddInputSize(fileString.size());
+
         return fileString;
     }
+
+    /// @brief Reads a file in binary mode block by block, or stdin if the path is -.
+    class BlockReader
+    {
+    public:
+        /**
+         * @brief Opens a given file, or stdin if the path is -.
+         * @param[in] filePath_ Path to file.
+         * @throws Utility::Error
+        */
+        explicit BlockReader(const std::filesystem::path& filePath_) :
+            _fileStream(),
+            _isStandardInput(filePath_ == "-"),
+            _isFinished(false)
+        {
+            if(_isStandardInput) {
+#if defined(_WIN32)
+                _setmode(_fileno(stdin), _O_BINARY);
+#endif
+            } else {
+                _fileStream.open(filePath_, std::ifstream::in | std::ifstream::binary);
+
+                if(not _fileStream.is_open()) {
+                    throw Error("Failed to open file");
+                }
+            }
+        }
+
+        /**
+         * @brief Reads the next block, which is only shorter than the given block if the end of the file is reached.
+         * @param[out] block_ Block to read into.
+         * @returns Amount of bytes read.
+         * @throws Utility::Error
+        */
+        std::size_t Read(std::vector<char>& block_)
+        {
+            std::size_t readSize(0);
+
+            // Only the reading is measured, the function that gets the block is part of the stage it does the work of
+            {
+                BinaryText::Statistics::StageTimer timer(BinaryText::Statistics::Stage::READ);
+
+                if(_isStandardInput) {
+                    readSize = std::fread(block_.data(), 1, block_.size(), stdin);
+                } else {
+                    _fileStream.read(block_.data(), static_cast<std::streamsize>(block_.size()));
+                    readSize = static_cast<std::size_t>(_fileStream.gcount());
+                }
+
+                timer.AddInputSize(readSize);
+            }
+
+            if(_isStandardInput) {
+                if(std::ferror(stdin)) {
+                    throw Error("Failed to read from stdin");
+                }
+
+                _isFinished = readSize < block_.size();
+            } else {
+                if(_fileStream.bad()) {
+                    throw Error("Failed to read from file");
+                }
+
+                _isFinished = not _fileStream;
+            }
+
+            return readSize;
+        }
+        /**
+         * @brief Checks if the end of the file was reached.
+         * @returns Whether or not the file was read completely.
+        */
+        bool IsFinished() const noexcept { return _isFinished; }
+
+    private:
+        std::ifstream _fileStream;
+        bool _isStandardInput;
+        bool _isFinished;
+    };
+
+    void ReadFileInBlocks(const std::filesystem::path& filePath_, const std::size_t blockSize_, const std::function<void(std::string_view)>& function_)
+    {
+        BlockReader reader(filePath_);
+        std::vector<char> block(blockSize_);
+
+        while(not reader.IsFinished()) {
+            const std::size_t readSize(reader.Read(block));
+
+            if(readSize > 0) {
+                function_(std::string_view(block.data(), readSize));
+            }
+        }
+    }
+
+    void ReadFileInBlocksAsync(const std::filesystem::path& filePath_, const std::size_t blockSize_, const std::size_t queueDepth_,
+                               const std::function<void(std::string_view)>& function_)
+    {
+        BlockReader reader(filePath_);
+        // The blocks read ahead and the one the function works on
+        std::vector<std::vector<char>> blocks(queueDepth_ + 1, std::vector<char>(blockSize_));
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::pair<std::size_t, std::size_t>> readBlocks; // Index and size of the blocks that were read, oldest first
+        std::vector<std::size_t> freeBlocks;
+        bool isFinished(false);
+        bool isStopped(false);
+        std::string errorMessage;
+
+        for(std::size_t i(0); i < blocks.size(); ++i) {
+            freeBlocks.push_back(i);
+        }
+
+        std::thread thread([&]() {
+            std::unique_lock lock(mutex);
+
+            while(true) {
+                condition.wait(lock, [&]() { return not freeBlocks.empty() or isStopped; });
+
+                if(isStopped) {
+                    return;
+                }
+
+                const std::size_t index(freeBlocks.back());
+                std::size_t readSize(0);
+
+                freeBlocks.pop_back();
+                lock.unlock();
+
+                try {
+                    readSize = reader.Read(blocks[index]);
+                } catch(const Error& error) {
+                    lock.lock();
+                    errorMessage = error.What();
+                    isFinished = true;
+                    condition.notify_all();
+
+                    return;
+                }
+
+                lock.lock();
+                readBlocks.emplace_back(index, readSize);
+                isFinished = reader.IsFinished();
+                condition.notify_all();
+
+                if(isFinished) {
+                    return;
+                }
+            }
+        });
+        const auto stop([&]() {
+            {
+                std::lock_guard lock(mutex);
+
+                isStopped = true;
+            }
+
+            condition.notify_all();
+            thread.join();
+        });
+
+        try {
+            std::unique_lock lock(mutex);
+
+            while(true) {
+                condition.wait(lock, [&]() { return not readBlocks.empty() or isFinished; });
+
+                // The blocks that were read before an error are still passed on, like ReadFileInBlocks does
+                if(readBlocks.empty()) {
+                    break;
+                }
+
+                const auto [index, readSize] = readBlocks.front();
+
+                readBlocks.pop_front();
+                lock.unlock();
+
+                if(readSize > 0) {
+                    function_(std::string_view(blocks[index].data(), readSize));
+                }
+
+                lock.lock();
+                freeBlocks.push_back(index);
+                condition.notify_all();
+            }
+        } catch(...) {
+            stop();
+
+            throw;
+        }
+
+        stop();
+
+        if(not errorMessage.empty()) {
+            throw Error(errorMessage);
+        }
+    }
+
+    void PrintStatistics(const Arguments::StatisticsFormat statisticsFormat_)
+    {
+        if(statisticsFormat_ == Arguments::StatisticsFormat::NONE) {
+            return;
+        } else if(not BinaryText::Statistics::isEnabled) {
+            if(statisticsFormat_ == Arguments::StatisticsFormat::JSON) {
+                std::cerr << "{\"enabled\": false}" << std::endl;
+            } else {
+                std::cerr << "Statistics are not available, BinaryText.hpp was included without BINARYTEXT_ENABLE_STATISTICS" << std::endl;
+            }
+
+            return;
+        }
+
+        constexpr std::array<std::string_view, BinaryText::Statistics::stageCount> stageNames{"read", "encode", "decode", "write"};
+        const BinaryText::Statistics::Snapshot snapshot(BinaryText::Statistics::GetSnapshot());
+        const bool isJson(statisticsFormat_ == Arguments::StatisticsFormat::JSON);
+
+        std::cerr << (isJson ? "{\"enabled\": true, \"stages\": {" : "Statistics:\n");
+
+        for(std::size_t i(0); i < stageNames.size(); ++i) {
+            const BinaryText::Statistics::StageSnapshot& stage(snapshot.stages[i]);
+            const double seconds(static_cast<double>(stage.nanoseconds) / 1e9);
+            // Throughput is measured on the bytes or characters that went in, like in batch mode
+            const double throughput((seconds > 0.0) ? (static_cast<double>(stage.inputSize) / 1e6) / seconds : 0.0);
+
+            if(isJson) {
+                std::cerr << std::format("\"{}\": {{\"calls\": {}, \"input_size\": {}, \"output_size\": {}, \"seconds\": {:.9f}, \"mb_per_s\": {:.3f}}}{}",
+                                         stageNames[i], stage.callCount, stage.inputSize, stage.outputSize, seconds, throughput,
+                                         (i + 1 < stageNames.size()) ? ", " : "");
+            } else {
+                std::cerr << std::format("  {}: {} calls, {} -> {} bytes in {:.6f} seconds ({:.1f} MB/s)\n", stageNames[i], stage.callCount, stage.inputSize,
+                                         stage.outputSize, seconds, throughput);
+            }
+        }
+
+        if(isJson) {
+            std::cerr << std::format("}}, \"allocations\": {}, \"allocation_size\": {}, \"reallocations\": {}}}", snapshot.allocationCount,
+                                     snapshot.allocationSize, snapshot.reallocationCount)
+                      << std::endl;
+        } else {
+            std::cerr << std::format("  ByteBuffer: {} allocations ({} bytes), {} reallocations", snapshot.allocationCount, snapshot.allocationSize,
+                                     snapshot.reallocationCount)
+                      << std::endl;
+        }
+    }
 }
\ No newline at end of file
@@ -27,8 +27,12 @@ For more information, please refer to <https://unlicense.org>
 
 #pragma once
 
+#include <cstddef>
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
 #include <source_location>
 #include <string>
 #include <string_view>
@@ -48,7 +52,8 @@ namespace Utility
             ENCODE_TEXT,   ///< Encodes in text mode (`--encode-text`).
             ENCODE_BINARY, ///< Encodes in binary mode (`--encode-binary`).
             DECODE_TEXT,   ///< Decodes in text mode (`--decode-text`).
-            DECODE_BINARY  ///< Decodes in binary mode (`--decode-binary`).
+            DECODE_BINARY, ///< Decodes in binary mode (`--decode-binary`).
+            TRANSCODE      ///< Converts from one algorithm into another (`--transcode=FROM:TO`).
         };
 
         /// @brief Algorithm to use.
@@ -96,6 +101,19 @@ namespace Utility
             DISABLE_ADOBE_MODE ///< Disable Adobe mode.
         };
 
+        /// @brief How to print the time and bytes of every stage at the end.
+        enum class StatisticsFormat
+        {
+            NONE, ///< Nothing is printed.
+            TEXT, ///< Human readable text (`--stats` or `--stats=text`).
+            JSON  ///< A JSON object (`--stats=json`).
+        };
+
+        /// @brief Default amount of bytes read at once from the input file when streaming.
+        static constexpr std::size_t defaultBlockSize = 1 << 20;
+        /// @brief Default amount of blocks that are read ahead or waiting to be written with `--async-io`.
+        static constexpr std::size_t defaultQueueDepth = 4;
+
         /// @brief A simple error class for the Arguments class.
         class Error : public std::exception
         {
@@ -133,7 +151,14 @@ namespace Utility
             _case(Case::NONE),
             _padding(Padding::NONE),
             _spaceFolding(SpaceFolding::NONE),
-            _adobeMode(AdobeMode::NONE)
+            _adobeMode(AdobeMode::NONE),
+            _targetAlgorithm(Algorithm::NONE),
+            _threadCount(1),
+            _blockSize(defaultBlockSize),
+            _isAsyncIo(false),
+            _queueDepth(defaultQueueDepth),
+            _isBatchRecords(false),
+            _statisticsFormat(StatisticsFormat::NONE)
         {}
         /**
          * @brief Creates an Arguments object with data from given command-line arguments.
@@ -146,7 +171,14 @@ namespace Utility
             _case(Case::NONE),
             _padding(Padding::NONE),
             _spaceFolding(SpaceFolding::NONE),
-            _adobeMode(AdobeMode::NONE)
+            _adobeMode(AdobeMode::NONE),
+            _targetAlgorithm(Algorithm::NONE),
+            _threadCount(1),
+            _blockSize(defaultBlockSize),
+            _isAsyncIo(false),
+            _queueDepth(defaultQueueDepth),
+            _isBatchRecords(false),
+            _statisticsFormat(StatisticsFormat::NONE)
         {
             ParseArguments(argumentVector_);
         }
@@ -163,6 +195,12 @@ namespace Utility
          * @throws Utility::Arguments::Error
         */
         Algorithm GetAlgorithm() const { return (_algorithm != Algorithm::NONE) ? _algorithm : throw Error(); }
+        /**
+         * @brief Gets the Algorithm to convert into (TO of `--transcode=FROM:TO`) if it was passed. If it was not an Error is thrown.
+         * @returns Algorithm that was passed.
+         * @throws Utility::Arguments::Error
+        */
+        Algorithm GetTargetAlgorithm() const { return (_targetAlgorithm != Algorithm::NONE) ? _targetAlgorithm : throw Error(); }
         /**
          * @brief Gets Case if it was passed. If it was not an Error is thrown.
          * @returns Case that was passed.
@@ -187,6 +225,26 @@ namespace Utility
          * @throws Utility::Arguments::Error
         */
         AdobeMode GetAdobeMode() const { return (_adobeMode != AdobeMode::NONE) ? _adobeMode : throw Error(); }
+        /**
+         * @brief Gets the amount of threads to use (`--threads=OPTION`). The default is 1 and 0 means one per hardware thread.
+         * @returns Amount of threads to use.
+        */
+        std::size_t GetThreadCount() const noexcept { return _threadCount; }
+        /**
+         * @brief Gets the amount of bytes read at once from the input file when streaming (`--block-size=OPTION`).
+         * @returns Amount of bytes read at once.
+        */
+        std::size_t GetBlockSize() const noexcept { return _blockSize; }
+        /**
+         * @brief Checks if a streamed input file is read and the output is written on threads of their own, overlapped with the codec (`--async-io`).
+         * @returns Whether or not asynchronous I/O is used.
+        */
+        bool IsAsyncIo() const noexcept { return _isAsyncIo; }
+        /**
+         * @brief Gets the amount of blocks that are read ahead or waiting to be written with `--async-io` (`--queue-depth=OPTION`). The default is 4.
+         * @returns Amount of blocks in flight.
+        */
+        std::size_t GetQueueDepth() const noexcept { return _queueDepth; }
         /**
          * @brief Gets constant reference to input string if it was passed. If it was not an Error is thrown.
          * @returns Constant reference to input string that was passed.
@@ -220,6 +278,42 @@ namespace Utility
          * @returns Whether or not the output file path was passed.
         */
         bool HasOutputFilePath() const noexcept { return not _outputFilePath.empty(); }
+        /**
+         * @brief Checks if the input is read from stdin (`--input-file=-`).
+         * @returns Whether or not the input is read from stdin.
+        */
+        bool IsInputStandardInput() const noexcept { return _inputFilePath == "-"; }
+        /**
+         * @brief Checks if the output is written to stdout without a newline at the end (`--output-file=-`).
+         * @returns Whether or not the output is written to stdout.
+        */
+        bool IsOutputStandardOutput() const noexcept { return _outputFilePath == "-"; }
+        /**
+         * @brief Gets constant reference to batch file path if it was passed. If it was not an Error is thrown.
+         * @returns Constant reference to batch file path that was passed.
+         * @throws Utility::Arguments::Error
+        */
+        const std::filesystem::path& GetBatchFilePath() const { return (not _batchFilePath.empty()) ? _batchFilePath : throw Error(); }
+        /**
+         * @brief Checks if the batch file path was passed.
+         * @returns Whether or not the batch file path was passed.
+        */
+        bool HasBatchFilePath() const noexcept { return not _batchFilePath.empty(); }
+        /**
+         * @brief Checks if records are read from stdin and written to stdout line by line (`--batch-records`).
+         * @returns Whether or not records are processed.
+        */
+        bool IsBatchRecords() const noexcept { return _isBatchRecords; }
+        /**
+         * @brief Checks if many inputs are processed at once, either with `--batch-file=OPTION` or with `--batch-records`.
+         * @returns Whether or not batch mode is used.
+        */
+        bool IsBatch() const noexcept { return HasBatchFilePath() or _isBatchRecords; }
+        /**
+         * @brief Gets how the statistics are printed at the end (`--stats` / `--stats=OPTION`).
+         * @returns StatisticsFormat that was passed, StatisticsFormat::NONE if none was.
+        */
+        StatisticsFormat GetStatisticsFormat() const noexcept { return _statisticsFormat; }
         /**
          * @brief Parses data from given command-line arguments.
          * @param[in] argumentVector_ Vector of command-line arguments.
@@ -230,6 +324,11 @@ namespace Utility
     private:
         /// @brief Resets the internal state of the Arguments object.
         void Reset();
+        /**
+         * @brief Checks the options of `--transcode=FROM:TO` and fills in the defaults, ParseArguments does the same for the other tasks.
+         * @throws Utility::Arguments::Error
+        */
+        void CheckTranscodeArguments();
 
         Task _task;
         Algorithm _algorithm;
@@ -237,9 +336,17 @@ namespace Utility
         Padding _padding;
         SpaceFolding _spaceFolding;
         AdobeMode _adobeMode;
+        Algorithm _targetAlgorithm;
+        std::size_t _threadCount;
+        std::size_t _blockSize;
+        bool _isAsyncIo;
+        std::size_t _queueDepth;
         std::string _inputString;
         std::filesystem::path _inputFilePath;
         std::filesystem::path _outputFilePath;
+        std::filesystem::path _batchFilePath;
+        bool _isBatchRecords;
+        StatisticsFormat _statisticsFormat;
     };
 
     /// @brief A simple error class for the Utility namespace. It is not used in the Arguments class.
@@ -281,18 +388,107 @@ namespace Utility
      * @param[in] exitCode_ Exit code to be used.
     */
     [[noreturn]] void Exit(const std::string& exitMessage_, const int exitCode_) noexcept;
+    /// @brief Writes output piece by piece, either into a file or to stdout.
+    class StreamOutput
+    {
+    public:
+        /// @brief Creates a StreamOutput that writes to stdout and ends the output with a newline.
+        StreamOutput();
+        /**
+         * Creates a StreamOutput that writes into a given file in binary mode, the file is truncated. The path - writes to stdout in binary mode
+         * instead, without a newline at the end.
+         *
+         * @param[in] filePath_ Path to file.
+         * @throws Utility::Error
+        */
+        explicit StreamOutput(const std::filesystem::path& filePath_);
+        StreamOutput(StreamOutput&&);
+        /// @brief Writes the pieces that are still queued and stops the writer thread, errors are ignored. Call Finish to see them.
+        ~StreamOutput();
+
+        /**
+         * Makes the output write asynchronously: pieces are copied into a queue and written by a separate thread, so that the next piece can be
+         * produced while the previous one is written. Write only blocks once the given amount of pieces is waiting. 0 writes synchronously, which
+         * is the default. It has to be called before the first Write, and the StreamOutput must not be moved after that.
+         *
+         * @param[in] queueDepth_ Amount of pieces that may wait to be written.
+        */
+        void SetQueueDepth(const std::size_t queueDepth_) noexcept { _queueDepth = queueDepth_; }
+        /**
+         * @brief Writes the next piece of the output.
+         * @param[in] string_ Piece to be written.
+         * @throws Utility::Error
+        */
+        void Write(const std::string_view string_);
+        /**
+         * @brief Ends the output. The newline is written if needed and the output is flushed.
+         * @throws Utility::Error
+        */
+        void Finish();
+
+    private:
+        struct Writer;
+
+        /**
+         * @brief Writes a piece on the calling thread.
+         * @param[in] string_ Piece to be written.
+         * @throws Utility::Error
+        */
+        void WriteNow(const std::string_view string_);
+        /**
+         * @brief Lets the writer thread write the queued pieces and waits for it to end.
+         * @throws Utility::Error
+        */
+        void StopWriter();
+
+        std::ofstream _fileStream;
+        bool _isFile;
+        bool _endsWithNewline;
+        std::size_t _queueDepth;
+        std::unique_ptr<Writer> _writer;
+    };
+
     /**
-     * @brief Writes a string into a given file.
+     * @brief Writes a string into a given file, or to stdout if the path is -.
      * @param[in] string_ String to be written to file.
      * @param[in] filePath_ Path to file.
      * @throws Utility::Error
     */
     void WriteStringToFile(const std::string& string_, const std::filesystem::path& filePath_);
     /**
-     * @brief Reads a given file into a string.
+     * @brief Reads a given file into a string, or stdin if the path is -. The file is read in binary mode, so that nothing is lost or converted.
      * @param[in] filePath_ Path to file.
      * @returns Read string.
      * @throws Utility::Error
     */
     std::string ReadStringFromFile(const std::filesystem::path& filePath_);
+    /**
+     * Reads a given file in binary mode block by block and passes every block to a function, so that only one block is held in memory. Every block
+     * but the last one has the given size. The path - reads from stdin.
+     *
+     * @param[in] filePath_ Path to file.
+     * @param[in] blockSize_ Amount of bytes read at once.
+     * @param[in] function_ Function that is called with every block.
+     * @throws Utility::Error
+    */
+    void ReadFileInBlocks(const std::filesystem::path& filePath_, const std::size_t blockSize_, const std::function<void(std::string_view)>& function_);
+    /**
+     * Like ReadFileInBlocks, but the blocks are read by a separate thread, which reads up to a given amount of blocks ahead while the function
+     * works on the current block. Every block of the file is only held in memory until the function returns.
+     *
+     * @param[in] filePath_ Path to file.
+     * @param[in] blockSize_ Amount of bytes read at once.
+     * @param[in] queueDepth_ Amount of blocks read ahead, at least 1.
+     * @param[in] function_ Function that is called with every block, always on the calling thread.
+     * @throws Utility::Error
+    */
+    void ReadFileInBlocksAsync(const std::filesystem::path& filePath_, const std::size_t blockSize_, const std::size_t queueDepth_,
+                               const std::function<void(std::string_view)>& function_);
+    /**
+     * Prints the calls, bytes, time and throughput of every stage as well as the allocations of ByteBuffers to stderr, as counted by
+     * BinaryText::Statistics since the start of the program. Nothing is printed for StatisticsFormat::NONE.
+     *
+     * @param[in] statisticsFormat_ How to print the statistics.
+    */
+    void PrintStatistics(const Arguments::StatisticsFormat statisticsFormat_);
 }
\ No newline at end of file
@@ -25,14 +25,17 @@ OTHER DEALINGS IN THE SOFTWARE.
 For more information, please refer to <https://unlicense.org>
 */
 
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
-#include <iostream>
+#include <functional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <vector>
 
+#include "Batch.hpp"
 #include "BinaryText.hpp"
 #include "Utility.hpp"
 
@@ -55,6 +58,14 @@ int main(int argumentCount_, char** argumentArray_)
     }
 
     try {
+        if(arguments.IsBatch()) {
+            const bool isSuccess(Batch::Run(arguments));
+
+            Utility::PrintStatistics(arguments.GetStatisticsFormat());
+
+            return isSuccess ? 0 : -1;
+        }
+
         auto convert = [](const auto convertable_) -> auto {
             if constexpr(std::is_same_v<std::remove_const_t<decltype(convertable_)>, Utility::Arguments::Case>) {
                 switch(convertable_) {
@@ -85,15 +96,142 @@ int main(int argumentCount_, char** argumentArray_)
                 static_assert(false);
             }
         };
+        const std::size_t threadCount(arguments.GetThreadCount());
         auto processTextOutput = [&arguments](const std::string& string_) -> void {
             if(arguments.HasOutputFilePath()) {
                 Utility::WriteStringToFile(string_, arguments.GetOutputFilePath());
             } else {
-                std::cout << string_ << std::endl;
+                Utility::StreamOutput output;
+
+                output.Write(string_);
+                output.Finish();
             }
         };
+        auto readBinaryInput = [&arguments]() -> BinaryText::ByteBuffer<std::byte> {
+            BinaryText::ByteBuffer<std::byte> byteBuffer;
+
+            byteBuffer.MapFromFile(arguments.GetInputFilePath());
+
+            return byteBuffer;
+        };
         auto processBinaryOutput = [&arguments](const BinaryText::ByteBuffer<std::byte>& byteBuffer_) -> void {
-            byteBuffer_.WriteToFile(arguments.GetOutputFilePath());
+            if(arguments.IsOutputStandardOutput()) {
+                Utility::StreamOutput output(arguments.GetOutputFilePath());
+
+                output.Write(std::string_view(reinterpret_cast<const char*>(byteBuffer_.GetBuffer()), byteBuffer_.GetSize()));
+                output.Finish();
+            } else {
+                byteBuffer_.WriteToFile(arguments.GetOutputFilePath());
+            }
+        };
+        auto openStreamOutput = [&arguments]() -> Utility::StreamOutput {
+            Utility::StreamOutput output(arguments.HasOutputFilePath() ? Utility::StreamOutput(arguments.GetOutputFilePath()) : Utility::StreamOutput());
+
+            if(arguments.IsAsyncIo()) {
+                output.SetQueueDepth(arguments.GetQueueDepth());
+            }
+
+            return output;
+        };
+        // With --async-io the input file is read ahead on a thread of its own while the blocks before are encoded or decoded
+        auto readInputFile = [&arguments](const std::function<void(std::string_view)>& function_) -> void {
+            if(arguments.IsAsyncIo()) {
+                Utility::ReadFileInBlocksAsync(arguments.GetInputFilePath(), arguments.GetBlockSize(), arguments.GetQueueDepth(), function_);
+            } else {
+                Utility::ReadFileInBlocks(arguments.GetInputFilePath(), arguments.GetBlockSize(), function_);
+            }
+        };
+        auto encodeInputFile = [&arguments, &openStreamOutput, &readInputFile](auto encoder_) -> void {
+            const std::size_t blockSize(arguments.GetBlockSize());
+            Utility::StreamOutput output(openStreamOutput());
+            std::vector<char> encodedBlock(std::max(decltype(encoder_)::GetMaximumUpdateSize(blockSize), decltype(encoder_)::GetMaximumFinishSize()));
+
+            readInputFile([&encoder_, &output, &encodedBlock](const std::string_view block_) -> void {
+                output.Write(std::string_view(encodedBlock.data(), encoder_.Update(std::as_bytes(std::span(block_)), encodedBlock)));
+            });
+            output.Write(std::string_view(encodedBlock.data(), encoder_.Finish(encodedBlock)));
+            output.Finish();
+        };
+        auto readEncodedInputFile = [&readInputFile](const auto& decode_) -> void {
+            std::string lineBreak;
+            auto getLineBreakSize = [](const std::string_view characters_) -> std::size_t {
+                if(characters_.ends_with("\r\n")) {
+                    return 2;
+                }
+
+                return (characters_.ends_with('\n') or characters_.ends_with('\r')) ? 1 : 0;
+            };
+
+            // A line break at the end of the input, like the one written after the output on stdout, is held back and ignored
+            readInputFile([&lineBreak, &decode_, &getLineBreakSize](const std::string_view block_) -> void {
+                if(block_.size() <= 2) {
+                    const std::string characters(lineBreak + std::string(block_));
+                    const std::size_t lineBreakSize(getLineBreakSize(characters));
+
+                    decode_(std::string_view(characters).substr(0, characters.size() - lineBreakSize));
+                    lineBreak = characters.substr(characters.size() - lineBreakSize);
+                } else {
+                    const std::size_t lineBreakSize(getLineBreakSize(block_));
+
+                    decode_(lineBreak);
+                    decode_(block_.substr(0, block_.size() - lineBreakSize));
+                    lineBreak = block_.substr(block_.size() - lineBreakSize);
+                }
+            });
+
+            if(lineBreak == "\r") {
+                decode_(lineBreak);
+            }
+        };
+        auto decodeInputFile = [&arguments, &openStreamOutput, &readEncodedInputFile](auto decoder_) -> void {
+            const std::size_t blockSize(arguments.GetBlockSize());
+            Utility::StreamOutput output(openStreamOutput());
+            // Room for a block and a held back line break, or for a tiny block that is decoded together with the line break before it
+            std::vector<std::byte> decodedBlock(std::max(decltype(decoder_)::GetMaximumUpdateSize(std::max<std::size_t>(blockSize + 2, 4)),
+                                                         decltype(decoder_)::GetMaximumFinishSize()));
+
+            readEncodedInputFile([&decoder_, &output, &decodedBlock](const std::string_view characters_) -> void {
+                output.Write(std::string_view(reinterpret_cast<const char*>(decodedBlock.data()), decoder_.Update(characters_, decodedBlock)));
+            });
+            output.Write(std::string_view(reinterpret_cast<const char*>(decodedBlock.data()), decoder_.Finish(decodedBlock)));
+            output.Finish();
+        };
+        auto transcodeInputFile = [&openStreamOutput, &readEncodedInputFile](auto transcoder_) -> void {
+            Utility::StreamOutput output(openStreamOutput());
+            std::string transcodedBlock;
+
+            readEncodedInputFile([&transcoder_, &output, &transcodedBlock](const std::string_view characters_) -> void {
+                transcodedBlock.clear();
+                transcoder_.Update(characters_, transcodedBlock);
+                output.Write(transcodedBlock);
+            });
+            transcodedBlock.clear();
+            transcoder_.Finish(transcodedBlock);
+            output.Write(transcodedBlock);
+            output.Finish();
+        };
+        auto transcode = [&arguments, &convert, &processTextOutput, &transcodeInputFile](auto decoder_) -> void {
+            auto transcodeInto = [&arguments, &processTextOutput, &transcodeInputFile, &decoder_](auto encoder_) -> void {
+                if(arguments.HasInputString()) {
+                    processTextOutput(BinaryText::Transcode(arguments.GetInputString(), decoder_, encoder_));
+                } else {
+                    transcodeInputFile(BinaryText::Transcoder<decltype(decoder_), decltype(encoder_)>(decoder_, encoder_));
+                }
+            };
+
+            switch(arguments.GetTargetAlgorithm()) {
+                case Utility::Arguments::Algorithm::BASE_16: transcodeInto(BinaryText::Base16::Encoder(convert(arguments.GetCase()))); break;
+                case Utility::Arguments::Algorithm::BASE_32: transcodeInto(BinaryText::Base32::Encoder(convert(arguments.GetPadding()))); break;
+                case Utility::Arguments::Algorithm::BASE_32_HEX: transcodeInto(BinaryText::Base32Hex::Encoder(convert(arguments.GetPadding()))); break;
+                case Utility::Arguments::Algorithm::BASE_64: transcodeInto(BinaryText::Base64::Encoder(convert(arguments.GetPadding()))); break;
+                case Utility::Arguments::Algorithm::BASE_64_URL: transcodeInto(BinaryText::Base64Url::Encoder(convert(arguments.GetPadding()))); break;
+                case Utility::Arguments::Algorithm::ASCII_85: {
+                    transcodeInto(BinaryText::Ascii85::Encoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
+
+                    break;
+                }
+                default: Utility::UnreachableTerminate();
+            }
         };
 
         switch(arguments.GetTask()) {
@@ -101,50 +239,49 @@ int main(int argumentCount_, char** argumentArray_)
                 switch(arguments.GetAlgorithm()) {
                     case Utility::Arguments::Algorithm::BASE_16: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base16::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetCase())));
+                            processTextOutput(BinaryText::Base16::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetCase()), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base16::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetCase())));
+                            encodeInputFile(BinaryText::Base16::Encoder(convert(arguments.GetCase())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base32::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding())));
+                            processTextOutput(BinaryText::Base32::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding()),
+                                                                                       threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base32::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetPadding())));
+                            encodeInputFile(BinaryText::Base32::Encoder(convert(arguments.GetPadding())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32_HEX: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base32Hex::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding())));
+                            processTextOutput(BinaryText::Base32Hex::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding()),
+                                                                                          threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base32Hex::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                          convert(arguments.GetPadding())));
+                            encodeInputFile(BinaryText::Base32Hex::Encoder(convert(arguments.GetPadding())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base64::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding())));
+                            processTextOutput(BinaryText::Base64::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding()),
+                                                                                       threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base64::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetPadding())));
+                            encodeInputFile(BinaryText::Base64::Encoder(convert(arguments.GetPadding())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64_URL: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base64Url::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding())));
+                            processTextOutput(BinaryText::Base64Url::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetPadding()),
+                                                                                          threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base64Url::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                          convert(arguments.GetPadding())));
+                            encodeInputFile(BinaryText::Base64Url::Encoder(convert(arguments.GetPadding())));
                         }
 
                         break;
@@ -152,11 +289,9 @@ int main(int argumentCount_, char** argumentArray_)
                     case Utility::Arguments::Algorithm::ASCII_85: {
                         if(arguments.HasInputString()) {
                             processTextOutput(BinaryText::Ascii85::EncodeStringToString(arguments.GetInputString(), convert(arguments.GetSpaceFolding()),
-                                                                                        convert(arguments.GetAdobeMode())));
+                                                                                        convert(arguments.GetAdobeMode()), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Ascii85::EncodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                        convert(arguments.GetSpaceFolding()),
-                                                                                        convert(arguments.GetAdobeMode())));
+                            encodeInputFile(BinaryText::Ascii85::Encoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
                         }
 
                         break;
@@ -169,39 +304,57 @@ int main(int argumentCount_, char** argumentArray_)
             case Utility::Arguments::Task::ENCODE_BINARY: {
                 switch(arguments.GetAlgorithm()) {
                     case Utility::Arguments::Algorithm::BASE_16: {
-                        processTextOutput(BinaryText::Base16::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetCase())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Base16::Encoder(convert(arguments.GetCase())));
+                        } else {
+                            processTextOutput(BinaryText::Base16::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetCase()), threadCount));
+                        }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32: {
-                        processTextOutput(BinaryText::Base32::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetPadding())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Base32::Encoder(convert(arguments.GetPadding())));
+                        } else {
+                            processTextOutput(BinaryText::Base32::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetPadding()), threadCount));
+                        }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32_HEX: {
-                        processTextOutput(BinaryText::Base32Hex::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                          convert(arguments.GetPadding())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Base32Hex::Encoder(convert(arguments.GetPadding())));
+                        } else {
+                            processTextOutput(BinaryText::Base32Hex::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetPadding()), threadCount));
+                        }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64: {
-                        processTextOutput(BinaryText::Base64::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetPadding())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Base64::Encoder(convert(arguments.GetPadding())));
+                        } else {
+                            processTextOutput(BinaryText::Base64::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetPadding()), threadCount));
+                        }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64_URL: {
-                        processTextOutput(BinaryText::Base64Url::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                          convert(arguments.GetPadding())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Base64Url::Encoder(convert(arguments.GetPadding())));
+                        } else {
+                            processTextOutput(BinaryText::Base64Url::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetPadding()), threadCount));
+                        }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::ASCII_85: {
-                        processTextOutput(BinaryText::Ascii85::EncodeByteBufferToString(BinaryText::ByteBuffer<std::byte>(arguments.GetInputFilePath()),
-                                                                                        convert(arguments.GetSpaceFolding()),
-                                                                                        convert(arguments.GetAdobeMode())));
+                        if(arguments.IsInputStandardInput()) {
+                            encodeInputFile(BinaryText::Ascii85::Encoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
+                        } else {
+                            processTextOutput(BinaryText::Ascii85::EncodeByteBufferToString(readBinaryInput(), convert(arguments.GetSpaceFolding()),
+                                                                                            convert(arguments.GetAdobeMode()), threadCount));
+                        }
 
                         break;
                     }
@@ -214,46 +367,45 @@ int main(int argumentCount_, char** argumentArray_)
                 switch(arguments.GetAlgorithm()) {
                     case Utility::Arguments::Algorithm::BASE_16: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base16::DecodeStringToString(arguments.GetInputString(), convert(arguments.GetCase())));
+                            processTextOutput(BinaryText::Base16::DecodeStringToString(arguments.GetInputString(), convert(arguments.GetCase()), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base16::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                       convert(arguments.GetCase())));
+                            decodeInputFile(BinaryText::Base16::Decoder(convert(arguments.GetCase())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base32::DecodeStringToString(arguments.GetInputString()));
+                            processTextOutput(BinaryText::Base32::DecodeStringToString(arguments.GetInputString(), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base32::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base32::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32_HEX: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base32Hex::DecodeStringToString(arguments.GetInputString()));
+                            processTextOutput(BinaryText::Base32Hex::DecodeStringToString(arguments.GetInputString(), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base32Hex::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base32Hex::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base64::DecodeStringToString(arguments.GetInputString()));
+                            processTextOutput(BinaryText::Base64::DecodeStringToString(arguments.GetInputString(), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base64::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base64::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64_URL: {
                         if(arguments.HasInputString()) {
-                            processTextOutput(BinaryText::Base64Url::DecodeStringToString(arguments.GetInputString()));
+                            processTextOutput(BinaryText::Base64Url::DecodeStringToString(arguments.GetInputString(), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Base64Url::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base64Url::Decoder());
                         }
 
                         break;
@@ -261,11 +413,9 @@ int main(int argumentCount_, char** argumentArray_)
                     case Utility::Arguments::Algorithm::ASCII_85: {
                         if(arguments.HasInputString()) {
                             processTextOutput(BinaryText::Ascii85::DecodeStringToString(arguments.GetInputString(), convert(arguments.GetSpaceFolding()),
-                                                                                        convert(arguments.GetAdobeMode())));
+                                                                                        convert(arguments.GetAdobeMode()), threadCount));
                         } else {
-                            processTextOutput(BinaryText::Ascii85::DecodeStringToString(Utility::ReadStringFromFile(arguments.GetInputFilePath()),
-                                                                                        convert(arguments.GetSpaceFolding()),
-                                                                                        convert(arguments.GetAdobeMode())));
+                            decodeInputFile(BinaryText::Ascii85::Decoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
                         }
 
                         break;
@@ -279,63 +429,57 @@ int main(int argumentCount_, char** argumentArray_)
                 switch(arguments.GetAlgorithm()) {
                     case Utility::Arguments::Algorithm::BASE_16: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(
-                                BinaryText::Base16::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(), convert(arguments.GetCase())));
+                            processBinaryOutput(BinaryText::Base16::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(),
+                                                                                                        convert(arguments.GetCase()), threadCount));
                         } else {
-                            processBinaryOutput(BinaryText::Base16::DecodeStringToByteBuffer<std::byte>(
-                                Utility::ReadStringFromFile(arguments.GetInputFilePath()), convert(arguments.GetCase())));
+                            decodeInputFile(BinaryText::Base16::Decoder(convert(arguments.GetCase())));
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(BinaryText::Base32::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString()));
+                            processBinaryOutput(BinaryText::Base32::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(), threadCount));
                         } else {
-                            processBinaryOutput(
-                                BinaryText::Base32::DecodeStringToByteBuffer<std::byte>(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base32::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_32_HEX: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(BinaryText::Base32Hex::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString()));
+                            processBinaryOutput(BinaryText::Base32Hex::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(), threadCount));
                         } else {
-                            processBinaryOutput(
-                                BinaryText::Base32Hex::DecodeStringToByteBuffer<std::byte>(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base32Hex::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(BinaryText::Base64::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString()));
+                            processBinaryOutput(BinaryText::Base64::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(), threadCount));
                         } else {
-                            processBinaryOutput(
-                                BinaryText::Base64::DecodeStringToByteBuffer<std::byte>(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base64::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::BASE_64_URL: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(BinaryText::Base64Url::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString()));
+                            processBinaryOutput(BinaryText::Base64Url::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(), threadCount));
                         } else {
-                            processBinaryOutput(
-                                BinaryText::Base64Url::DecodeStringToByteBuffer<std::byte>(Utility::ReadStringFromFile(arguments.GetInputFilePath())));
+                            decodeInputFile(BinaryText::Base64Url::Decoder());
                         }
 
                         break;
                     }
                     case Utility::Arguments::Algorithm::ASCII_85: {
                         if(arguments.HasInputString()) {
-                            processBinaryOutput(BinaryText::Ascii85::DecodeStringToByteBuffer<std::byte>(
-                                arguments.GetInputString(), convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
+                            processBinaryOutput(BinaryText::Ascii85::DecodeStringToByteBuffer<std::byte>(arguments.GetInputString(),
+                                                                                                         convert(arguments.GetSpaceFolding()),
+                                                                                                         convert(arguments.GetAdobeMode()), threadCount));
                         } else {
-                            processBinaryOutput(BinaryText::Ascii85::DecodeStringToByteBuffer<std::byte>(
-                                Utility::ReadStringFromFile(arguments.GetInputFilePath()), convert(arguments.GetSpaceFolding()),
-                                convert(arguments.GetAdobeMode())));
+                            decodeInputFile(BinaryText::Ascii85::Decoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
                         }
 
                         break;
@@ -345,8 +489,27 @@ int main(int argumentCount_, char** argumentArray_)
 
                 break;
             }
+            case Utility::Arguments::Task::TRANSCODE: {
+                switch(arguments.GetAlgorithm()) {
+                    case Utility::Arguments::Algorithm::BASE_16: transcode(BinaryText::Base16::Decoder(BinaryText::Base16::Case::MIXED)); break;
+                    case Utility::Arguments::Algorithm::BASE_32: transcode(BinaryText::Base32::Decoder()); break;
+                    case Utility::Arguments::Algorithm::BASE_32_HEX: transcode(BinaryText::Base32Hex::Decoder()); break;
+                    case Utility::Arguments::Algorithm::BASE_64: transcode(BinaryText::Base64::Decoder()); break;
+                    case Utility::Arguments::Algorithm::BASE_64_URL: transcode(BinaryText::Base64Url::Decoder()); break;
+                    case Utility::Arguments::Algorithm::ASCII_85: {
+                        transcode(BinaryText::Ascii85::Decoder(convert(arguments.GetSpaceFolding()), convert(arguments.GetAdobeMode())));
+
+                        break;
+                    }
+                    default: Utility::UnreachableTerminate();
+                }
+
+                break;
+            }
             default: Utility::UnreachableTerminate();
         }
+
+        Utility::PrintStatistics(arguments.GetStatisticsFormat());
     } catch(const BinaryText::Base16::Error& error) {
         Utility::Exit(error.What(), -1);
     } catch(const BinaryText::Base32::Error& error) {